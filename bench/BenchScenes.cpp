@@ -0,0 +1,279 @@
+// bench/BenchScenes.cpp
+#include "BenchScenes.h"
+#include "Renderer/Camera.h"
+#include "Renderer/Model/Model.h"
+#include "Scene/Scene.h"
+#include "Scene/Entity.h"
+#include "Scene/Components.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+
+static constexpr float PI = 3.14159265358979f;
+// Distance between two grid cells, in model radii (models are scaled to a unit radius)
+static constexpr float GRID_SPACING = 3.0f;
+static constexpr uint32_t UNIQUE_MATERIAL_MODELS = 256;
+static constexpr uint32_t MANY_PARTS_COUNT = 500;
+static constexpr uint32_t TEXTURE_SIZE = 8;
+
+// Small deterministic generator (xorshift32): the scenes must not depend on
+// the standard library's distributions, which differ between implementations
+struct BenchRandom {
+    uint32_t State;
+
+    explicit BenchRandom(uint32_t seed) : State(seed ? seed : 1u) {}
+
+    uint32_t Next() {
+        State ^= State << 13;
+        State ^= State >> 17;
+        State ^= State << 5;
+        return State;
+    }
+    // In [0, 1)
+    float NextFloat() { return (Next() >> 8) * (1.0f / 16777216.0f); }
+};
+
+const std::vector<BenchSceneConfig>& GetBenchScenes() {
+    static const std::vector<BenchSceneConfig> scenes = {
+        { "backpacks_static", BenchModel::Backpack,        100,    1,    0.0f,  BenchCameraPath::Orbit },
+        { "backpacks_moving", BenchModel::Backpack,        100,    1,    0.25f, BenchCameraPath::Orbit },
+        { "backpacks_lights", BenchModel::Backpack,        100,    64,   0.0f,  BenchCameraPath::Orbit },
+        { "instancing_1k",    BenchModel::Sphere,          1000,   1,    0.0f,  BenchCameraPath::Orbit },
+        { "instancing_10k",   BenchModel::Sphere,          10000,  1,    0.0f,  BenchCameraPath::Orbit },
+        { "instancing_100k",  BenchModel::Sphere,          100000, 1,    0.0f,  BenchCameraPath::Orbit },
+        { "mixed_10k",        BenchModel::Sphere,          10000,  16,   0.1f,  BenchCameraPath::Orbit },
+        { "many_materials",   BenchModel::UniqueMaterials, 256,    1,    0.0f,  BenchCameraPath::Orbit },
+        { "submeshes_500",    BenchModel::ManyParts,       4,      1,    0.0f,  BenchCameraPath::Orbit },
+        { "lod_crowd",        BenchModel::DenseSphere,     2000,   1,    0.0f,  BenchCameraPath::FlyThrough },
+        { "lights_1k",        BenchModel::Sphere,          10000,  1000, 0.0f,  BenchCameraPath::Orbit },
+    };
+    return scenes;
+}
+
+// --- Generated assets ---
+
+static bool FileExists(const std::string& path) {
+    return std::ifstream(path).good();
+}
+
+// 8x8 checker of the material's color, as a binary PPM (read by stb_image)
+static bool WriteMaterialTexture(const std::string& path, uint32_t material) {
+    BenchRandom random(0x9E3779B9u ^ (material * 2654435761u));
+    const unsigned char color[3] = { static_cast<unsigned char>(64 + random.Next() % 192),
+                                     static_cast<unsigned char>(64 + random.Next() % 192),
+                                     static_cast<unsigned char>(64 + random.Next() % 192) };
+    FILE* file = std::fopen(path.c_str(), "wb");
+    if (!file) {
+        return false;
+    }
+    std::fprintf(file, "P6\n%u %u\n255\n", TEXTURE_SIZE, TEXTURE_SIZE);
+    for (uint32_t y = 0; y < TEXTURE_SIZE; y++) {
+        for (uint32_t x = 0; x < TEXTURE_SIZE; x++) {
+            const int shade = ((x + y) & 1) ? 1 : 2;
+            for (unsigned char channel : color) {
+                std::fputc(channel / shade, file);
+            }
+        }
+    }
+    return std::fclose(file) == 0;
+}
+
+// `partCount` UV spheres on a cubic grid (a single unit sphere when partCount
+// is 1), part p using material firstMaterial + p % materialCount
+static bool WriteSphereModel(const std::string& directory, const std::string& name, uint32_t partCount, uint32_t rings, uint32_t segments,
+                             uint32_t firstMaterial, uint32_t materialCount) {
+    const std::string objPath = directory + "/" + name + ".obj";
+    const std::string mtlPath = directory + "/" + name + ".mtl";
+    if (FileExists(objPath) && FileExists(mtlPath)) {
+        return true;
+    }
+
+    FILE* mtl = std::fopen(mtlPath.c_str(), "w");
+    if (!mtl) {
+        return false;
+    }
+    for (uint32_t m = 0; m < materialCount; m++) {
+        const uint32_t material = firstMaterial + m;
+        std::fprintf(mtl, "newmtl material_%u\nKd 1 1 1\nmap_Kd material_%u.ppm\n\n", material, material);
+    }
+    std::fclose(mtl);
+
+    FILE* obj = std::fopen(objPath.c_str(), "w");
+    if (!obj) {
+        return false;
+    }
+    std::fprintf(obj, "mtllib %s.mtl\n", name.c_str());
+    const uint32_t side = static_cast<uint32_t>(std::ceil(std::cbrt(static_cast<double>(partCount)) - 1e-9));
+    const float partRadius = partCount > 1 ? 0.4f : 1.0f;
+    const uint32_t rowVertices = segments + 1;
+    uint32_t firstVertex = 1; // OBJ indices start at 1 and span every part
+    for (uint32_t part = 0; part < partCount; part++) {
+        glm::vec3 center(0.0f);
+        if (partCount > 1) {
+            const float offset = (side - 1) * 0.5f;
+            center = glm::vec3(part % side - offset, (part / side) % side - offset, part / (side * side) - offset);
+        }
+        std::fprintf(obj, "o part_%u\nusemtl material_%u\n", part, firstMaterial + part % materialCount);
+        for (uint32_t r = 0; r <= rings; r++) {
+            const float theta = PI * r / rings;
+            for (uint32_t s = 0; s <= segments; s++) {
+                const float phi = 2.0f * PI * s / segments;
+                const glm::vec3 normal(std::sin(theta) * std::cos(phi), std::cos(theta), std::sin(theta) * std::sin(phi));
+                const glm::vec3 position = center + normal * partRadius;
+                std::fprintf(obj, "v %.5f %.5f %.5f\nvt %.5f %.5f\nvn %.5f %.5f %.5f\n", position.x, position.y, position.z,
+                             static_cast<float>(s) / segments, static_cast<float>(r) / rings, normal.x, normal.y, normal.z);
+            }
+        }
+        // Counter-clockwise seen from outside
+        for (uint32_t r = 0; r < rings; r++) {
+            for (uint32_t s = 0; s < segments; s++) {
+                const uint32_t a = firstVertex + r * rowVertices + s;
+                const uint32_t b = a + rowVertices;
+                std::fprintf(obj, "f %u/%u/%u %u/%u/%u %u/%u/%u\n", a, a, a, a + 1, a + 1, a + 1, b, b, b);
+                std::fprintf(obj, "f %u/%u/%u %u/%u/%u %u/%u/%u\n", a + 1, a + 1, a + 1, b + 1, b + 1, b + 1, b, b, b);
+            }
+        }
+        firstVertex += (rings + 1) * rowVertices;
+    }
+    return std::fclose(obj) == 0;
+}
+
+BenchAssets::BenchAssets(const std::string& directory, const std::string& backpackPath)
+    : m_Directory(directory), m_BackpackPath(backpackPath) {
+}
+
+bool BenchAssets::Generate() {
+    // Materials 0..255 belong to the UniqueMaterials models, 256+ to the parts
+    const uint32_t materialCount = UNIQUE_MATERIAL_MODELS + 16;
+    for (uint32_t material = 0; material < materialCount; material++) {
+        const std::string path = m_Directory + "/material_" + std::to_string(material) + ".ppm";
+        if (!FileExists(path) && !WriteMaterialTexture(path, material)) {
+            std::cerr << "BenchAssets: cannot write " << path << " (does " << m_Directory << " exist?)" << std::endl;
+            return false;
+        }
+    }
+    bool written = WriteSphereModel(m_Directory, "sphere", 1, 8, 12, 0, 1)
+                && WriteSphereModel(m_Directory, "dense_sphere", 1, 100, 100, 1, 1)
+                && WriteSphereModel(m_Directory, "many_parts", MANY_PARTS_COUNT, 6, 8, UNIQUE_MATERIAL_MODELS, 16);
+    for (uint32_t variant = 0; written && variant < UNIQUE_MATERIAL_MODELS; variant++) {
+        written = WriteSphereModel(m_Directory, "unique_" + std::to_string(variant), 1, 8, 12, variant, 1);
+    }
+    if (!written) {
+        std::cerr << "BenchAssets: cannot write the generated models in " << m_Directory << std::endl;
+    }
+    return written;
+}
+
+std::string BenchAssets::GetModelPath(BenchModel model, uint32_t variant) const {
+    switch (model) {
+    case BenchModel::Backpack:        return m_BackpackPath;
+    case BenchModel::Sphere:          return m_Directory + "/sphere.obj";
+    case BenchModel::DenseSphere:     return m_Directory + "/dense_sphere.obj";
+    case BenchModel::ManyParts:       return m_Directory + "/many_parts.obj";
+    case BenchModel::UniqueMaterials: return m_Directory + "/unique_" + std::to_string(variant) + ".obj";
+    }
+    return std::string();
+}
+
+uint32_t BenchAssets::GetVariantCount(BenchModel model) const {
+    return model == BenchModel::UniqueMaterials ? UNIQUE_MATERIAL_MODELS : 1;
+}
+
+// --- BenchScene ---
+
+BenchScene::BenchScene(const BenchSceneConfig& config, const BenchAssets& assets)
+    : m_Config(config), m_Assets(assets), m_Scene(std::make_unique<Scene>()) {
+}
+
+BenchScene::~BenchScene() {
+    // Entities first: they hold references to the models
+    m_Scene.reset();
+}
+
+bool BenchScene::Build() {
+    const uint32_t variantCount = m_Assets.GetVariantCount(m_Config.Model);
+    for (uint32_t variant = 0; variant < variantCount; variant++) {
+        const std::string path = m_Assets.GetModelPath(m_Config.Model, variant);
+        if (!FileExists(path)) {
+            std::cerr << "BenchScene: " << m_Config.Name << " skipped, " << path << " not found" << std::endl;
+            return false;
+        }
+        auto model = std::make_shared<Model>(path);
+        if (model->GetMeshes().empty()) {
+            std::cerr << "BenchScene: " << m_Config.Name << " skipped, " << path << " has no mesh" << std::endl;
+            return false;
+        }
+        m_Models.push_back(model);
+    }
+
+    BenchRandom random(0x504C554Du); // Same seed for every scene
+    const uint32_t side = static_cast<uint32_t>(std::ceil(std::sqrt(static_cast<double>(m_Config.EntityCount))));
+    const float offset = (side - 1) * 0.5f;
+    m_Extent = std::max(side * GRID_SPACING * 0.5f, 1.0f);
+    m_Center = glm::vec3(0.0f);
+    for (uint32_t i = 0; i < m_Config.EntityCount; i++) {
+        const std::shared_ptr<Model>& model = m_Models[i % m_Models.size()];
+        // Every model is scaled to a unit radius and centered on its cell
+        const BoundingSphere& sphere = model->GetBoundingSphere();
+        const float scale = sphere.Radius > 0.0f ? 1.0f / sphere.Radius : 1.0f;
+        const glm::vec3 cell((i % side - offset) * GRID_SPACING + (random.NextFloat() - 0.5f),
+                             0.0f,
+                             (i / side - offset) * GRID_SPACING + (random.NextFloat() - 0.5f));
+
+        Entity entity = m_Scene->CreateEntity("Bench object");
+        const auto& transform = entity.PatchComponent<TransformComponent>([&](TransformComponent& created) {
+            created.Translation = cell - sphere.Center * scale;
+            created.Rotation.y = random.NextFloat() * 2.0f * PI;
+            created.Scale = glm::vec3(scale);
+        });
+        entity.AddComponent<ModelComponent>(model);
+
+        if (random.NextFloat() < m_Config.MovingFraction) {
+            m_Moving.push_back({ entity.GetHandle(), transform.Translation, random.NextFloat() * 2.0f * PI });
+        }
+    }
+
+    // Ranges cover the grid a few times over, whatever the light count: a
+    // single light still reaches everything
+    const float lightRange = std::max(2.0f * m_Extent / std::sqrt(static_cast<float>(std::max(m_Config.LightCount, 1u))), 1.0f) * 2.0f;
+    for (uint32_t i = 0; i < m_Config.LightCount; i++) {
+        Entity light = m_Scene->CreateEntity("Bench light");
+        light.PatchComponent<TransformComponent>([&](TransformComponent& transform) {
+            transform.Translation = glm::vec3((random.NextFloat() - 0.5f) * 2.0f * m_Extent, 3.0f, (random.NextFloat() - 0.5f) * 2.0f * m_Extent);
+        });
+        auto& component = light.AddComponent<LightComponent>();
+        component.Color = glm::vec3(0.5f + 0.5f * random.NextFloat(), 0.5f + 0.5f * random.NextFloat(), 0.5f + 0.5f * random.NextFloat());
+        component.Range = lightRange;
+    }
+    return true;
+}
+
+float BenchScene::GetViewDistance() const {
+    return m_Extent * 4.0f + 20.0f;
+}
+
+void BenchScene::Animate(uint32_t frame, uint32_t frameCount, Camera& camera) {
+    entt::registry& registry = m_Scene->GetRegistry();
+    for (const MovingEntity& moving : m_Moving) {
+        // Patched: the scene recomputes their world matrix and bounds
+        registry.patch<TransformComponent>(moving.Handle, [&](TransformComponent& transform) {
+            transform.Translation = moving.BasePosition + glm::vec3(0.0f, std::sin(frame * 0.1f + moving.Phase), 0.0f);
+            transform.Rotation.y = moving.Phase + frame * 0.02f;
+        });
+    }
+
+    const float t = frameCount > 0 ? static_cast<float>(frame) / frameCount : 0.0f;
+    if (m_Config.CameraPath == BenchCameraPath::Orbit) {
+        const float angle = 2.0f * PI * t;
+        const float radius = m_Extent * 1.5f + 4.0f;
+        const glm::vec3 position = m_Center + glm::vec3(std::cos(angle) * radius, m_Extent * 0.6f + 2.0f, std::sin(angle) * radius);
+        camera.LookAt(position, m_Center);
+    } else {
+        // From outside the grid to its far side, a couple of radii above the objects
+        const float z = m_Extent + 4.0f - t * 2.0f * m_Extent;
+        const glm::vec3 position = m_Center + glm::vec3(0.0f, 2.0f, z);
+        camera.LookAt(position, position + glm::vec3(0.0f, -0.2f, -1.0f));
+    }
+}
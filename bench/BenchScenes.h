@@ -0,0 +1,93 @@
+// bench/BenchScenes.h
+#pragma once
+
+#include <entt/entt.hpp>
+#include <glm/glm.hpp>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+class Scene;
+class Camera;
+class Model;
+
+// What the entities of a bench scene draw
+enum class BenchModel {
+    Backpack,        // The sample asset (assets/models/backpack), skipped when missing
+    Sphere,          // Low-poly sphere (~200 triangles): per-instance costs dominate
+    DenseSphere,     // ~20k triangles: long LOD chain
+    ManyParts,       // One model of 500 small submeshes
+    UniqueMaterials  // 256 models, each with its own material and texture, used once each
+};
+
+enum class BenchCameraPath {
+    Orbit,     // Circles the whole grid, looking at its center
+    FlyThrough // Low pass along the grid, from far to near objects
+};
+
+struct BenchSceneConfig {
+    const char* Name;
+    BenchModel Model;
+    uint32_t EntityCount;
+    uint32_t LightCount;
+    float MovingFraction; // Share of the entities animated every frame
+    BenchCameraPath CameraPath;
+};
+
+// Every scene the bench knows, in run order
+const std::vector<BenchSceneConfig>& GetBenchScenes();
+
+// Generated models (OBJ + MTL + PPM textures) and where the real assets are.
+// The files are only written when missing: their content never changes, so
+// the mesh caches next to them stay valid between runs.
+class BenchAssets {
+public:
+    BenchAssets(const std::string& directory, const std::string& backpackPath);
+
+    bool Generate();
+    // Source file of a model, `variant` picking one of the UniqueMaterials models
+    std::string GetModelPath(BenchModel model, uint32_t variant = 0) const;
+    uint32_t GetVariantCount(BenchModel model) const;
+
+private:
+    std::string m_Directory;
+    std::string m_BackpackPath;
+};
+
+// A bench scene built from its config. Placement, rotations and animation
+// only depend on the config and the frame index, never on the clock, so two
+// runs render exactly the same frames.
+class BenchScene {
+public:
+    BenchScene(const BenchSceneConfig& config, const BenchAssets& assets);
+    ~BenchScene();
+
+    // False when a model cannot be loaded (the scene is then skipped)
+    bool Build();
+    // Moves the animated entities and places the camera for `frame`
+    void Animate(uint32_t frame, uint32_t frameCount, Camera& camera);
+
+    // Far plane that keeps the whole grid visible from the camera path
+    float GetViewDistance() const;
+
+    Scene& GetScene() { return *m_Scene; }
+    const std::vector<std::shared_ptr<Model>>& GetModels() const { return m_Models; }
+    const BenchSceneConfig& GetConfig() const { return m_Config; }
+
+private:
+    struct MovingEntity {
+        entt::entity Handle;
+        glm::vec3 BasePosition;
+        float Phase;
+    };
+
+    const BenchSceneConfig& m_Config;
+    const BenchAssets& m_Assets;
+    std::unique_ptr<Scene> m_Scene;
+    std::vector<std::shared_ptr<Model>> m_Models;
+    std::vector<MovingEntity> m_Moving;
+    glm::vec3 m_Center = glm::vec3(0.0f);
+    float m_Extent = 1.0f;     // Half size of the grid
+    float m_ModelRadius = 1.0f;
+};
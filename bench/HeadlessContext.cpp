@@ -0,0 +1,166 @@
+// bench/HeadlessContext.cpp
+#include "HeadlessContext.h"
+#include <glad/glad.h>
+#include <EGL/egl.h>
+#include <EGL/eglext.h>
+#include <cstring>
+#include <iostream>
+
+#ifndef EGL_PLATFORM_SURFACELESS_MESA
+#define EGL_PLATFORM_SURFACELESS_MESA 0x31DD
+#endif
+
+static bool HasExtension(const char* extensions, const char* name) {
+    if (!extensions) {
+        return false;
+    }
+    const size_t length = std::strlen(name);
+    for (const char* found = std::strstr(extensions, name); found; found = std::strstr(found + length, name)) {
+        const bool starts = found == extensions || found[-1] == ' ';
+        const bool ends = found[length] == ' ' || found[length] == '\0';
+        if (starts && ends) {
+            return true;
+        }
+    }
+    return false;
+}
+
+static EGLDisplay OpenDisplay() {
+    // Client extensions (EGL_NO_DISPLAY query): the platform needs no X11/Wayland/DRM device
+    const char* clientExtensions = eglQueryString(EGL_NO_DISPLAY, EGL_EXTENSIONS);
+    if (HasExtension(clientExtensions, "EGL_MESA_platform_surfaceless")) {
+        auto getPlatformDisplay = reinterpret_cast<PFNEGLGETPLATFORMDISPLAYEXTPROC>(eglGetProcAddress("eglGetPlatformDisplayEXT"));
+        if (getPlatformDisplay) {
+            EGLDisplay display = getPlatformDisplay(EGL_PLATFORM_SURFACELESS_MESA, EGL_DEFAULT_DISPLAY, nullptr);
+            if (display != EGL_NO_DISPLAY) {
+                return display;
+            }
+        }
+    }
+    return eglGetDisplay(EGL_DEFAULT_DISPLAY);
+}
+
+HeadlessContext::~HeadlessContext() {
+    Shutdown();
+}
+
+bool HeadlessContext::Init(uint32_t width, uint32_t height) {
+    m_Width = width;
+    m_Height = height;
+
+    EGLDisplay display = OpenDisplay();
+    EGLint major = 0, minor = 0;
+    if (display == EGL_NO_DISPLAY || !eglInitialize(display, &major, &minor)) {
+        std::cerr << "HeadlessContext: no EGL display (error 0x" << std::hex << eglGetError() << std::dec << ")" << std::endl;
+        return false;
+    }
+    m_Display = display;
+    if (!eglBindAPI(EGL_OPENGL_API)) {
+        std::cerr << "HeadlessContext: EGL has no desktop OpenGL support" << std::endl;
+        return false;
+    }
+
+    const EGLint configAttributes[] = {
+        EGL_SURFACE_TYPE, EGL_PBUFFER_BIT,
+        EGL_RENDERABLE_TYPE, EGL_OPENGL_BIT,
+        EGL_NONE
+    };
+    EGLConfig config = nullptr;
+    EGLint configCount = 0;
+    if (!eglChooseConfig(display, configAttributes, &config, 1, &configCount) || configCount == 0) {
+        std::cerr << "HeadlessContext: no OpenGL EGL config" << std::endl;
+        return false;
+    }
+
+    // Same context as the SDL window: 3.3 core
+    const EGLint contextAttributes[] = {
+        EGL_CONTEXT_MAJOR_VERSION, 3,
+        EGL_CONTEXT_MINOR_VERSION, 3,
+        EGL_CONTEXT_OPENGL_PROFILE_MASK, EGL_CONTEXT_OPENGL_CORE_PROFILE_BIT,
+        EGL_NONE
+    };
+    EGLContext context = eglCreateContext(display, config, EGL_NO_CONTEXT, contextAttributes);
+    if (context == EGL_NO_CONTEXT) {
+        std::cerr << "HeadlessContext: eglCreateContext failed (error 0x" << std::hex << eglGetError() << std::dec << ")" << std::endl;
+        return false;
+    }
+    m_Context = context;
+
+    // Without EGL_KHR_surfaceless_context a tiny pbuffer stands in for the window
+    EGLSurface surface = EGL_NO_SURFACE;
+    if (!HasExtension(eglQueryString(display, EGL_EXTENSIONS), "EGL_KHR_surfaceless_context")) {
+        const EGLint pbufferAttributes[] = { EGL_WIDTH, 1, EGL_HEIGHT, 1, EGL_NONE };
+        surface = eglCreatePbufferSurface(display, config, pbufferAttributes);
+        m_Surface = surface;
+    }
+    if (!eglMakeCurrent(display, surface, surface, context)) {
+        std::cerr << "HeadlessContext: eglMakeCurrent failed (error 0x" << std::hex << eglGetError() << std::dec << ")" << std::endl;
+        return false;
+    }
+    if (!gladLoadGLLoader(reinterpret_cast<GLADloadproc>(eglGetProcAddress))) {
+        std::cerr << "HeadlessContext: gladLoadGLLoader failed" << std::endl;
+        return false;
+    }
+
+    m_RendererName = reinterpret_cast<const char*>(glGetString(GL_RENDERER));
+    m_VersionString = reinterpret_cast<const char*>(glGetString(GL_VERSION));
+    std::cout << "HeadlessContext: EGL " << major << "." << minor << ", " << m_RendererName << ", OpenGL " << m_VersionString << std::endl;
+    return CreateFramebuffer();
+}
+
+bool HeadlessContext::CreateFramebuffer() {
+    glGenRenderbuffers(1, &m_ColorBuffer);
+    glBindRenderbuffer(GL_RENDERBUFFER, m_ColorBuffer);
+    glRenderbufferStorage(GL_RENDERBUFFER, GL_RGBA8, m_Width, m_Height);
+    glGenRenderbuffers(1, &m_DepthBuffer);
+    glBindRenderbuffer(GL_RENDERBUFFER, m_DepthBuffer);
+    glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH24_STENCIL8, m_Width, m_Height);
+    glBindRenderbuffer(GL_RENDERBUFFER, 0);
+
+    glGenFramebuffers(1, &m_Framebuffer);
+    glBindFramebuffer(GL_FRAMEBUFFER, m_Framebuffer);
+    glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_RENDERBUFFER, m_ColorBuffer);
+    glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_STENCIL_ATTACHMENT, GL_RENDERBUFFER, m_DepthBuffer);
+    if (glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE) {
+        std::cerr << "HeadlessContext: offscreen framebuffer incomplete" << std::endl;
+        return false;
+    }
+    glViewport(0, 0, m_Width, m_Height);
+    return true;
+}
+
+bool HeadlessContext::MakeCurrent() {
+    if (!eglMakeCurrent(m_Display, m_Surface, m_Surface, m_Context)) {
+        std::cerr << "HeadlessContext: eglMakeCurrent failed (error 0x" << std::hex << eglGetError() << std::dec << ")" << std::endl;
+        return false;
+    }
+    return true;
+}
+
+void HeadlessContext::ReleaseCurrent() {
+    eglMakeCurrent(m_Display, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+}
+
+void HeadlessContext::Shutdown() {
+    if (!m_Display) {
+        return;
+    }
+    if (m_Context) {
+        if (m_Framebuffer) {
+            glBindFramebuffer(GL_FRAMEBUFFER, 0);
+            glDeleteFramebuffers(1, &m_Framebuffer);
+            glDeleteRenderbuffers(1, &m_ColorBuffer);
+            glDeleteRenderbuffers(1, &m_DepthBuffer);
+            m_Framebuffer = m_ColorBuffer = m_DepthBuffer = 0;
+        }
+        eglMakeCurrent(m_Display, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+        eglDestroyContext(m_Display, m_Context);
+        m_Context = nullptr;
+    }
+    if (m_Surface) {
+        eglDestroySurface(m_Display, m_Surface);
+        m_Surface = nullptr;
+    }
+    eglTerminate(m_Display);
+    m_Display = nullptr;
+}
@@ -0,0 +1,49 @@
+// bench/HeadlessContext.h
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+// OpenGL 3.3 core context without any window, for benchmarks and CI.
+// EGL on Mesa's surfaceless platform (GPU-less Linux boxes run it on
+// llvmpipe), the default EGL display otherwise. There is no default
+// framebuffer: frames are rendered into an offscreen framebuffer object of
+// the requested size, bound for the lifetime of the context.
+class HeadlessContext {
+public:
+    HeadlessContext() = default;
+    ~HeadlessContext();
+    HeadlessContext(const HeadlessContext&) = delete;
+    HeadlessContext& operator=(const HeadlessContext&) = delete;
+
+    // Creates the context, makes it current and loads the GL functions
+    bool Init(uint32_t width, uint32_t height);
+    // GL objects of the engine must be released before
+    void Shutdown();
+    // The context is current on one thread at a time: release it before
+    // making it current on another one (see the pipelined runs of PlumeBench)
+    bool MakeCurrent();
+    void ReleaseCurrent();
+
+    uint32_t GetWidth() const { return m_Width; }
+    uint32_t GetHeight() const { return m_Height; }
+    // GL_RENDERER / GL_VERSION strings, for the reports
+    const std::string& GetRendererName() const { return m_RendererName; }
+    const std::string& GetVersionString() const { return m_VersionString; }
+
+private:
+    bool CreateFramebuffer();
+
+    // EGLDisplay, EGLSurface, EGLContext
+    void* m_Display = nullptr;
+    void* m_Surface = nullptr; // 1x1 pbuffer, only without EGL_KHR_surfaceless_context
+    void* m_Context = nullptr;
+
+    uint32_t m_Framebuffer = 0;
+    uint32_t m_ColorBuffer = 0;
+    uint32_t m_DepthBuffer = 0;
+    uint32_t m_Width = 0;
+    uint32_t m_Height = 0;
+    std::string m_RendererName;
+    std::string m_VersionString;
+};
@@ -0,0 +1,663 @@
+// bench/PlumeBench.cpp
+// Headless end-to-end benchmark. Renders fixed scenes (see BenchScenes) with a
+// scripted camera in an offscreen context and writes a JSON report: frame time
+// percentiles, CPU/GPU time per profiler zone, draw and triangle counts, and
+// cold/warm model import times, and the memory held by the models, the
+// geometry arenas and the texture cache. Runs are deterministic, so two reports of the
+// same build and machine can be compared for regressions. With --pipelined,
+// each scene is run again with the simulation and the rendering on two
+// threads (see RenderThread), and the report adds the throughput gained and
+// the latency added.
+#include "HeadlessContext.h"
+#include "BenchScenes.h"
+#include "PlumeVersion.h"
+#include "Core/JobSystem.h"
+#include "Core/Profiler.h"
+#include "Renderer/Camera.h"
+#include "Renderer/DynamicBuffer.h"
+#include "Renderer/GpuProfiler.h"
+#include "Renderer/RenderThread.h"
+#include "Renderer/SceneRenderer.h"
+#include "Renderer/TextureCache.h"
+#include "Renderer/TextureStreamer.h"
+#include "Renderer/Model/MeshCache.h"
+#include "Renderer/Model/Model.h"
+#include "Scene/Scene.h"
+#include <glad/glad.h>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Fixed simulation step: frame content never depends on the measured times
+static constexpr float BENCH_DELTA_TIME = 1.0f / 60.0f;
+// Upper bound on the wait for streamed textures before a scene is measured
+static constexpr uint32_t TEXTURE_WAIT_FRAMES = 5000;
+// Copies of one model loaded by the texture cache check
+static constexpr uint32_t TEXTURE_SHARING_LOADS = 8;
+
+struct BenchOptions {
+    std::vector<std::string> Scenes; // Empty: every scene
+    uint32_t Frames = 300;
+    uint32_t WarmupFrames = 30;
+    uint32_t Width = 1280;
+    uint32_t Height = 720;
+    uint32_t ImportRuns = 5; // 0 skips the import timings
+    bool Pipelined = false;
+    bool IndirectDraws = false;
+    std::string OutputPath = "plume_bench.json";
+    std::string AssetDirectory = "bench_assets";
+    std::string BackpackPath = "assets/models/backpack/12305_backpack_v2_l3.obj";
+};
+
+struct Distribution {
+    double Mean = 0.0;
+    double Min = 0.0;
+    double P50 = 0.0;
+    double P90 = 0.0;
+    double P95 = 0.0;
+    double P99 = 0.0;
+    double Max = 0.0;
+};
+
+// Same frames, simulation and rendering on two threads
+struct PipelinedResult {
+    bool Measured = false;
+    Distribution LatencyMs;       // From the extraction to the end of the GPU work
+    Distribution FrameIntervalMs; // Between two frames finished by the render thread
+    double ThroughputFps = 0.0;
+    double SerialThroughputFps = 0.0;
+};
+
+// Memory once a scene or a model is loaded and its textures uploaded
+struct MemoryResult {
+    MemoryUsage Geometry;      // Model::GetMemoryUsage, summed over the models
+    MemoryUsage Textures;      // Model::GetTextureMemoryUsage (imports only: models may share textures)
+    MemoryUsage Arenas;        // Mesh::GetArenaMemoryUsage: every model loaded so far
+    uint64_t TextureCacheBytes = 0; // TextureCacheStats::ResidentBytes
+};
+
+struct SceneResult {
+    const BenchSceneConfig* Config = nullptr;
+    bool Skipped = false;
+    uint32_t Frames = 0;
+    Distribution FrameMs;
+    Distribution DrawCalls;
+    Distribution Triangles;
+    Distribution VisibleObjects;
+    Distribution StateBinds;
+    Distribution IndirectDraws; // Draws packed into the multi-draw calls
+    Distribution FenceWaitMs; // Instance stream, see DynamicBuffer
+    Distribution LightIndices; // Entries of the light cluster lists
+    double UploadedBytes = 0.0; // Per frame, averaged
+    MemoryResult Memory;
+    std::vector<ProfilerZoneStats> Zones;
+    PipelinedResult Pipelined;
+};
+
+struct ImportResult {
+    std::string Name;
+    std::string Path;
+    uint32_t Meshes = 0;
+    Distribution ColdMs; // Assimp import, optimization, LODs and cache write
+    Distribution WarmMs; // Mapped from the mesh cache
+    MemoryResult Memory;
+};
+
+// Nearest-rank percentiles, as Profiler::GetSummary
+static Distribution Summarize(std::vector<double> samples) {
+    Distribution result;
+    if (samples.empty()) {
+        return result;
+    }
+    std::sort(samples.begin(), samples.end());
+    auto percentile = [&](double fraction) {
+        const size_t rank = static_cast<size_t>(std::ceil(fraction * samples.size()));
+        return samples[rank > 0 ? rank - 1 : 0];
+    };
+    double total = 0.0;
+    for (double sample : samples) {
+        total += sample;
+    }
+    result.Mean = total / samples.size();
+    result.Min = samples.front();
+    result.P50 = percentile(0.50);
+    result.P90 = percentile(0.90);
+    result.P95 = percentile(0.95);
+    result.P99 = percentile(0.99);
+    result.Max = samples.back();
+    return result;
+}
+
+// Streamed textures keep decoding after the model is built; the measured
+// frames must not include their uploads
+static void WaitForTextures() {
+    for (uint32_t i = 0; i < TEXTURE_WAIT_FRAMES && !TextureStreamer::IsIdle(); i++) {
+        TextureStreamer::Update();
+        glFinish();
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+}
+
+static MemoryResult MeasureMemory(const std::vector<const Model*>& models) {
+    MemoryResult result;
+    for (const Model* model : models) {
+        result.Geometry += model->GetMemoryUsage();
+        result.Textures += model->GetTextureMemoryUsage();
+    }
+    result.Arenas = Mesh::GetArenaMemoryUsage();
+    result.TextureCacheBytes = TextureCache::GetStats().ResidentBytes;
+    return result;
+}
+
+// The frames of RunScene again, with the simulation (animation, scene update,
+// extraction) on this thread and the rendering on a RenderThread. The
+// simulation waits for each snapshot to be picked up, so no frame is dropped
+// and both runs draw the same frames.
+static PipelinedResult RunScenePipelined(BenchScene& benchScene, Camera& camera, HeadlessContext& context, SceneRenderer& renderer, const BenchOptions& options) {
+    PipelinedResult result;
+    const uint32_t totalFrames = options.WarmupFrames + options.Frames;
+    // Written by the render thread only, read after Stop
+    std::vector<double> latencyMs(totalFrames, 0.0);
+    std::vector<uint64_t> finishTimes(totalFrames, 0);
+
+    context.ReleaseCurrent();
+    RenderThread renderThread;
+    renderThread.Start(
+        [&]() { context.MakeCurrent(); },
+        [&](const RenderSnapshot& snapshot) {
+            GpuProfiler::BeginFrame();
+            TextureStreamer::Update();
+            renderer.Render(snapshot);
+            {
+                PLUME_PROFILE_SCOPE("GPU wait");
+                glFinish();
+            }
+            const uint64_t now = Profiler::GetTime();
+            const uint64_t frame = snapshot.FrameIndex - 1;
+            if (frame < totalFrames) {
+                latencyMs[frame] = (now - snapshot.ExtractTime) / 1e6;
+                finishTimes[frame] = now;
+            }
+        },
+        [&]() { context.ReleaseCurrent(); });
+
+    uint64_t measureStart = 0;
+    for (uint32_t frame = 0; frame < totalFrames; frame++) {
+        if (frame == options.WarmupFrames) {
+            measureStart = Profiler::GetTime();
+        }
+        Profiler::BeginFrame();
+        {
+            PLUME_PROFILE_SCOPE("Animate");
+            benchScene.Animate(frame, totalFrames, camera);
+        }
+        benchScene.GetScene().OnUpdate(BENCH_DELTA_TIME);
+        // Publishing before the render thread takes the previous snapshot would drop it
+        {
+            PLUME_PROFILE_SCOPE("Wait render");
+            while (renderThread.IsSnapshotPending()) {
+                std::this_thread::yield();
+            }
+        }
+        RenderSnapshot& snapshot = renderThread.GetWriteSnapshot();
+        snapshot.FrameIndex = frame + 1;
+        SceneRenderer::Extract(benchScene.GetScene(), camera, snapshot);
+        renderThread.Publish();
+        Profiler::EndFrame();
+    }
+    while (renderThread.IsSnapshotPending()) {
+        std::this_thread::yield();
+    }
+    // Lets the last frame finish
+    renderThread.Stop();
+    context.MakeCurrent();
+
+    if (renderThread.GetStats().FramesRendered != totalFrames) {
+        std::cerr << "PlumeBench: pipelined run dropped frames" << std::endl;
+        return result;
+    }
+    std::vector<double> measuredLatency(latencyMs.begin() + options.WarmupFrames, latencyMs.end());
+    std::vector<double> intervals;
+    for (uint32_t frame = std::max(options.WarmupFrames, 1u); frame < totalFrames; frame++) {
+        intervals.push_back((finishTimes[frame] - finishTimes[frame - 1]) / 1e6);
+    }
+    const double elapsedMs = (finishTimes.back() - measureStart) / 1e6;
+    result.Measured = true;
+    result.LatencyMs = Summarize(std::move(measuredLatency));
+    result.FrameIntervalMs = Summarize(std::move(intervals));
+    result.ThroughputFps = elapsedMs > 0.0 ? options.Frames * 1000.0 / elapsedMs : 0.0;
+    return result;
+}
+
+static SceneResult RunScene(const BenchSceneConfig& config, const BenchAssets& assets, HeadlessContext& context, SceneRenderer& renderer, const BenchOptions& options) {
+    SceneResult result;
+    result.Config = &config;
+    std::cout << "PlumeBench: " << config.Name << "..." << std::endl;
+
+    BenchScene benchScene(config, assets);
+    if (!benchScene.Build()) {
+        result.Skipped = true;
+        return result;
+    }
+    Camera camera(45.0f, static_cast<float>(options.Width) / static_cast<float>(options.Height), 0.1f, benchScene.GetViewDistance());
+    WaitForTextures();
+    std::vector<const Model*> models;
+    for (const std::shared_ptr<Model>& model : benchScene.GetModels()) {
+        models.push_back(model.get());
+    }
+    result.Memory = MeasureMemory(models);
+
+    std::vector<double> frameMs, drawCalls, triangles, visibleObjects, stateBinds, indirectDraws, fenceWaitMs, lightIndices;
+    double uploadedBytes = 0.0;
+    double totalFrameMs = 0.0;
+    const uint32_t totalFrames = options.WarmupFrames + options.Frames;
+    for (uint32_t frame = 0; frame < totalFrames; frame++) {
+        const bool measured = frame >= options.WarmupFrames;
+        if (frame == options.WarmupFrames) {
+            Profiler::BeginCapture();
+        }
+        Profiler::BeginFrame();
+        GpuProfiler::BeginFrame();
+        const uint64_t start = Profiler::GetTime();
+
+        {
+            PLUME_PROFILE_SCOPE("Animate");
+            benchScene.Animate(frame, totalFrames, camera);
+        }
+        benchScene.GetScene().OnUpdate(BENCH_DELTA_TIME);
+        TextureStreamer::Update();
+        renderer.Render(benchScene.GetScene(), camera);
+        {
+            // Stands in for the buffer swap: the frame is done when the GPU is
+            PLUME_PROFILE_SCOPE("GPU wait");
+            glFinish();
+        }
+
+        const double elapsedMs = (Profiler::GetTime() - start) / 1e6;
+        Profiler::EndFrame();
+        if (!measured) {
+            continue;
+        }
+        const SceneRendererStats& stats = renderer.GetStats();
+        const RenderQueueStats& queueStats = renderer.GetQueueStats();
+        frameMs.push_back(elapsedMs);
+        totalFrameMs += elapsedMs;
+        drawCalls.push_back(stats.DrawCalls);
+        triangles.push_back(stats.Triangles);
+        visibleObjects.push_back(stats.VisibleObjects);
+        stateBinds.push_back(queueStats.ProgramBinds + queueStats.TextureBinds + queueStats.VertexArrayBinds + queueStats.UniformBufferBinds);
+        indirectDraws.push_back(queueStats.IndirectDraws);
+        fenceWaitMs.push_back(stats.FenceWaitNs / 1e6);
+        lightIndices.push_back(stats.LightIndices);
+        uploadedBytes += stats.UploadedBytes;
+    }
+    Profiler::EndCapture();
+
+    result.Frames = options.Frames;
+    result.FrameMs = Summarize(std::move(frameMs));
+    result.DrawCalls = Summarize(std::move(drawCalls));
+    result.Triangles = Summarize(std::move(triangles));
+    result.VisibleObjects = Summarize(std::move(visibleObjects));
+    result.StateBinds = Summarize(std::move(stateBinds));
+    result.IndirectDraws = Summarize(std::move(indirectDraws));
+    result.FenceWaitMs = Summarize(std::move(fenceWaitMs));
+    result.LightIndices = Summarize(std::move(lightIndices));
+    result.UploadedBytes = options.Frames > 0 ? uploadedBytes / options.Frames : 0.0;
+    result.Zones = Profiler::GetCaptureZones();
+    std::cout << "PlumeBench: " << config.Name << " p50 " << result.FrameMs.P50 << " ms, p95 " << result.FrameMs.P95
+              << " ms, p99 " << result.FrameMs.P99 << " ms, " << result.DrawCalls.Mean << " draws, "
+              << result.Triangles.Mean << " triangles" << std::endl;
+
+    if (options.Pipelined) {
+        result.Pipelined = RunScenePipelined(benchScene, camera, context, renderer, options);
+        result.Pipelined.SerialThroughputFps = totalFrameMs > 0.0 ? options.Frames * 1000.0 / totalFrameMs : 0.0;
+        if (result.Pipelined.Measured) {
+            std::cout << "PlumeBench: " << config.Name << " pipelined " << result.Pipelined.ThroughputFps << " fps (serial "
+                      << result.Pipelined.SerialThroughputFps << " fps), latency p50 " << result.Pipelined.LatencyMs.P50 << " ms" << std::endl;
+        }
+    }
+    return result;
+}
+
+static ImportResult RunImport(const std::string& name, const std::string& path, uint32_t runs) {
+    ImportResult result;
+    result.Name = name;
+    result.Path = path;
+    std::vector<double> coldMs, warmMs;
+    // Kept until the next load, for the memory figures of the last one
+    std::unique_ptr<Model> lastModel;
+    auto timeLoad = [&](std::vector<double>& samples) {
+        const uint64_t start = Profiler::GetTime();
+        auto model = std::make_unique<Model>(path);
+        glFinish();
+        samples.push_back((Profiler::GetTime() - start) / 1e6);
+        result.Meshes = static_cast<uint32_t>(model->GetMeshes().size());
+        lastModel = std::move(model);
+    };
+    for (uint32_t run = 0; run < runs; run++) {
+        std::remove(MeshCache::GetCachePath(path).c_str());
+        timeLoad(coldMs);
+    }
+    // The last cold run cooked the cache again
+    for (uint32_t run = 0; run < runs; run++) {
+        timeLoad(warmMs);
+    }
+    WaitForTextures();
+    if (lastModel) {
+        result.Memory = MeasureMemory({ lastModel.get() });
+    }
+    result.ColdMs = Summarize(std::move(coldMs));
+    result.WarmMs = Summarize(std::move(warmMs));
+    std::cout << "PlumeBench: import " << name << " cold " << result.ColdMs.P50 << " ms, warm " << result.WarmMs.P50 << " ms" << std::endl;
+    return result;
+}
+
+// Loads the one-texture model `path` TEXTURE_SHARING_LOADS times: its texture
+// must be decoded once and shared by the others, then released with the last
+// copy. Needs the texture not to be alive yet.
+static bool CheckTextureSharing(const std::string& path) {
+    TextureCache::ResetCounters();
+    const TextureCacheStats before = TextureCache::GetStats();
+    {
+        std::vector<std::unique_ptr<Model>> models;
+        for (uint32_t i = 0; i < TEXTURE_SHARING_LOADS; i++) {
+            models.push_back(std::make_unique<Model>(path));
+        }
+        WaitForTextures();
+        const TextureCacheStats loaded = TextureCache::GetStats();
+        if (loaded.Misses != 1 || loaded.Hits != TEXTURE_SHARING_LOADS - 1 || loaded.ResidentTextures != before.ResidentTextures + 1) {
+            std::cerr << "PlumeBench: texture cache check failed, " << TEXTURE_SHARING_LOADS << " loads of " << path << " gave "
+                      << loaded.Misses << " misses, " << loaded.Hits << " hits, "
+                      << loaded.ResidentTextures - before.ResidentTextures << " new resident textures" << std::endl;
+            return false;
+        }
+    }
+    const TextureCacheStats released = TextureCache::GetStats();
+    if (released.ResidentTextures != before.ResidentTextures || released.ResidentBytes != before.ResidentBytes) {
+        std::cerr << "PlumeBench: texture cache check failed, the texture of " << path << " outlived its models" << std::endl;
+        return false;
+    }
+    std::cout << "PlumeBench: texture cache check passed (" << TEXTURE_SHARING_LOADS << " loads, 1 decode)" << std::endl;
+    return true;
+}
+
+// --- JSON report ---
+
+static void WriteJsonString(FILE* file, const std::string& text) {
+    std::fputc('"', file);
+    for (char c : text) {
+        if (c == '"' || c == '\\') {
+            std::fputc('\\', file);
+            std::fputc(c, file);
+        } else if (static_cast<unsigned char>(c) < 0x20) {
+            std::fprintf(file, "\\u%04x", static_cast<unsigned>(c));
+        } else {
+            std::fputc(c, file);
+        }
+    }
+    std::fputc('"', file);
+}
+
+static void WriteDistribution(FILE* file, const char* name, const Distribution& distribution) {
+    std::fprintf(file, "\"%s\": {\"mean\": %.4f, \"min\": %.4f, \"p50\": %.4f, \"p90\": %.4f, \"p95\": %.4f, \"p99\": %.4f, \"max\": %.4f}",
+                 name, distribution.Mean, distribution.Min, distribution.P50, distribution.P90, distribution.P95, distribution.P99, distribution.Max);
+}
+
+static void WriteMemoryUsage(FILE* file, const char* name, const MemoryUsage& usage) {
+    std::fprintf(file, "\"%s\": {\"cpu_bytes\": %llu, \"gpu_bytes\": %llu}", name,
+                 static_cast<unsigned long long>(usage.CpuBytes), static_cast<unsigned long long>(usage.GpuBytes));
+}
+
+// Textures are left out of scenes: their models share them through the cache
+static void WriteMemory(FILE* file, const MemoryResult& memory, bool withTextures) {
+    std::fprintf(file, "\"memory\": {");
+    WriteMemoryUsage(file, "geometry", memory.Geometry);
+    if (withTextures) {
+        std::fprintf(file, ", ");
+        WriteMemoryUsage(file, "textures", memory.Textures);
+    }
+    std::fprintf(file, ", ");
+    WriteMemoryUsage(file, "arenas", memory.Arenas);
+    std::fprintf(file, ", \"texture_cache_resident_bytes\": %llu}", static_cast<unsigned long long>(memory.TextureCacheBytes));
+}
+
+static bool WriteReport(const std::string& path, const HeadlessContext& context, const BenchOptions& options,
+                        const std::vector<SceneResult>& scenes, const std::vector<ImportResult>& imports) {
+    FILE* file = std::fopen(path.c_str(), "w");
+    if (!file) {
+        std::cerr << "PlumeBench: cannot write " << path << std::endl;
+        return false;
+    }
+    std::fprintf(file, "{\n  \"engine\": ");
+    WriteJsonString(file, PLUME_PRODUCT_NAME);
+    std::fprintf(file, ",\n  \"version\": ");
+    WriteJsonString(file, PLUME_FILE_VERSION_STR);
+    std::fprintf(file, ",\n  \"renderer\": ");
+    WriteJsonString(file, context.GetRendererName());
+    std::fprintf(file, ",\n  \"gl_version\": ");
+    WriteJsonString(file, context.GetVersionString());
+    std::fprintf(file, ",\n  \"persistent_mapping\": %s", DynamicBuffer::IsPersistentMappingSupported() ? "true" : "false");
+    std::fprintf(file, ",\n  \"indirect_draws\": %s", options.IndirectDraws ? "true" : "false");
+    std::fprintf(file, ",\n  \"threads\": %u,\n  \"width\": %u,\n  \"height\": %u,\n  \"frames\": %u,\n  \"warmup_frames\": %u,\n  \"scenes\": [",
+                 JobSystem::GetWorkerCount() + 1, options.Width, options.Height, options.Frames, options.WarmupFrames);
+
+    for (size_t i = 0; i < scenes.size(); i++) {
+        const SceneResult& scene = scenes[i];
+        std::fprintf(file, "%s\n    {\"name\": ", i > 0 ? "," : "");
+        WriteJsonString(file, scene.Config->Name);
+        std::fprintf(file, ", \"entities\": %u, \"lights\": %u, \"moving_fraction\": %.2f, \"skipped\": %s",
+                     scene.Config->EntityCount, scene.Config->LightCount, scene.Config->MovingFraction, scene.Skipped ? "true" : "false");
+        if (scene.Skipped) {
+            std::fprintf(file, "}");
+            continue;
+        }
+        std::fprintf(file, ",\n     ");
+        WriteDistribution(file, "frame_ms", scene.FrameMs);
+        std::fprintf(file, ",\n     ");
+        WriteDistribution(file, "draw_calls", scene.DrawCalls);
+        std::fprintf(file, ",\n     ");
+        WriteDistribution(file, "triangles", scene.Triangles);
+        std::fprintf(file, ",\n     ");
+        WriteDistribution(file, "visible_objects", scene.VisibleObjects);
+        std::fprintf(file, ",\n     ");
+        WriteDistribution(file, "state_binds", scene.StateBinds);
+        std::fprintf(file, ",\n     ");
+        WriteDistribution(file, "fence_wait_ms", scene.FenceWaitMs);
+        std::fprintf(file, ",\n     ");
+        WriteDistribution(file, "light_indices", scene.LightIndices);
+        if (options.IndirectDraws) {
+            std::fprintf(file, ",\n     ");
+            WriteDistribution(file, "indirect_draws", scene.IndirectDraws);
+        }
+        std::fprintf(file, ",\n     \"uploaded_bytes_per_frame\": %.0f,\n     ", scene.UploadedBytes);
+        WriteMemory(file, scene.Memory, false);
+        std::fprintf(file, ",\n     \"zones\": [");
+        // Per measured frame; jobs running in parallel add up
+        for (size_t z = 0; z < scene.Zones.size(); z++) {
+            const ProfilerZoneStats& zone = scene.Zones[z];
+            std::fprintf(file, "%s\n       {\"name\": ", z > 0 ? "," : "");
+            WriteJsonString(file, zone.Name);
+            std::fprintf(file, ", \"gpu\": %s, \"ms_per_frame\": %.4f, \"calls_per_frame\": %.2f, \"max_ms\": %.4f}",
+                         zone.Gpu ? "true" : "false", zone.TotalMs / scene.Frames, static_cast<double>(zone.Count) / scene.Frames, zone.MaxMs);
+        }
+        std::fprintf(file, "\n     ]");
+        if (scene.Pipelined.Measured) {
+            // Latency added: pipelined extraction-to-GPU-done against a serial frame, both p50
+            const PipelinedResult& pipelined = scene.Pipelined;
+            std::fprintf(file, ",\n     \"pipelined\": {\"throughput_fps\": %.2f, \"serial_throughput_fps\": %.2f, \"throughput_gain\": %.4f, \"added_latency_ms\": %.4f,\n      ",
+                         pipelined.ThroughputFps, pipelined.SerialThroughputFps,
+                         pipelined.SerialThroughputFps > 0.0 ? pipelined.ThroughputFps / pipelined.SerialThroughputFps : 0.0,
+                         pipelined.LatencyMs.P50 - scene.FrameMs.P50);
+            WriteDistribution(file, "latency_ms", pipelined.LatencyMs);
+            std::fprintf(file, ",\n      ");
+            WriteDistribution(file, "frame_interval_ms", pipelined.FrameIntervalMs);
+            std::fprintf(file, "}");
+        }
+        std::fprintf(file, "}");
+    }
+
+    std::fprintf(file, "\n  ],\n  \"imports\": [");
+    for (size_t i = 0; i < imports.size(); i++) {
+        const ImportResult& import = imports[i];
+        std::fprintf(file, "%s\n    {\"name\": ", i > 0 ? "," : "");
+        WriteJsonString(file, import.Name);
+        std::fprintf(file, ", \"path\": ");
+        WriteJsonString(file, import.Path);
+        std::fprintf(file, ", \"meshes\": %u,\n     ", import.Meshes);
+        WriteDistribution(file, "cold_ms", import.ColdMs);
+        std::fprintf(file, ",\n     ");
+        WriteDistribution(file, "warm_ms", import.WarmMs);
+        std::fprintf(file, ",\n     ");
+        WriteMemory(file, import.Memory, true);
+        std::fprintf(file, "}");
+    }
+    std::fprintf(file, "\n  ]\n}\n");
+    const bool written = std::fclose(file) == 0;
+    if (written) {
+        std::cout << "PlumeBench: report written to " << path << std::endl;
+    }
+    return written;
+}
+
+// --- Command line ---
+
+static void PrintUsage() {
+    std::cout << "Usage: PlumeBench [options]\n"
+                 "  --scene a,b,...   Scenes to run (default: all, see --list)\n"
+                 "  --list            Print the scene names and exit\n"
+                 "  --frames N        Measured frames per scene (default 300)\n"
+                 "  --warmup N        Frames rendered before measuring (default 30)\n"
+                 "  --size WxH        Offscreen framebuffer size (default 1280x720)\n"
+                 "  --imports N       Cold/warm import runs per model, 0 to skip (default 5)\n"
+                 "  --output PATH     JSON report (default plume_bench.json)\n"
+                 "  --assets DIR      Where the generated models are written (default bench_assets)\n"
+                 "  --model PATH      Backpack model of the backpacks_* scenes\n"
+                 "  --pipelined       Run each scene again with a separate render thread\n"
+                 "  --indirect        Submit with multi-draw indirect (needs OpenGL 4.3)\n";
+}
+
+static bool ParseOptions(int argc, char* argv[], BenchOptions& options, bool& outExit) {
+    outExit = false;
+    for (int i = 1; i < argc; i++) {
+        const std::string argument(argv[i]);
+        auto value = [&]() -> const char* { return i + 1 < argc ? argv[++i] : nullptr; };
+        const char* parameter = nullptr;
+        if (argument == "--help" || argument == "-h") {
+            PrintUsage();
+            outExit = true;
+        } else if (argument == "--list") {
+            for (const BenchSceneConfig& scene : GetBenchScenes()) {
+                std::cout << scene.Name << std::endl;
+            }
+            outExit = true;
+        } else if (argument == "--scene" && (parameter = value())) {
+            std::stringstream list(parameter);
+            for (std::string name; std::getline(list, name, ',');) {
+                options.Scenes.push_back(name);
+            }
+        } else if (argument == "--frames" && (parameter = value())) {
+            options.Frames = static_cast<uint32_t>(std::max(1, std::atoi(parameter)));
+        } else if (argument == "--warmup" && (parameter = value())) {
+            options.WarmupFrames = static_cast<uint32_t>(std::max(0, std::atoi(parameter)));
+        } else if (argument == "--imports" && (parameter = value())) {
+            options.ImportRuns = static_cast<uint32_t>(std::max(0, std::atoi(parameter)));
+        } else if (argument == "--size" && (parameter = value())) {
+            unsigned width = 0, height = 0;
+            if (std::sscanf(parameter, "%ux%u", &width, &height) != 2 || width == 0 || height == 0) {
+                std::cerr << "PlumeBench: invalid size " << parameter << std::endl;
+                return false;
+            }
+            options.Width = width;
+            options.Height = height;
+        } else if (argument == "--output" && (parameter = value())) {
+            options.OutputPath = parameter;
+        } else if (argument == "--assets" && (parameter = value())) {
+            options.AssetDirectory = parameter;
+        } else if (argument == "--model" && (parameter = value())) {
+            options.BackpackPath = parameter;
+        } else if (argument == "--pipelined") {
+            options.Pipelined = true;
+        } else if (argument == "--indirect") {
+            options.IndirectDraws = true;
+        } else {
+            std::cerr << "PlumeBench: unknown or incomplete option " << argument << std::endl;
+            PrintUsage();
+            return false;
+        }
+    }
+    for (const std::string& name : options.Scenes) {
+        const auto& scenes = GetBenchScenes();
+        if (std::none_of(scenes.begin(), scenes.end(), [&](const BenchSceneConfig& scene) { return name == scene.Name; })) {
+            std::cerr << "PlumeBench: unknown scene " << name << " (see --list)" << std::endl;
+            return false;
+        }
+    }
+    return true;
+}
+
+int main(int argc, char* argv[]) {
+    BenchOptions options;
+    bool exitNow = false;
+    if (!ParseOptions(argc, argv, options, exitNow)) {
+        return 2;
+    }
+    if (exitNow) {
+        return 0;
+    }
+
+    HeadlessContext context;
+    if (!context.Init(options.Width, options.Height)) {
+        return 1;
+    }
+    glEnable(GL_DEPTH_TEST);
+
+    Profiler::SetThreadName("Main");
+    GpuProfiler::Init();
+    JobSystem::Init();
+    TextureStreamer::Init();
+
+    std::error_code error;
+    std::filesystem::create_directories(options.AssetDirectory, error);
+    BenchAssets assets(options.AssetDirectory, options.BackpackPath);
+    bool succeeded = assets.Generate() && CheckTextureSharing(assets.GetModelPath(BenchModel::Sphere));
+
+    std::vector<SceneResult> sceneResults;
+    std::vector<ImportResult> importResults;
+    if (succeeded) {
+        SceneRenderer renderer;
+        renderer.SetIndirectDraws(options.IndirectDraws);
+        // Report what actually ran
+        options.IndirectDraws = renderer.IsIndirectDrawing();
+        for (const BenchSceneConfig& config : GetBenchScenes()) {
+            const bool selected = options.Scenes.empty()
+                || std::find(options.Scenes.begin(), options.Scenes.end(), config.Name) != options.Scenes.end();
+            if (selected) {
+                sceneResults.push_back(RunScene(config, assets, context, renderer, options));
+            }
+        }
+        if (options.ImportRuns > 0) {
+            importResults.push_back(RunImport("many_parts", assets.GetModelPath(BenchModel::ManyParts), options.ImportRuns));
+            importResults.push_back(RunImport("dense_sphere", assets.GetModelPath(BenchModel::DenseSphere), options.ImportRuns));
+            if (std::filesystem::exists(options.BackpackPath)) {
+                importResults.push_back(RunImport("backpack", options.BackpackPath, options.ImportRuns));
+            }
+        }
+        succeeded = WriteReport(options.OutputPath, context, options, sceneResults, importResults);
+    }
+
+    // Same order as PlumeApplication::Shutdown: GL objects go before the context
+    TextureStreamer::Shutdown();
+    JobSystem::Shutdown();
+    Mesh::ReleaseArenas();
+    GpuProfiler::Shutdown();
+    context.Shutdown();
+    return succeeded ? 0 : 1;
+}
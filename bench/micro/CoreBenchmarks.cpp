@@ -0,0 +1,73 @@
+// bench/micro/CoreBenchmarks.cpp
+// Input state lookups and job system overheads
+#include "MicroBench.h"
+#include "Core/Input.h"
+#include "Core/JobSystem.h"
+#include <benchmark/benchmark.h>
+#include <atomic>
+#include <vector>
+
+// range(0) keys held down; each iteration asks for every key the camera
+// reads in a frame, held or not
+static void BM_InputIsKeyPressed(benchmark::State& state) {
+    const int heldCount = static_cast<int>(state.range(0));
+    Input input;
+    for (int i = 0; i < heldCount; i++) {
+        SDL_Event event{};
+        event.type = SDL_KEYDOWN;
+        event.key.keysym.scancode = static_cast<SDL_Scancode>(SDL_SCANCODE_A + i % (SDL_NUM_SCANCODES - SDL_SCANCODE_A));
+        input.Update(event);
+    }
+    const SDL_Scancode queries[] = {
+        SDL_SCANCODE_W, SDL_SCANCODE_A, SDL_SCANCODE_S, SDL_SCANCODE_D, SDL_SCANCODE_Q, SDL_SCANCODE_E,
+        SDL_SCANCODE_UP, SDL_SCANCODE_DOWN, SDL_SCANCODE_LEFT, SDL_SCANCODE_RIGHT,
+        SDL_SCANCODE_LSHIFT, SDL_SCANCODE_LCTRL, SDL_SCANCODE_F1, SDL_SCANCODE_F2, SDL_SCANCODE_F3
+    };
+    for (auto _ : state) {
+        int pressed = 0;
+        for (SDL_Scancode key : queries) {
+            pressed += input.IsKeyPressed(key) ? 1 : 0;
+        }
+        benchmark::DoNotOptimize(pressed);
+    }
+    state.SetItemsProcessed(state.iterations() * (sizeof(queries) / sizeof(queries[0])));
+}
+BENCHMARK(BM_InputIsKeyPressed)->RangeMultiplier(4)->Range(1, 256);
+
+// Scheduling cost: range(0) trivial items split in chunks of 64, on
+// range(1) threads
+static void BM_JobSystemParallelFor(benchmark::State& state) {
+    const uint32_t count = static_cast<uint32_t>(state.range(0));
+    UseBenchThreads(static_cast<unsigned int>(state.range(1)));
+    std::vector<float> values(count, 1.0f);
+    for (auto _ : state) {
+        JobSystem::ParallelFor(count, 64, [&](uint32_t begin, uint32_t end) {
+            for (uint32_t i = begin; i < end; i++) {
+                values[i] = values[i] * 0.5f + 1.0f;
+            }
+        });
+        benchmark::DoNotOptimize(values.data());
+    }
+    state.SetItemsProcessed(state.iterations() * count);
+    state.counters["threads"] = static_cast<double>(state.range(1));
+}
+BENCHMARK(BM_JobSystemParallelFor)
+    ->Apply([](benchmark::internal::Benchmark* benchmark) { AddThreadScaling(benchmark, { { 1 << 14 }, { 1 << 20 } }); })
+    ->UseRealTime();
+
+// range(0) empty jobs on one counter, then Wait
+static void BM_JobSystemRunWait(benchmark::State& state) {
+    const int count = static_cast<int>(state.range(0));
+    UseBenchThreads(GetMaxBenchThreads());
+    std::atomic<int> executed{ 0 };
+    for (auto _ : state) {
+        JobCounter counter;
+        for (int i = 0; i < count; i++) {
+            JobSystem::Run([&]() { executed.fetch_add(1, std::memory_order_relaxed); }, &counter);
+        }
+        JobSystem::Wait(counter);
+    }
+    state.SetItemsProcessed(state.iterations() * count);
+    benchmark::DoNotOptimize(executed.load());
+}
+BENCHMARK(BM_JobSystemRunWait)->RangeMultiplier(8)->Range(8, 4096)->UseRealTime();
@@ -0,0 +1,68 @@
+// bench/micro/ImportBenchmarks.cpp
+// Model import pipeline on synthetic meshes: Assimp -> Vertex conversion
+// (the whole ModelImporter::ConvertMesh) and each of its stages alone
+#include "Renderer/Model/ModelImporter.h"
+#include "Renderer/Model/MeshOptimizer.h"
+#include "Renderer/Model/MeshSimplifier.h"
+#include "Renderer/Model/VertexQuantizer.h"
+#include "TestMeshes.h"
+#include <benchmark/benchmark.h>
+#include <memory>
+#include <vector>
+
+static void BM_ConvertMesh(benchmark::State& state) {
+    const uint32_t triangleCount = static_cast<uint32_t>(state.range(0));
+    const std::unique_ptr<aiMesh> mesh = MakeAssimpMesh(Unweld(MakeGrid(triangleCount)));
+    aiScene scene; // No material: the texture lookup is skipped
+    for (auto _ : state) {
+        MeshData data;
+        ModelImporter::ConvertMesh(mesh.get(), &scene, data);
+        benchmark::DoNotOptimize(data.Indices.data());
+    }
+    state.SetItemsProcessed(state.iterations() * mesh->mNumFaces);
+}
+BENCHMARK(BM_ConvertMesh)->RangeMultiplier(10)->Range(1000, 100000)->Unit(benchmark::kMillisecond);
+
+static void BM_MeshOptimizer(benchmark::State& state) {
+    const TestMesh corners = Unweld(MakeGrid(static_cast<uint32_t>(state.range(0))));
+    for (auto _ : state) {
+        state.PauseTiming();
+        std::vector<Vertex> vertices = corners.Vertices;
+        std::vector<uint32_t> indices = corners.Indices;
+        state.ResumeTiming();
+        MeshOptimizationReport report = MeshOptimizer::Optimize(vertices, indices);
+        benchmark::DoNotOptimize(report);
+    }
+    state.SetItemsProcessed(state.iterations() * corners.Indices.size() / 3);
+}
+BENCHMARK(BM_MeshOptimizer)->RangeMultiplier(10)->Range(1000, 100000)->Unit(benchmark::kMillisecond);
+
+// One LOD step: half the triangles, within the importer's error bound
+static void BM_MeshSimplifier(benchmark::State& state) {
+    const TestMesh grid = MakeGrid(static_cast<uint32_t>(state.range(0)));
+    const size_t target = grid.Indices.size() / 6 * 3;
+    size_t resultCount = 0;
+    for (auto _ : state) {
+        std::vector<uint32_t> simplified = MeshSimplifier::Simplify(grid.Vertices.data(), static_cast<uint32_t>(grid.Vertices.size()),
+                                                                    grid.Indices.data(), grid.Indices.size(), target, 0.02f);
+        resultCount = simplified.size();
+        benchmark::DoNotOptimize(simplified.data());
+    }
+    state.SetItemsProcessed(state.iterations() * grid.Indices.size() / 3);
+    state.counters["reduction"] = static_cast<double>(resultCount) / grid.Indices.size();
+}
+BENCHMARK(BM_MeshSimplifier)->RangeMultiplier(10)->Range(1000, 100000)->Unit(benchmark::kMillisecond);
+
+static void BM_VertexQuantizerPack(benchmark::State& state) {
+    const TestMesh grid = MakeGrid(static_cast<uint32_t>(state.range(0)) * 2);
+    const uint32_t vertexCount = static_cast<uint32_t>(grid.Vertices.size());
+    std::vector<PackedVertex> packed(vertexCount);
+    for (auto _ : state) {
+        const VertexQuantization quantization = VertexQuantizer::ComputeQuantization(grid.Vertices.data(), vertexCount);
+        VertexQuantizer::Pack(grid.Vertices.data(), vertexCount, quantization, packed.data());
+        benchmark::DoNotOptimize(packed.data());
+    }
+    state.SetItemsProcessed(state.iterations() * vertexCount);
+    state.SetBytesProcessed(state.iterations() * vertexCount * sizeof(Vertex));
+}
+BENCHMARK(BM_VertexQuantizerPack)->RangeMultiplier(10)->Range(1000, 1000000)->Unit(benchmark::kMicrosecond);
@@ -0,0 +1,19 @@
+// bench/micro/MicroBench.h
+// Helpers shared by the microbenchmarks that run on the job system
+#pragma once
+
+#include <benchmark/benchmark.h>
+#include <cstdint>
+#include <vector>
+
+// Scaling benchmarks go from 1 thread (the calling one alone: every job runs
+// inline) to the hardware thread count, the job system's default
+unsigned int GetMaxBenchThreads();
+
+// Restarts the job system with `threads` threads, the calling one included,
+// unless it already has that many. Call before the timed loop.
+void UseBenchThreads(unsigned int threads);
+
+// Registers each argument set once per thread count, 1..GetMaxBenchThreads(),
+// the count appended as the last argument (for Benchmark::Apply)
+void AddThreadScaling(benchmark::internal::Benchmark* benchmark, const std::vector<std::vector<int64_t>>& argumentSets);
@@ -0,0 +1,52 @@
+// bench/micro/MicroBenchMain.cpp
+// CPU microbenchmarks of the engine hot paths (Google Benchmark). No GL
+// context exists here: only code that never touches GL can be measured, so
+// the suite runs on any CI machine. Every benchmark takes its data size as
+// argument, and the job system ones their thread count too (see
+// MicroBench.h); pick a subset with --benchmark_filter.
+#include "MicroBench.h"
+#include "Core/JobSystem.h"
+#include "Core/Profiler.h"
+#include <benchmark/benchmark.h>
+#include <algorithm>
+#include <thread>
+
+unsigned int GetMaxBenchThreads() {
+    return std::max(1u, std::thread::hardware_concurrency());
+}
+
+void UseBenchThreads(unsigned int threads) {
+    const unsigned int current = JobSystem::IsInitialized() ? JobSystem::GetWorkerCount() + 1 : 1;
+    if (threads == current) {
+        return;
+    }
+    JobSystem::Shutdown();
+    // One thread: no worker at all, ParallelFor runs the whole range inline
+    if (threads > 1) {
+        JobSystem::Init(threads - 1);
+    }
+}
+
+void AddThreadScaling(benchmark::internal::Benchmark* benchmark, const std::vector<std::vector<int64_t>>& argumentSets) {
+    for (const std::vector<int64_t>& arguments : argumentSets) {
+        for (unsigned int threads = 1; threads <= GetMaxBenchThreads(); threads++) {
+            std::vector<int64_t> scaled = arguments;
+            scaled.push_back(threads);
+            benchmark->Args(scaled);
+        }
+    }
+}
+
+int main(int argc, char** argv) {
+    benchmark::Initialize(&argc, argv);
+    if (benchmark::ReportUnrecognizedArguments(argc, argv)) {
+        return 1;
+    }
+    // Nothing drains the profiler rings here: keep the markers out of the timings
+    Profiler::SetEnabled(false);
+    JobSystem::Init();
+    benchmark::RunSpecifiedBenchmarks();
+    JobSystem::Shutdown();
+    benchmark::Shutdown();
+    return 0;
+}
@@ -0,0 +1,207 @@
+// bench/micro/RendererBenchmarks.cpp
+// CPU side of the renderer: vertex layouts, the geometry arena allocator,
+// command recording and light cluster assignment
+#include "MicroBench.h"
+#include "Core/JobSystem.h"
+#include "Renderer/Buffer.h"
+#include "Renderer/CommandList.h"
+#include "Renderer/LightClusters.h"
+#include "Renderer/OffsetAllocator.h"
+#include "Renderer/RenderQueue.h"
+#include "Renderer/Model/Mesh.h"
+#include <benchmark/benchmark.h>
+#include <glm/gtc/matrix_transform.hpp>
+#include <memory>
+#include <random>
+#include <vector>
+
+// The three layouts the engine builds: float vertices, packed vertices and instances
+static void BM_BufferLayoutConstruction(benchmark::State& state) {
+    const size_t count = static_cast<size_t>(state.range(0));
+    for (auto _ : state) {
+        uint32_t strides = 0;
+        for (size_t i = 0; i < count; i++) {
+            BufferLayout vertexLayout({
+                { ShaderDataType::Float3, "a_Position" },
+                { ShaderDataType::Float3, "a_Normal" },
+                { ShaderDataType::Float2, "a_TexCoords" }
+            });
+            BufferLayout packedLayout({
+                { ShaderDataType::UShort4, "a_Position", true },
+                { ShaderDataType::Short2,  "a_Normal" },
+                { ShaderDataType::UShort2, "a_TexCoords", true }
+            });
+            BufferLayout instanceLayout({
+                { ShaderDataType::Mat4, "a_Model" },
+                { ShaderDataType::Mat3, "a_NormalMatrix" }
+            }, 1);
+            strides += vertexLayout.GetStride() + packedLayout.GetStride() + instanceLayout.GetStride();
+        }
+        benchmark::DoNotOptimize(strides);
+    }
+    state.SetItemsProcessed(state.iterations() * count * 3);
+}
+BENCHMARK(BM_BufferLayoutConstruction)->RangeMultiplier(8)->Range(1, 4096);
+
+// Mesh-like sizes: mostly small, a few large
+static uint32_t RandomBlockSize(std::mt19937& random) {
+    std::uniform_int_distribution<uint32_t> size(16, 4096);
+    std::uniform_int_distribution<uint32_t> large(0, 31);
+    return large(random) == 0 ? size(random) * 16 : size(random);
+}
+
+// Steady state with range(0) live blocks: every iteration frees one at
+// random and allocates a new one
+static void BM_OffsetAllocatorChurn(benchmark::State& state) {
+    const size_t liveCount = static_cast<size_t>(state.range(0));
+    std::mt19937 random(11);
+    OffsetAllocator allocator(static_cast<uint32_t>(liveCount * 8192 + (1u << 20)));
+    std::vector<OffsetAllocation> live;
+    live.reserve(liveCount);
+    for (size_t i = 0; i < liveCount; i++) {
+        live.push_back(allocator.Allocate(RandomBlockSize(random)));
+    }
+    std::uniform_int_distribution<size_t> pick(0, liveCount - 1);
+    uint64_t failures = 0;
+    for (auto _ : state) {
+        OffsetAllocation& victim = live[pick(random)];
+        allocator.Free(victim);
+        victim = allocator.Allocate(RandomBlockSize(random));
+        failures += victim.IsValid() ? 0 : 1;
+    }
+    state.SetItemsProcessed(state.iterations() * 2);
+    const OffsetAllocatorStats stats = allocator.GetStats();
+    state.counters["fragmentation"] = stats.GetFragmentation();
+    state.counters["free_regions"] = stats.FreeRegions;
+    state.counters["failures"] = static_cast<double>(failures);
+}
+BENCHMARK(BM_OffsetAllocatorChurn)->RangeMultiplier(10)->Range(100, 100000);
+
+// Defragment after range(0) blocks were allocated and every other one freed,
+// the worst case for fragmentation
+static void BM_OffsetAllocatorDefragment(benchmark::State& state) {
+    const size_t count = static_cast<size_t>(state.range(0));
+    std::mt19937 random(5);
+    std::vector<uint32_t> sizes(count);
+    for (uint32_t& size : sizes) {
+        size = RandomBlockSize(random);
+    }
+    float fragmentation = 0.0f;
+    size_t relocations = 0;
+    for (auto _ : state) {
+        state.PauseTiming();
+        OffsetAllocator allocator(static_cast<uint32_t>(count * 8192));
+        std::vector<OffsetAllocation> blocks(count);
+        for (size_t i = 0; i < count; i++) {
+            blocks[i] = allocator.Allocate(sizes[i]);
+        }
+        for (size_t i = 0; i < count; i += 2) {
+            allocator.Free(blocks[i]);
+        }
+        fragmentation = allocator.GetStats().GetFragmentation();
+        state.ResumeTiming();
+
+        relocations = allocator.Defragment().size();
+        benchmark::DoNotOptimize(relocations);
+    }
+    state.SetItemsProcessed(state.iterations() * count / 2);
+    state.counters["fragmentation_before"] = fragmentation;
+    state.counters["relocations"] = static_cast<double>(relocations);
+}
+BENCHMARK(BM_OffsetAllocatorDefragment)->RangeMultiplier(10)->Range(1000, 100000)->Unit(benchmark::kMicrosecond);
+
+// --- Command recording ---
+
+// Records draw `i` the way SceneRenderer does for a single entity. Nothing is
+// replayed, so the resources are never dereferenced: no GL context needed.
+static void RecordDraw(CommandList& commands, uint32_t i, const VertexQuantization& quantization) {
+    const float depth = static_cast<float>(i % 977);
+    commands.BeginItem(RenderQueue::MakeSortKey(RenderPass::Opaque, 3, 1 + i % 64, 1 + i % 2, depth));
+    commands.BindProgram(nullptr);
+    commands.BindTexture(nullptr, 0);
+    commands.BindGeometry(nullptr);
+    commands.SetDequantize(&quantization);
+    commands.SetObjectConstants(i);
+    commands.DrawIndexed(3000, i * 3000, static_cast<int32_t>(i * 500));
+}
+
+// range(0) draws recorded on range(1) threads, each into its own list, as
+// SceneRenderer does. One thread records everything inline.
+static void BM_CommandRecording(benchmark::State& state) {
+    const uint32_t count = static_cast<uint32_t>(state.range(0));
+    UseBenchThreads(static_cast<unsigned int>(state.range(1)));
+    const VertexQuantization quantization;
+    std::vector<CommandList> lists(JobSystem::GetThreadCount());
+    for (auto _ : state) {
+        for (CommandList& list : lists) {
+            list.Reset();
+        }
+        JobSystem::ParallelFor(count, 256, [&](uint32_t begin, uint32_t end) {
+            CommandList& list = lists[JobSystem::GetThreadIndex()];
+            for (uint32_t i = begin; i < end; i++) {
+                RecordDraw(list, i, quantization);
+            }
+        });
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * count);
+    state.counters["threads"] = static_cast<double>(state.range(1));
+}
+BENCHMARK(BM_CommandRecording)
+    ->Apply([](benchmark::internal::Benchmark* benchmark) { AddThreadScaling(benchmark, { { 10000 }, { 100000 } }); })
+    ->UseRealTime()->Unit(benchmark::kMicrosecond);
+
+// Serial part left on the GL thread: merge the per-thread lists and sort
+static void BM_RenderQueueMergeSort(benchmark::State& state) {
+    const uint32_t count = static_cast<uint32_t>(state.range(0));
+    const VertexQuantization quantization;
+    std::vector<CommandList> lists(8);
+    for (uint32_t i = 0; i < count; i++) {
+        RecordDraw(lists[i % lists.size()], i, quantization);
+    }
+    RenderQueue queue;
+    for (auto _ : state) {
+        queue.Clear();
+        for (const CommandList& list : lists) {
+            queue.Submit(list);
+        }
+        queue.Sort();
+        benchmark::DoNotOptimize(queue.GetItemCount());
+    }
+    state.SetItemsProcessed(state.iterations() * count);
+}
+BENCHMARK(BM_RenderQueueMergeSort)->RangeMultiplier(10)->Range(1000, 100000)->Unit(benchmark::kMicrosecond);
+
+// range(0) point lights spread through the view frustum, sorted into the
+// cluster grid on range(1) threads
+static void BM_LightAssignment(benchmark::State& state) {
+    const uint32_t count = static_cast<uint32_t>(state.range(0));
+    UseBenchThreads(static_cast<unsigned int>(state.range(1)));
+    std::mt19937 random(17);
+    std::uniform_real_distribution<float> unit(0.0f, 1.0f);
+    std::vector<RenderLight> lights(count);
+    for (RenderLight& light : lights) {
+        // Uniform in depth, inside the 60 degree field of view
+        const float depth = 1.0f + unit(random) * 150.0f;
+        const float x = (unit(random) * 2.0f - 1.0f) * depth * 0.577f * 16.0f / 9.0f;
+        const float y = (unit(random) * 2.0f - 1.0f) * depth * 0.577f;
+        light.Position = glm::vec3(x, y, -depth);
+        light.Color = glm::vec3(1.0f);
+        light.Range = 2.0f + unit(random) * 6.0f;
+    }
+    // Too large for the stack: the cluster boxes are stored inline
+    auto clusters = std::make_unique<LightClusters>();
+    clusters->SetProjection(glm::perspective(glm::radians(60.0f), 16.0f / 9.0f, 0.1f, 200.0f));
+    const glm::mat4 view(1.0f);
+    for (auto _ : state) {
+        clusters->Assign(lights.data(), count, view);
+        benchmark::DoNotOptimize(clusters->GetLightIndices().data());
+    }
+    state.SetItemsProcessed(state.iterations() * count);
+    state.counters["threads"] = static_cast<double>(state.range(1));
+    state.counters["light_indices"] = clusters->GetStats().LightIndices;
+    state.counters["max_per_cluster"] = clusters->GetStats().MaxLightsPerCluster;
+}
+BENCHMARK(BM_LightAssignment)
+    ->Apply([](benchmark::internal::Benchmark* benchmark) { AddThreadScaling(benchmark, { { 1000 }, { 10000 } }); })
+    ->UseRealTime()->Unit(benchmark::kMicrosecond);
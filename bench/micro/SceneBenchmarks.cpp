@@ -0,0 +1,295 @@
+// bench/micro/SceneBenchmarks.cpp
+// Transforms, registry iteration, transform propagation, BVH and culling
+#include "MicroBench.h"
+#include "Renderer/Frustum.h"
+#include "Scene/Scene.h"
+#include "Scene/Entity.h"
+#include "Scene/Components.h"
+#include "Scene/DynamicAABBTree.h"
+#include <benchmark/benchmark.h>
+#include <glm/gtc/matrix_transform.hpp>
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <vector>
+
+// Positions spread over a square of `extent` units, fixed seed
+static std::vector<AABB> MakeBoxes(size_t count, float extent) {
+    std::mt19937 random(42);
+    std::uniform_real_distribution<float> position(-extent, extent);
+    std::uniform_real_distribution<float> size(0.5f, 2.0f);
+    std::vector<AABB> boxes(count);
+    for (AABB& box : boxes) {
+        const glm::vec3 center(position(random), position(random) * 0.1f, position(random));
+        const glm::vec3 halfSize(size(random));
+        box.Min = center - halfSize;
+        box.Max = center + halfSize;
+    }
+    return boxes;
+}
+
+// Camera at the edge of the boxes, looking across them: roughly a quarter visible
+static Frustum MakeFrustum(float extent) {
+    const glm::mat4 projection = glm::perspective(glm::radians(60.0f), 16.0f / 9.0f, 0.1f, extent * 2.0f);
+    const glm::mat4 view = glm::lookAt(glm::vec3(0.0f, 10.0f, extent), glm::vec3(0.0f), glm::vec3(0.0f, 1.0f, 0.0f));
+    return Frustum(projection * view);
+}
+
+static float ExtentFor(size_t count) {
+    return std::sqrt(static_cast<float>(count)) * 2.0f;
+}
+
+// --- Transforms ---
+
+static void BM_TransformGetTransform(benchmark::State& state) {
+    const size_t count = static_cast<size_t>(state.range(0));
+    std::mt19937 random(7);
+    std::uniform_real_distribution<float> value(-10.0f, 10.0f);
+    std::vector<TransformComponent> transforms(count);
+    for (TransformComponent& transform : transforms) {
+        transform.Translation = glm::vec3(value(random), value(random), value(random));
+        transform.Rotation = glm::vec3(value(random), value(random), value(random)) * 0.1f;
+        transform.Scale = glm::vec3(1.0f + value(random) * 0.05f);
+    }
+    std::vector<glm::mat4> matrices(count);
+    for (auto _ : state) {
+        for (size_t i = 0; i < count; i++) {
+            matrices[i] = transforms[i].GetTransform();
+        }
+        benchmark::DoNotOptimize(matrices.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * count);
+}
+BENCHMARK(BM_TransformGetTransform)->RangeMultiplier(16)->Range(256, 1 << 20);
+
+// Every third entity has no model: the view has to skip it
+static void BM_EnttViewTransformModel(benchmark::State& state) {
+    const size_t count = static_cast<size_t>(state.range(0));
+    entt::registry registry;
+    for (size_t i = 0; i < count; i++) {
+        const entt::entity entity = registry.create();
+        registry.emplace<TransformComponent>(entity).Translation = glm::vec3(static_cast<float>(i));
+        if (i % 3 != 0) {
+            registry.emplace<ModelComponent>(entity);
+        }
+    }
+    for (auto _ : state) {
+        glm::vec3 sum(0.0f);
+        auto view = registry.view<TransformComponent, ModelComponent>();
+        for (auto entity : view) {
+            sum += view.get<TransformComponent>(entity).Translation;
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * count);
+}
+BENCHMARK(BM_EnttViewTransformModel)->RangeMultiplier(16)->Range(1024, 1 << 20);
+
+// Scene::OnUpdate with range(1) percent of range(0) entities patched per
+// frame, on range(2) threads. Entities hang in small hierarchies (one
+// parent, three children).
+static void BM_SceneTransformUpdate(benchmark::State& state) {
+    const size_t count = static_cast<size_t>(state.range(0));
+    const size_t movingStep = std::max<size_t>(1, 100 / static_cast<size_t>(state.range(1)));
+    UseBenchThreads(static_cast<unsigned int>(state.range(2)));
+    Scene scene;
+    std::vector<Entity> entities;
+    entities.reserve(count);
+    for (size_t i = 0; i < count; i++) {
+        Entity entity = scene.CreateEntity();
+        entity.PatchComponent<TransformComponent>([&](TransformComponent& transform) {
+            transform.Translation = glm::vec3(static_cast<float>(i % 1024), 0.0f, static_cast<float>(i / 1024));
+        });
+        if (i % 4 != 0) {
+            entity.SetParent(entities[i - i % 4]);
+        }
+        entities.push_back(entity);
+    }
+    scene.OnUpdate(0.0f);
+
+    float time = 0.0f;
+    for (auto _ : state) {
+        time += 1.0f / 60.0f;
+        for (size_t i = 0; i < count; i += movingStep) {
+            entities[i].PatchComponent<TransformComponent>([&](TransformComponent& transform) { transform.Rotation.y = time; });
+        }
+        scene.OnUpdate(1.0f / 60.0f);
+    }
+    state.SetItemsProcessed(state.iterations() * (count / movingStep));
+    state.counters["moving"] = static_cast<double>(count / movingStep);
+}
+BENCHMARK(BM_SceneTransformUpdate)
+    ->Apply([](benchmark::internal::Benchmark* benchmark) { AddThreadScaling(benchmark, { { 10000, 1 }, { 1000000, 1 }, { 1000000, 10 } }); })
+    ->UseRealTime()->Unit(benchmark::kMillisecond);
+
+// --- Spatial index ---
+
+static void BM_BvhBuild(benchmark::State& state) {
+    const size_t count = static_cast<size_t>(state.range(0));
+    const std::vector<AABB> boxes = MakeBoxes(count, ExtentFor(count));
+    for (auto _ : state) {
+        DynamicAABBTree tree;
+        for (size_t i = 0; i < count; i++) {
+            tree.CreateProxy(boxes[i], static_cast<uint32_t>(i));
+        }
+        benchmark::DoNotOptimize(tree.GetHeight());
+    }
+    state.SetItemsProcessed(state.iterations() * count);
+}
+BENCHMARK(BM_BvhBuild)->Arg(10000)->Arg(100000)->Arg(1000000)->Unit(benchmark::kMillisecond);
+
+// 1% of the proxies move per iteration; range(1) = 1 jumps them across the
+// world (reinsertion), 0 keeps them inside their fat box
+static void BM_BvhMoveProxies(benchmark::State& state) {
+    const size_t count = static_cast<size_t>(state.range(0));
+    const bool teleport = state.range(1) != 0;
+    const float extent = ExtentFor(count);
+    std::vector<AABB> boxes = MakeBoxes(count, extent);
+    DynamicAABBTree tree;
+    std::vector<int32_t> proxies(count);
+    for (size_t i = 0; i < count; i++) {
+        proxies[i] = tree.CreateProxy(boxes[i], static_cast<uint32_t>(i));
+    }
+    std::mt19937 random(3);
+    std::uniform_real_distribution<float> jump(-extent, extent);
+    std::uniform_real_distribution<float> nudge(-0.01f, 0.01f);
+    const size_t moving = std::max<size_t>(1, count / 100);
+    size_t next = 0;
+    for (auto _ : state) {
+        for (size_t m = 0; m < moving; m++) {
+            const size_t i = next;
+            next = (next + 101) % count;
+            const glm::vec3 offset = teleport ? glm::vec3(jump(random), 0.0f, jump(random)) - boxes[i].GetCenter()
+                                              : glm::vec3(nudge(random), 0.0f, nudge(random));
+            boxes[i].Min += offset;
+            boxes[i].Max += offset;
+            tree.MoveProxy(proxies[i], boxes[i]);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * moving);
+}
+BENCHMARK(BM_BvhMoveProxies)
+    ->Args({ 10000, 0 })->Args({ 100000, 0 })->Args({ 1000000, 0 })
+    ->Args({ 10000, 1 })->Args({ 100000, 1 })->Args({ 1000000, 1 });
+
+static void BM_BvhQueryFrustum(benchmark::State& state) {
+    const size_t count = static_cast<size_t>(state.range(0));
+    const float extent = ExtentFor(count);
+    const std::vector<AABB> boxes = MakeBoxes(count, extent);
+    DynamicAABBTree tree;
+    for (size_t i = 0; i < count; i++) {
+        tree.CreateProxy(boxes[i], static_cast<uint32_t>(i));
+    }
+    const Frustum frustum = MakeFrustum(extent);
+    size_t visible = 0;
+    for (auto _ : state) {
+        visible = 0;
+        tree.QueryFrustum(frustum, [&](int32_t) { visible++; });
+        benchmark::DoNotOptimize(visible);
+    }
+    state.SetItemsProcessed(state.iterations() * count);
+    state.counters["visible"] = static_cast<double>(visible);
+}
+BENCHMARK(BM_BvhQueryFrustum)->Arg(10000)->Arg(100000)->Arg(1000000)->Unit(benchmark::kMicrosecond);
+
+// Queries cycled through by the overlap and ray benchmarks
+static constexpr size_t BVH_QUERY_COUNT = 256;
+
+// Boxes of 8 units at random places: a few dozen proxies each, as a trigger
+// volume or an explosion radius would gather
+static void BM_BvhQueryOverlap(benchmark::State& state) {
+    const size_t count = static_cast<size_t>(state.range(0));
+    const float extent = ExtentFor(count);
+    const std::vector<AABB> boxes = MakeBoxes(count, extent);
+    DynamicAABBTree tree;
+    for (size_t i = 0; i < count; i++) {
+        tree.CreateProxy(boxes[i], static_cast<uint32_t>(i));
+    }
+    std::mt19937 random(5);
+    std::uniform_real_distribution<float> position(-extent, extent);
+    std::vector<AABB> queries(BVH_QUERY_COUNT);
+    for (AABB& query : queries) {
+        const glm::vec3 center(position(random), 0.0f, position(random));
+        query.Min = center - glm::vec3(4.0f);
+        query.Max = center + glm::vec3(4.0f);
+    }
+    size_t query = 0;
+    size_t found = 0;
+    for (auto _ : state) {
+        tree.Query(queries[query], [&](int32_t) {
+            found++;
+            return true;
+        });
+        query = (query + 1) % BVH_QUERY_COUNT;
+    }
+    benchmark::DoNotOptimize(found);
+    state.SetItemsProcessed(state.iterations());
+    state.counters["found"] = static_cast<double>(found) / static_cast<double>(state.iterations());
+}
+BENCHMARK(BM_BvhQueryOverlap)->Arg(10000)->Arg(100000)->Arg(1000000);
+
+// Closest hit along rays skimming the boxes from a random point to another,
+// clipped as hits are found (Scene::RayCast without the registry lookups)
+static void BM_BvhRayCast(benchmark::State& state) {
+    const size_t count = static_cast<size_t>(state.range(0));
+    const float extent = ExtentFor(count);
+    const std::vector<AABB> boxes = MakeBoxes(count, extent);
+    DynamicAABBTree tree;
+    for (size_t i = 0; i < count; i++) {
+        tree.CreateProxy(boxes[i], static_cast<uint32_t>(i));
+    }
+    std::mt19937 random(6);
+    std::uniform_real_distribution<float> position(-extent, extent);
+    std::vector<glm::vec3> origins(BVH_QUERY_COUNT), directions(BVH_QUERY_COUNT);
+    for (size_t i = 0; i < BVH_QUERY_COUNT; i++) {
+        origins[i] = glm::vec3(position(random), 1.0f, position(random));
+        directions[i] = glm::vec3(position(random), 0.0f, position(random)) - origins[i];
+    }
+    size_t query = 0;
+    size_t hits = 0;
+    for (auto _ : state) {
+        const glm::vec3& origin = origins[query];
+        const glm::vec3 inverseDirection = 1.0f / directions[query];
+        bool hit = false;
+        tree.RayCast(origin, directions[query], 1.0f, [&](int32_t proxyId, float currentMax) {
+            const AABB& box = boxes[tree.GetUserData(proxyId)];
+            const glm::vec3 t1 = (box.Min - origin) * inverseDirection;
+            const glm::vec3 t2 = (box.Max - origin) * inverseDirection;
+            const glm::vec3 tMin = glm::min(t1, t2);
+            const glm::vec3 tMax = glm::max(t1, t2);
+            const float enter = glm::max(glm::max(tMin.x, tMin.y), glm::max(tMin.z, 0.0f));
+            const float exit = glm::min(glm::min(tMax.x, tMax.y), tMax.z);
+            if (enter > exit || enter >= currentMax) {
+                return currentMax;
+            }
+            hit = true;
+            return enter;
+        });
+        hits += hit ? 1 : 0;
+        query = (query + 1) % BVH_QUERY_COUNT;
+    }
+    benchmark::DoNotOptimize(hits);
+    state.SetItemsProcessed(state.iterations());
+    state.counters["hit_rate"] = static_cast<double>(hits) / static_cast<double>(state.iterations());
+}
+BENCHMARK(BM_BvhRayCast)->Arg(10000)->Arg(100000)->Arg(1000000);
+
+// --- Culling ---
+
+static void BM_FrustumCull(benchmark::State& state) {
+    const size_t count = static_cast<size_t>(state.range(0));
+    const float extent = ExtentFor(count);
+    const std::vector<AABB> boxes = MakeBoxes(count, extent);
+    std::vector<uint8_t> visibility(count);
+    const Frustum frustum = MakeFrustum(extent);
+    size_t visible = 0;
+    for (auto _ : state) {
+        visible = frustum.Cull(boxes.data(), count, visibility.data());
+        benchmark::DoNotOptimize(visible);
+    }
+    state.SetItemsProcessed(state.iterations() * count);
+    state.SetBytesProcessed(state.iterations() * count * sizeof(AABB));
+    state.counters["visible"] = static_cast<double>(visible);
+}
+BENCHMARK(BM_FrustumCull)->RangeMultiplier(10)->Range(1000, 1000000)->Unit(benchmark::kMicrosecond);
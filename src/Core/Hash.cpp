@@ -0,0 +1,46 @@
+// src/Core/Hash.cpp
+#include "Hash.h"
+#include "MappedFile.h"
+#include <cstring>
+
+static constexpr uint64_t FNV_PRIME = 1099511628211ull;
+
+static inline uint64_t Mix(uint64_t h) {
+    h ^= h >> 33;
+    h *= 0xff51afd7ed558ccdull;
+    h ^= h >> 33;
+    h *= 0xc4ceb9fe1a85ec53ull;
+    h ^= h >> 33;
+    return h;
+}
+
+uint64_t HashBytes(const void* data, size_t size, uint64_t seed) {
+    const uint8_t* bytes = static_cast<const uint8_t*>(data);
+
+    // Four independent lanes over 64-bit words: byte-wise FNV-1a is bound by the
+    // multiply latency, which is too slow for source assets of several dozen MB.
+    uint64_t lanes[4] = { seed, seed ^ 0x9e3779b97f4a7c15ull, seed ^ 0xc2b2ae3d27d4eb4full, seed ^ 0x165667b19e3779f9ull };
+    size_t i = 0;
+    for (; i + 32 <= size; i += 32) {
+        for (int l = 0; l < 4; l++) {
+            uint64_t word;
+            std::memcpy(&word, bytes + i + l * 8, sizeof(word));
+            lanes[l] = (lanes[l] ^ word) * FNV_PRIME;
+        }
+    }
+
+    uint64_t hash = Mix(lanes[0]) ^ (Mix(lanes[1]) * 3) ^ (Mix(lanes[2]) * 5) ^ (Mix(lanes[3]) * 7);
+    for (; i < size; i++) {
+        hash = (hash ^ bytes[i]) * FNV_PRIME;
+    }
+    return Mix(hash ^ size);
+}
+
+bool HashFile(const std::string& path, uint64_t& outHash, uint64_t seed) {
+    MappedFile file;
+    if (!file.Open(path)) {
+        return false;
+    }
+    outHash = HashBytes(file.GetData(), file.GetSize(), seed);
+    return true;
+}
@@ -0,0 +1,21 @@
+// src/Core/Hash.h
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <string>
+
+// Default seed (64-bit FNV-1a offset basis)
+constexpr uint64_t PLUME_HASH_SEED = 14695981039346656037ull;
+
+// Fast, non-cryptographic hash of a memory block.
+// Used to identify asset contents (cooked mesh cache, texture cache).
+uint64_t HashBytes(const void* data, size_t size, uint64_t seed = PLUME_HASH_SEED);
+
+// Folds a value into an existing hash
+inline uint64_t HashCombine(uint64_t hash, uint64_t value) {
+    return HashBytes(&value, sizeof(value), hash);
+}
+
+// Hashes the whole content of a file. Returns false if the file cannot be read.
+bool HashFile(const std::string& path, uint64_t& outHash, uint64_t seed = PLUME_HASH_SEED);
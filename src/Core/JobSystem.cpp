@@ -0,0 +1,283 @@
+// src/Core/JobSystem.cpp
+#include "JobSystem.h"
+#include "Profiler.h"
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <string>
+#include <thread>
+
+struct Job {
+    JobFunction Function;
+    JobCounter* Counter = nullptr;
+};
+
+struct WorkQueue {
+    std::mutex Mutex;
+    std::deque<Job> Jobs;
+};
+
+static std::vector<std::unique_ptr<WorkQueue>> s_Queues; // [0] = main/external threads, then workers, then the attached thread
+static std::vector<std::thread> s_Workers;
+static std::atomic<bool> s_Running{ false };
+static std::atomic<int> s_QueuedJobs{ 0 };
+static std::atomic<int> s_SleepingWorkers{ 0 };
+static std::atomic<bool> s_AttachedSlotTaken{ false };
+static std::mutex s_SleepMutex;
+static std::condition_variable s_SleepCondition;
+
+static thread_local unsigned int t_ThreadIndex = 0;
+static thread_local uint32_t t_StealSeed = 0x9e3779b9u;
+
+static void PushJob(Job job) {
+    WorkQueue& queue = *s_Queues[t_ThreadIndex];
+    {
+        std::lock_guard<std::mutex> lock(queue.Mutex);
+        queue.Jobs.push_back(std::move(job));
+    }
+    s_QueuedJobs.fetch_add(1);
+
+    // Only pay for the wake-up when somebody actually sleeps. Both counters are
+    // sequentially consistent, so either the worker sees the new job or we see it sleeping.
+    if (s_SleepingWorkers.load() > 0) {
+        std::lock_guard<std::mutex> lock(s_SleepMutex);
+        s_SleepCondition.notify_one();
+    }
+}
+
+static bool PopJob(Job& outJob) {
+    // 1. Own deque, newest first (hot in cache)
+    {
+        WorkQueue& queue = *s_Queues[t_ThreadIndex];
+        std::lock_guard<std::mutex> lock(queue.Mutex);
+        if (!queue.Jobs.empty()) {
+            outJob = std::move(queue.Jobs.back());
+            queue.Jobs.pop_back();
+            s_QueuedJobs.fetch_sub(1);
+            return true;
+        }
+    }
+
+    // 2. Steal the oldest job of another thread, starting from a random victim
+    const size_t queueCount = s_Queues.size();
+    t_StealSeed ^= t_StealSeed << 13;
+    t_StealSeed ^= t_StealSeed >> 17;
+    t_StealSeed ^= t_StealSeed << 5;
+    for (size_t i = 0; i < queueCount; i++) {
+        size_t victim = (t_StealSeed + i) % queueCount;
+        if (victim == t_ThreadIndex) {
+            continue;
+        }
+        WorkQueue& queue = *s_Queues[victim];
+        std::lock_guard<std::mutex> lock(queue.Mutex);
+        if (!queue.Jobs.empty()) {
+            outJob = std::move(queue.Jobs.front());
+            queue.Jobs.pop_front();
+            s_QueuedJobs.fetch_sub(1);
+            return true;
+        }
+    }
+    return false;
+}
+
+void JobSystem::WorkerLoop(unsigned int threadIndex) {
+    t_ThreadIndex = threadIndex;
+    t_StealSeed = 0x9e3779b9u * (threadIndex + 1);
+    Profiler::SetThreadName("Worker " + std::to_string(threadIndex));
+
+    while (true) {
+        Job job;
+        if (PopJob(job)) {
+            ExecuteJob(job);
+            continue;
+        }
+        if (!s_Running.load()) {
+            break; // Queues are drained, leave
+        }
+
+        std::unique_lock<std::mutex> lock(s_SleepMutex);
+        s_SleepingWorkers.fetch_add(1);
+        s_SleepCondition.wait(lock, [] { return s_QueuedJobs.load() > 0 || !s_Running.load(); });
+        s_SleepingWorkers.fetch_sub(1);
+    }
+}
+
+// --- JobSystem ---
+
+void JobSystem::Init(unsigned int workerCount) {
+    if (s_Running.load()) {
+        return;
+    }
+    if (workerCount == 0) {
+        unsigned int hardwareThreads = std::thread::hardware_concurrency();
+        // Keep at least one worker so fire-and-forget jobs always make progress
+        workerCount = std::max(1u, hardwareThreads > 1 ? hardwareThreads - 1 : 1u);
+    }
+
+    s_Queues.clear();
+    for (unsigned int i = 0; i < workerCount + EXTERNAL_THREAD_SLOTS; i++) {
+        s_Queues.push_back(std::make_unique<WorkQueue>());
+    }
+
+    t_ThreadIndex = 0;
+    s_AttachedSlotTaken.store(false);
+    s_Running.store(true);
+    for (unsigned int i = 1; i <= workerCount; i++) {
+        s_Workers.emplace_back(WorkerLoop, i);
+    }
+}
+
+void JobSystem::Shutdown() {
+    if (!s_Running.load()) {
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> lock(s_SleepMutex);
+        s_Running.store(false);
+    }
+    s_SleepCondition.notify_all();
+    for (auto& worker : s_Workers) {
+        worker.join();
+    }
+    s_Workers.clear();
+
+    // Jobs pushed by the main thread after the workers left still have to run
+    Job job;
+    while (!s_Queues.empty() && PopJob(job)) {
+        ExecuteJob(job);
+    }
+    s_Queues.clear();
+}
+
+bool JobSystem::IsInitialized() {
+    return s_Running.load();
+}
+
+unsigned int JobSystem::GetWorkerCount() {
+    return static_cast<unsigned int>(s_Workers.size());
+}
+
+unsigned int JobSystem::GetThreadCount() {
+    return static_cast<unsigned int>(s_Workers.size()) + EXTERNAL_THREAD_SLOTS;
+}
+
+unsigned int JobSystem::GetThreadIndex() {
+    return t_ThreadIndex;
+}
+
+bool JobSystem::AttachThread() {
+    if (!s_Running.load() || t_ThreadIndex != 0 || s_AttachedSlotTaken.exchange(true)) {
+        return false;
+    }
+    t_ThreadIndex = static_cast<unsigned int>(s_Workers.size()) + 1;
+    t_StealSeed = 0x9e3779b9u * (t_ThreadIndex + 1);
+    return true;
+}
+
+void JobSystem::DetachThread() {
+    if (t_ThreadIndex != static_cast<unsigned int>(s_Workers.size()) + 1) {
+        return;
+    }
+    t_ThreadIndex = 0;
+    s_AttachedSlotTaken.store(false);
+}
+
+void JobSystem::Run(JobFunction job, JobCounter* counter) {
+    if (counter) {
+        counter->m_Pending.fetch_add(1);
+    }
+    Job entry{ std::move(job), counter };
+    if (!s_Running.load()) {
+        ExecuteJob(entry);
+        return;
+    }
+    PushJob(std::move(entry));
+}
+
+void JobSystem::RunAfter(JobCounter& dependency, JobFunction job, JobCounter* counter) {
+    if (counter) {
+        counter->m_Pending.fetch_add(1);
+    }
+    {
+        std::lock_guard<std::mutex> lock(dependency.m_Mutex);
+        if (dependency.m_Pending.load() > 0) {
+            dependency.m_Continuations.emplace_back(std::move(job), counter);
+            return;
+        }
+    }
+    Job entry{ std::move(job), counter };
+    if (!s_Running.load()) {
+        ExecuteJob(entry);
+        return;
+    }
+    PushJob(std::move(entry));
+}
+
+void JobSystem::ExecuteJob(Job& job) {
+    PLUME_PROFILE_SCOPE("Job");
+    job.Function();
+    FinishJob(job.Counter);
+}
+
+void JobSystem::FinishJob(JobCounter* counter) {
+    if (!counter) {
+        return;
+    }
+
+    // The decrement happens under the counter's mutex: a thread waiting on it
+    // takes the same mutex before returning, so the counter cannot be destroyed
+    // while we are still releasing its continuations.
+    std::vector<std::pair<JobFunction, JobCounter*>> continuations;
+    {
+        std::lock_guard<std::mutex> lock(counter->m_Mutex);
+        if (counter->m_Pending.fetch_sub(1) == 1) {
+            continuations.swap(counter->m_Continuations);
+        }
+    }
+
+    for (auto& continuation : continuations) {
+        Job job{ std::move(continuation.first), continuation.second };
+        if (s_Running.load()) {
+            PushJob(std::move(job));
+        } else {
+            ExecuteJob(job);
+        }
+    }
+}
+
+void JobSystem::Wait(JobCounter& counter) {
+    while (counter.m_Pending.load(std::memory_order_acquire) > 0) {
+        Job job;
+        if (s_Running.load() && PopJob(job)) {
+            ExecuteJob(job);
+        } else {
+            std::this_thread::yield();
+        }
+    }
+    // Synchronize with the thread that released the counter (see FinishJob)
+    std::lock_guard<std::mutex> lock(counter.m_Mutex);
+}
+
+void JobSystem::ParallelFor(uint32_t count, uint32_t grainSize, const std::function<void(uint32_t begin, uint32_t end)>& body) {
+    if (count == 0) {
+        return;
+    }
+    if (grainSize == 0) {
+        // About four chunks per thread keeps the load balanced without too many jobs
+        grainSize = std::max(1u, count / ((GetWorkerCount() + 1) * 4));
+    }
+    if (!s_Running.load() || count <= grainSize) {
+        body(0, count);
+        return;
+    }
+
+    JobCounter counter;
+    // The first chunk is kept for the calling thread
+    for (uint32_t begin = grainSize; begin < count; begin += grainSize) {
+        uint32_t end = std::min(count, begin + grainSize);
+        Run([&body, begin, end]() { body(begin, end); }, &counter);
+    }
+    body(0, std::min(count, grainSize));
+    Wait(counter);
+}
@@ -0,0 +1,78 @@
+// src/Core/JobSystem.h
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <vector>
+
+using JobFunction = std::function<void()>;
+
+struct Job;
+
+// Tracks a group of jobs. It reaches zero once every job attached to it has
+// finished; other jobs can be scheduled to start at that point (see RunAfter).
+class JobCounter {
+public:
+    JobCounter() = default;
+    JobCounter(const JobCounter&) = delete;
+    JobCounter& operator=(const JobCounter&) = delete;
+
+    bool IsDone() const { return m_Pending.load(std::memory_order_acquire) == 0; }
+
+private:
+    friend class JobSystem;
+
+    std::atomic<int> m_Pending{ 0 };
+    std::mutex m_Mutex;
+    std::vector<std::pair<JobFunction, JobCounter*>> m_Continuations;
+};
+
+// Engine-wide job system: one deque per thread, the owner pushes/pops at the
+// back while idle workers steal from the front of the other deques.
+// Thread 0 is the main thread (and any thread that is not a worker); it takes
+// part in the work whenever it waits on a counter. One more thread (e.g. a
+// render thread) can get an index of its own with AttachThread.
+// Before Init() (and after Shutdown()) every job runs inline on the caller.
+class JobSystem {
+public:
+    // workerCount == 0 picks hardware_concurrency - 1 (the main thread is the last one)
+    static void Init(unsigned int workerCount = 0);
+    static void Shutdown();
+
+    // Threads that are not workers but may have an index of their own:
+    // the main thread and one attached thread
+    static constexpr unsigned int EXTERNAL_THREAD_SLOTS = 2;
+
+    static bool IsInitialized();
+    static unsigned int GetWorkerCount();
+    // Workers + external slots, i.e. the size of any per-thread array
+    static unsigned int GetThreadCount();
+    // 0 for the main/external threads, 1..N for the workers, N+1 for the attached thread
+    static unsigned int GetThreadIndex();
+
+    // Gives the calling thread (not a worker) its own index and deque, so it
+    // can run jobs and fill per-thread arrays while the main thread does too.
+    // Call after Init, from a thread that ends before Shutdown. False when
+    // the slot is already taken: the thread then keeps sharing index 0.
+    static bool AttachThread();
+    // Gives the slot back, so that a later thread can attach. Every job the
+    // thread pushed must have been waited for.
+    static void DetachThread();
+
+    static void Run(JobFunction job, JobCounter* counter = nullptr);
+    // Queues `job` once `dependency` has reached zero
+    static void RunAfter(JobCounter& dependency, JobFunction job, JobCounter* counter = nullptr);
+    // Runs pending jobs on the calling thread until `counter` reaches zero
+    static void Wait(JobCounter& counter);
+
+    // Splits [0, count) into chunks of `grainSize` items (0 = automatic) and
+    // calls body(begin, end) for each of them in parallel. Returns when done.
+    static void ParallelFor(uint32_t count, uint32_t grainSize, const std::function<void(uint32_t begin, uint32_t end)>& body);
+
+private:
+    static void WorkerLoop(unsigned int threadIndex);
+    static void ExecuteJob(Job& job);
+    static void FinishJob(JobCounter* counter);
+};
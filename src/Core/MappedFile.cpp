@@ -0,0 +1,143 @@
+// src/Core/MappedFile.cpp
+#include "MappedFile.h"
+#include <utility>
+
+#ifdef _WIN32
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+MappedFile::~MappedFile() {
+    Close();
+}
+
+MappedFile::MappedFile(MappedFile&& other) noexcept {
+    *this = std::move(other);
+}
+
+MappedFile& MappedFile::operator=(MappedFile&& other) noexcept {
+    if (this != &other) {
+        Close();
+        m_Data = other.m_Data;
+        m_Size = other.m_Size;
+        m_IsOpen = other.m_IsOpen;
+#ifdef _WIN32
+        m_FileHandle = other.m_FileHandle;
+        m_MappingHandle = other.m_MappingHandle;
+        other.m_FileHandle = nullptr;
+        other.m_MappingHandle = nullptr;
+#endif
+        other.m_Data = nullptr;
+        other.m_Size = 0;
+        other.m_IsOpen = false;
+    }
+    return *this;
+}
+
+#ifdef _WIN32
+
+bool MappedFile::Open(const std::string& path) {
+    Close();
+    HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+        return false;
+    }
+
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(file, &size)) {
+        CloseHandle(file);
+        return false;
+    }
+
+    m_FileHandle = file;
+    m_Size = static_cast<size_t>(size.QuadPart);
+    m_IsOpen = true;
+    if (m_Size == 0) {
+        return true; // An empty file cannot be mapped but is still valid
+    }
+
+    HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (!mapping) {
+        Close();
+        return false;
+    }
+    m_MappingHandle = mapping;
+
+    m_Data = static_cast<const uint8_t*>(MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0));
+    if (!m_Data) {
+        Close();
+        return false;
+    }
+    return true;
+}
+
+void MappedFile::Close() {
+    if (m_Data) {
+        UnmapViewOfFile(m_Data);
+    }
+    if (m_MappingHandle) {
+        CloseHandle(static_cast<HANDLE>(m_MappingHandle));
+    }
+    if (m_FileHandle) {
+        CloseHandle(static_cast<HANDLE>(m_FileHandle));
+    }
+    m_Data = nullptr;
+    m_MappingHandle = nullptr;
+    m_FileHandle = nullptr;
+    m_Size = 0;
+    m_IsOpen = false;
+}
+
+#else
+
+bool MappedFile::Open(const std::string& path) {
+    Close();
+    int fd = open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        return false;
+    }
+
+    struct stat st;
+    if (fstat(fd, &st) != 0) {
+        close(fd);
+        return false;
+    }
+
+    m_Size = static_cast<size_t>(st.st_size);
+    m_IsOpen = true;
+    if (m_Size == 0) {
+        close(fd);
+        return true; // An empty file cannot be mapped but is still valid
+    }
+
+    void* data = mmap(nullptr, m_Size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd); // The mapping keeps its own reference to the file
+    if (data == MAP_FAILED) {
+        m_Size = 0;
+        m_IsOpen = false;
+        return false;
+    }
+    m_Data = static_cast<const uint8_t*>(data);
+    return true;
+}
+
+void MappedFile::Close() {
+    if (m_Data) {
+        munmap(const_cast<uint8_t*>(m_Data), m_Size);
+    }
+    m_Data = nullptr;
+    m_Size = 0;
+    m_IsOpen = false;
+}
+
+#endif
@@ -8,70 +8,28 @@
 // Inclure stb_image pour le chargement de l'icône (implémentation définie dans Texture.cpp)
 #include <stb_image.h>
 
-#include "../Renderer/Shader.h"
+#include "../Renderer/SceneRenderer.h"
 #include "../Renderer/Camera.h"
+#include "../Renderer/TextureStreamer.h"
+#include "../Renderer/GLState.h"
+#include "../Renderer/GpuProfiler.h"
+#include "../Renderer/RenderThread.h"
+#include "../Renderer/Model/Mesh.h"
 #include "../Core/Input.h"
+#include "../Core/JobSystem.h"
+#include "../Core/Profiler.h"
 #include "Scene/Scene.h"
 #include "Scene/Entity.h"
 #include "Scene/Components.h"
 #include <glm/glm.hpp>
 #include <glm/gtc/matrix_transform.hpp>
-
-// --- SHADERS ---
-const std::string vertexShaderSource = R"(
-    #version 330 core
-    layout (location = 0) in vec3 a_Position;
-    layout (location = 1) in vec3 a_Normal;
-    layout (location = 2) in vec2 a_TexCoords;
-
-    uniform mat4 u_Model;
-    uniform mat4 u_View;
-    uniform mat4 u_Projection;
-
-    out vec2 v_TexCoords;
-    out vec3 v_Normal;
-    out vec3 v_FragPos;
-
-    void main() {
-       gl_Position = u_Projection * u_View * u_Model * vec4(a_Position, 1.0);
-       v_TexCoords = a_TexCoords;
-       v_FragPos = vec3(u_Model * vec4(a_Position, 1.0));
-       v_Normal = mat3(transpose(inverse(u_Model))) * a_Normal;
-    }
-)";
-
-const std::string fragmentShaderSource = R"(
-    #version 330 core
-    in vec2 v_TexCoords;
-    in vec3 v_Normal;
-    in vec3 v_FragPos;
-    
-    out vec4 FragColor;
-
-    uniform sampler2D u_TextureDiffuse;
-    uniform vec3 u_LightPos;
-    uniform vec3 u_LightColor;
-    uniform vec3 u_ViewPos;
-
-    void main() {
-       float ambientStrength = 0.1;
-       vec3 ambient = ambientStrength * u_LightColor;
-
-       vec3 norm = normalize(v_Normal);
-       vec3 lightDir = normalize(u_LightPos - v_FragPos);
-       float diff = max(dot(norm, lightDir), 0.0);
-       vec3 diffuse = diff * u_LightColor;
-
-       vec4 texColor = texture(u_TextureDiffuse, v_TexCoords);
-       vec3 result = (ambient + diffuse) * texColor.rgb;
-       FragColor = vec4(result, 1.0);
-    }
-)";
+#include <chrono>
+#include <thread>
 
 const int WINDOW_WIDTH = 1280;
 const int WINDOW_HEIGHT = 720;
 
-PlumeApplication::PlumeApplication() { Init(); }
+PlumeApplication::PlumeApplication(bool pipelined, bool indirectDraws) : m_Pipelined(pipelined), m_IndirectDraws(indirectDraws) { Init(); }
 PlumeApplication::~PlumeApplication() { Shutdown(); }
 
 void PlumeApplication::Init() {
@@ -111,8 +69,14 @@ void PlumeApplication::Init() {
     glEnable(GL_DEPTH_TEST);
     SDL_SetRelativeMouseMode(SDL_TRUE);
     
+    Profiler::SetThreadName("Main");
+    GpuProfiler::Init();
+    JobSystem::Init();
+    TextureStreamer::Init();
     m_Input = new Input();
     m_Camera = new Camera(45.0f, (float)WINDOW_WIDTH / (float)WINDOW_HEIGHT, 0.1f, 100.0f);
+    m_SceneRenderer = std::make_unique<SceneRenderer>();
+    m_SceneRenderer->SetIndirectDraws(m_IndirectDraws);
     m_ActiveScene = std::make_unique<Scene>();
 
     // --- CHARGEMENT DU MODÈLE ---
@@ -121,8 +85,7 @@ void PlumeApplication::Init() {
     auto backpackModel = std::make_shared<Model>(modelPath);
     if (!backpackModel->GetMeshes().empty()) {
         modelEntity.AddComponent<ModelComponent>(backpackModel);
-        auto& transform = modelEntity.GetComponent<TransformComponent>();
-        transform.Scale = glm::vec3(0.5f);
+        modelEntity.PatchComponent<TransformComponent>([](TransformComponent& transform) { transform.Scale = glm::vec3(0.5f); });
     } else {
         std::cerr << "ERREUR: Le modele n'a pas pu etre charge : " << modelPath << std::endl;
     }
@@ -130,8 +93,7 @@ void PlumeApplication::Init() {
     // Créer une entité pour la lumière
     auto lightEntity = m_ActiveScene->CreateEntity("Point Light");
     lightEntity.AddComponent<LightComponent>();
-    auto& lightTransform = lightEntity.GetComponent<TransformComponent>();
-    lightTransform.Translation = glm::vec3(1.5f, 1.0f, 2.0f);
+    lightEntity.PatchComponent<TransformComponent>([](TransformComponent& transform) { transform.Translation = glm::vec3(1.5f, 1.0f, 2.0f); });
 }
 
 void PlumeApplication::Run() {
@@ -139,61 +101,152 @@ void PlumeApplication::Run() {
         std::cerr << "PlumeApplication: initialization failed, exiting Run()." << std::endl;
         return;
     }
-    std::unique_ptr<Shader> shader = std::make_unique<Shader>(vertexShaderSource, fragmentShaderSource);
-    
+    if (m_Pipelined) {
+        RunPipelined();
+        return;
+    }
     uint64_t lastFrameTime = SDL_GetPerformanceCounter();
     while (m_IsRunning) {
-        // ... (Gestion du deltaTime, des inputs et de la caméra)
-        uint64_t now = SDL_GetPerformanceCounter();
-        float deltaTime = (float)((now - lastFrameTime) * 1000 / (double)SDL_GetPerformanceFrequency()) / 1000.0f;
-        lastFrameTime = now;
+        Profiler::BeginFrame();
+        GpuProfiler::BeginFrame();
+        ProcessInput(lastFrameTime);
+
+        // Upload the textures decoded in the background, within the frame budget
+        TextureStreamer::Update();
+        
+        m_ActiveScene->OnUpdate(m_DeltaTime);
+
+        // --- Rendu de la Scène ---
+        m_SceneRenderer->Render(*m_ActiveScene, *m_Camera);
+        SetRenderCounters(m_SceneRenderer->GetStats(), m_SceneRenderer->GetQueueStats(), TextureStreamer::GetStats().UploadedBytesLastFrame);
+
+        {
+            PLUME_PROFILE_SCOPE("Swap");
+            SDL_GL_SwapWindow(m_Window);
+        }
+        Profiler::EndFrame();
+    }
+}
+
+void PlumeApplication::RunPipelined() {
+    // From here on the context belongs to the render thread
+    SDL_GL_MakeCurrent(m_Window, nullptr);
+
+    RenderThread renderThread;
+    renderThread.Start(
+        [this]() { SDL_GL_MakeCurrent(m_Window, m_GLContext); },
+        [this](const RenderSnapshot& snapshot) {
+            GpuProfiler::BeginFrame();
+            // Upload the textures decoded in the background, within the frame budget
+            TextureStreamer::Update();
+            m_SceneRenderer->Render(snapshot);
+            {
+                PLUME_PROFILE_SCOPE("Swap");
+                SDL_GL_SwapWindow(m_Window);
+            }
+            // Counters are set by the simulation thread, which owns the frames
+            std::lock_guard<std::mutex> lock(m_RenderStatsMutex);
+            m_RenderStats = m_SceneRenderer->GetStats();
+            m_QueueStats = m_SceneRenderer->GetQueueStats();
+            m_TextureUploadedBytes = TextureStreamer::GetStats().UploadedBytesLastFrame;
+        },
+        [this]() { SDL_GL_MakeCurrent(m_Window, nullptr); });
+
+    uint64_t lastFrameTime = SDL_GetPerformanceCounter();
+    uint64_t frameIndex = 0;
+    while (m_IsRunning) {
+        Profiler::BeginFrame();
+        ProcessInput(lastFrameTime);
+        m_ActiveScene->OnUpdate(m_DeltaTime);
+
+        RenderSnapshot& snapshot = renderThread.GetWriteSnapshot();
+        snapshot.FrameIndex = ++frameIndex;
+        SceneRenderer::Extract(*m_ActiveScene, *m_Camera, snapshot);
+        renderThread.Publish();
+
+        {
+            std::lock_guard<std::mutex> lock(m_RenderStatsMutex);
+            SetRenderCounters(m_RenderStats, m_QueueStats, m_TextureUploadedBytes);
+        }
+        const RenderThreadStats threadStats = renderThread.GetStats();
+        Profiler::SetCounter("Render latency (us)", static_cast<int64_t>(threadStats.LastLatencyMs * 1000.0));
+        Profiler::SetCounter("Dropped snapshots", static_cast<int64_t>(threadStats.SnapshotsDropped));
+        Profiler::EndFrame();
+
+        // The simulation never waits for the renderer, but there is no point
+        // in replacing snapshots that fast: idle a little while one is unread
+        if (renderThread.IsSnapshotPending()) {
+            PLUME_PROFILE_SCOPE("Idle");
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    }
+
+    renderThread.Stop();
+    SDL_GL_MakeCurrent(m_Window, m_GLContext);
+}
+
+void PlumeApplication::ProcessInput(uint64_t& lastFrameTime) {
+    // ... (Gestion du deltaTime, des inputs et de la caméra)
+    uint64_t now = SDL_GetPerformanceCounter();
+    m_DeltaTime = (float)((now - lastFrameTime) * 1000 / (double)SDL_GetPerformanceFrequency()) / 1000.0f;
+    lastFrameTime = now;
+    {
+        PLUME_PROFILE_SCOPE("Input");
         m_Input->BeginNewFrame();
         SDL_Event event;
         while (SDL_PollEvent(&event)) {
             if (event.type == SDL_QUIT) { m_IsRunning = false; }
             m_Input->Update(event);
         }
-        // Show About dialog on F1
-        if (m_Input->IsKeyPressed(SDL_SCANCODE_F1)) {
-            ShowAbout();
-        }
-        m_Camera->Update(*m_Input, deltaTime);
-        
-        // --- Rendu de la Scène ---
-        glClearColor(0.1f, 0.1f, 0.1f, 1.0f);
-        glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
-
-        shader->Bind();
-        shader->UploadUniformMat4("u_View", m_Camera->GetViewMatrix());
-        shader->UploadUniformMat4("u_Projection", m_Camera->GetProjectionMatrix());
-        shader->UploadUniformVec3("u_ViewPos", m_Camera->GetPosition());
-
-        glm::vec3 lightPos;
-        glm::vec3 lightColor;
-        auto lightView = m_ActiveScene->GetRegistry().view<TransformComponent, LightComponent>();
-        for (auto entity : lightView) {
-            auto& transform = lightView.get<TransformComponent>(entity);
-            auto& light = lightView.get<LightComponent>(entity);
-            lightPos = transform.Translation;
-            lightColor = light.Color * light.Intensity;
-            break;
-        }
-        shader->UploadUniformVec3("u_LightPos", lightPos);
-        shader->UploadUniformVec3("u_LightColor", lightColor);
-
-        auto modelView = m_ActiveScene->GetRegistry().view<TransformComponent, ModelComponent>();
-        for (auto entity : modelView) {
-            auto& transform = modelView.get<TransformComponent>(entity);
-            auto& modelComp = modelView.get<ModelComponent>(entity);
-            shader->UploadUniformMat4("u_Model", transform.GetTransform());
-            modelComp.model->Draw(*shader);
+    }
+    // Show About dialog on F1
+    if (m_Input->IsKeyPressed(SDL_SCANCODE_F1)) {
+        ShowAbout();
+    }
+    // F2: frame time summary, F3: start / stop a trace capture
+    if (m_Input->IsKeyPressed(SDL_SCANCODE_F2)) {
+        Profiler::PrintSummary();
+    }
+    if (m_Input->IsKeyPressed(SDL_SCANCODE_F3)) {
+        if (!Profiler::IsCapturing()) {
+            Profiler::BeginCapture();
+            std::cout << "Profiler: capture started" << std::endl;
+        } else {
+            Profiler::EndCapture();
+            if (Profiler::ExportChromeTrace("plume_trace.json")) {
+                std::cout << "Profiler: capture written to plume_trace.json" << std::endl;
+            }
         }
-
-        SDL_GL_SwapWindow(m_Window);
     }
+    m_Camera->Update(*m_Input, m_DeltaTime);
+}
+
+void PlumeApplication::SetRenderCounters(const SceneRendererStats& renderStats, const RenderQueueStats& queueStats, uint64_t textureUploadedBytes) {
+    Profiler::SetCounter("Draw calls", renderStats.DrawCalls);
+    Profiler::SetCounter("Triangles", renderStats.Triangles);
+    Profiler::SetCounter("Visible objects", renderStats.VisibleObjects);
+    Profiler::SetCounter("Recorded commands", renderStats.RecordedCommands);
+    Profiler::SetCounter("State binds", queueStats.ProgramBinds + queueStats.TextureBinds + queueStats.VertexArrayBinds + queueStats.UniformBufferBinds);
+    Profiler::SetCounter("Uploaded bytes", static_cast<int64_t>(renderStats.UploadedBytes + textureUploadedBytes));
+    Profiler::SetCounter("Fence wait (us)", static_cast<int64_t>(renderStats.FenceWaitNs / 1000));
+    Profiler::SetCounter("Lights", renderStats.Lights);
+    Profiler::SetCounter("Light indices", renderStats.LightIndices);
 }
 
 void PlumeApplication::Shutdown() {
+    TextureStreamer::Shutdown();
+    JobSystem::Shutdown();
+    // GL objects (models, textures, buffers) must die while the context is alive
+    m_SceneRenderer.reset();
+    m_ActiveScene.reset();
+    Mesh::ReleaseArenas();
+    GpuProfiler::Shutdown();
+    if (GLState::IsDebugMode()) {
+        const GLStateStats& stats = GLState::GetStats();
+        uint64_t issued = stats.Program.Issued + stats.VertexArray.Issued + stats.Buffer.Issued + stats.Texture.Issued + stats.ActiveTexture.Issued;
+        uint64_t elided = stats.Program.Elided + stats.VertexArray.Elided + stats.Buffer.Elided + stats.Texture.Elided + stats.ActiveTexture.Elided;
+        std::cout << "GL state cache: " << issued << " calls issued, " << elided << " elided" << std::endl;
+    }
     delete m_Camera;
     delete m_Input;
     SDL_GL_DeleteContext(m_GLContext);
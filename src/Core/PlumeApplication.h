@@ -1,16 +1,22 @@
 // src/Core/PlumeApplication.h
 #pragma once
 
+#include <cstdint>
 #include <memory>
+#include <mutex>
 // Nous n'avons plus besoin d'inclure les classes de rendu ici
 #include "../Scene/Scene.h"
+#include "../Renderer/SceneRenderer.h"
 
 struct SDL_Window;
 typedef void* SDL_GLContext;
 
 class PlumeApplication {
 public:
-    PlumeApplication();
+    // `pipelined`: simulation on the calling thread, rendering on a
+    // RenderThread that owns the GL context (see RenderThread).
+    // `indirectDraws`: see SceneRenderer::SetIndirectDraws
+    explicit PlumeApplication(bool pipelined = false, bool indirectDraws = false);
     ~PlumeApplication();
 
     void Run();
@@ -19,13 +25,27 @@ private:
     void Init();
     void Shutdown();
     void ShowAbout();
+    void RunPipelined();
+    // Events, hotkeys and camera; sets m_DeltaTime
+    void ProcessInput(uint64_t& lastFrameTime);
+    void SetRenderCounters(const SceneRendererStats& renderStats, const RenderQueueStats& queueStats, uint64_t textureUploadedBytes);
 
     SDL_Window* m_Window = nullptr;
     SDL_GLContext m_GLContext = nullptr;
     bool m_IsRunning = true;
+    bool m_Pipelined = false;
+    bool m_IndirectDraws = false;
+    float m_DeltaTime = 0.0f;
+
+    // Last frame of the render thread, read by the simulation (pipelined mode)
+    std::mutex m_RenderStatsMutex;
+    SceneRendererStats m_RenderStats;
+    RenderQueueStats m_QueueStats;
+    uint64_t m_TextureUploadedBytes = 0;
 
     // NOUVEAU : L'application possède maintenant une scène active
     std::unique_ptr<Scene> m_ActiveScene;
+    std::unique_ptr<SceneRenderer> m_SceneRenderer;
 
     // Le reste est géré par la scène et la caméra
     class Camera* m_Camera = nullptr; // On gardera un pointeur brut pour un accès rapide
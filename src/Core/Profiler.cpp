@@ -0,0 +1,336 @@
+// src/Core/Profiler.cpp
+#include "Profiler.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+// One event slot. The fields are atomics so that EndFrame may read a slot the
+// owner is rewriting; relaxed stores cost the same as plain ones.
+struct ProfileEventSlot {
+    std::atomic<const char*> Name{ nullptr };
+    std::atomic<uint64_t> Start{ 0 };
+    std::atomic<uint64_t> End{ 0 };
+};
+
+// Single producer (the owning thread), single consumer (EndFrame)
+struct ThreadEventRing {
+    ProfileEventSlot Events[Profiler::RING_CAPACITY];
+    std::atomic<uint64_t> WriteIndex{ 0 };
+    uint64_t ReadIndex = 0;
+    uint32_t ThreadId = 0;
+    std::string Name; // Guarded by s_RingsMutex
+};
+
+struct CapturedEvent {
+    const char* Name;
+    uint64_t Start;
+    uint64_t End;
+    uint32_t ThreadId;
+};
+
+struct CapturedCounter {
+    const char* Name;
+    uint64_t Time;
+    int64_t Value;
+};
+
+static_assert((Profiler::RING_CAPACITY & (Profiler::RING_CAPACITY - 1)) == 0, "RING_CAPACITY must be a power of two");
+
+static const std::chrono::steady_clock::time_point s_Epoch = std::chrono::steady_clock::now();
+static std::atomic<bool> s_Enabled{ true };
+
+static std::mutex s_RingsMutex;
+static std::vector<std::unique_ptr<ThreadEventRing>> s_Rings;
+static thread_local ThreadEventRing* t_Ring = nullptr;
+static thread_local std::string t_ThreadName; // Until the ring exists
+static ThreadEventRing* s_GpuRing = nullptr; // Written by the GL thread only
+
+// Main thread state
+static uint64_t s_FrameStart = 0;
+static std::atomic<uint64_t> s_GpuFrameTime{ 0 }; // Added by the GL thread, which may not be the main one
+static std::vector<std::pair<const char*, int64_t>> s_FrameCounters;
+static std::vector<std::pair<const char*, int64_t>> s_LastFrameCounters;
+static double s_FrameHistory[Profiler::PROFILER_HISTORY_FRAMES];
+static double s_GpuFrameHistory[Profiler::PROFILER_HISTORY_FRAMES];
+static uint64_t s_FrameCount = 0;
+
+static bool s_Capturing = false;
+static std::vector<CapturedEvent> s_CaptureEvents;
+static std::vector<CapturedCounter> s_CaptureCounters;
+
+static ThreadEventRing* RegisterRing(const std::string& name) {
+    std::lock_guard<std::mutex> lock(s_RingsMutex);
+    s_Rings.push_back(std::make_unique<ThreadEventRing>());
+    ThreadEventRing* ring = s_Rings.back().get();
+    ring->ThreadId = static_cast<uint32_t>(s_Rings.size());
+    ring->Name = name.empty() ? "Thread " + std::to_string(ring->ThreadId) : name;
+    return ring;
+}
+
+// Rings are created on the first event: threads that never record (e.g.
+// workers while the profiler is disabled) cost no memory
+static ThreadEventRing& GetThreadRing() {
+    if (!t_Ring) {
+        t_Ring = RegisterRing(t_ThreadName);
+    }
+    return *t_Ring;
+}
+
+static void PushEvent(ThreadEventRing& ring, const char* name, uint64_t start, uint64_t end) {
+    const uint64_t index = ring.WriteIndex.load(std::memory_order_relaxed);
+    ProfileEventSlot& slot = ring.Events[index & (Profiler::RING_CAPACITY - 1)];
+    slot.Name.store(name, std::memory_order_relaxed);
+    slot.Start.store(start, std::memory_order_relaxed);
+    slot.End.store(end, std::memory_order_relaxed);
+    ring.WriteIndex.store(index + 1, std::memory_order_release);
+}
+
+// Oldest event of a ring whose WriteIndex is `writeIndex` that the owner cannot
+// be overwriting: it may already be filling slot `writeIndex`, which is also
+// the slot of `writeIndex - RING_CAPACITY`
+static uint64_t FirstValidIndex(uint64_t writeIndex) {
+    return writeIndex + 1 > Profiler::RING_CAPACITY ? writeIndex + 1 - Profiler::RING_CAPACITY : 0;
+}
+
+// Moves the events recorded since the last drain to the capture (or drops them)
+static void DrainRing(ThreadEventRing& ring) {
+    const uint64_t writeIndex = ring.WriteIndex.load(std::memory_order_acquire);
+    uint64_t readIndex = std::max(ring.ReadIndex, FirstValidIndex(writeIndex));
+    ring.ReadIndex = writeIndex;
+    if (!s_Capturing) {
+        return;
+    }
+
+    const size_t firstCopied = s_CaptureEvents.size();
+    for (uint64_t i = readIndex; i < writeIndex; i++) {
+        const ProfileEventSlot& slot = ring.Events[i & (Profiler::RING_CAPACITY - 1)];
+        s_CaptureEvents.push_back({ slot.Name.load(std::memory_order_relaxed), slot.Start.load(std::memory_order_relaxed),
+                                    slot.End.load(std::memory_order_relaxed), ring.ThreadId });
+    }
+    // The owner kept recording meanwhile: the slots it may have reused hold a
+    // mix of old and new fields, drop them
+    std::atomic_thread_fence(std::memory_order_acquire);
+    const uint64_t firstValid = FirstValidIndex(ring.WriteIndex.load(std::memory_order_relaxed));
+    if (readIndex < firstValid) {
+        const size_t overwritten = static_cast<size_t>(std::min(firstValid, writeIndex) - readIndex);
+        s_CaptureEvents.erase(s_CaptureEvents.begin() + firstCopied, s_CaptureEvents.begin() + firstCopied + overwritten);
+    }
+}
+
+// Value below which `fraction` of the sorted samples fall (nearest rank)
+static double Percentile(std::vector<double>& samples, double fraction) {
+    size_t rank = static_cast<size_t>(std::ceil(fraction * samples.size()));
+    size_t index = rank > 0 ? rank - 1 : 0;
+    std::nth_element(samples.begin(), samples.begin() + index, samples.end());
+    return samples[index];
+}
+
+static void WriteJsonString(FILE* file, const char* text) {
+    std::fputc('"', file);
+    for (const char* c = text ? text : ""; *c; c++) {
+        if (*c == '"' || *c == '\\') {
+            std::fputc('\\', file);
+            std::fputc(*c, file);
+        } else if (static_cast<unsigned char>(*c) < 0x20) {
+            std::fprintf(file, "\\u%04x", static_cast<unsigned>(*c));
+        } else {
+            std::fputc(*c, file);
+        }
+    }
+    std::fputc('"', file);
+}
+
+// --- Profiler ---
+
+void Profiler::SetEnabled(bool enabled) {
+    s_Enabled.store(enabled, std::memory_order_relaxed);
+}
+
+bool Profiler::IsEnabled() {
+    return s_Enabled.load(std::memory_order_relaxed);
+}
+
+void Profiler::SetThreadName(const std::string& name) {
+    t_ThreadName = name;
+    if (t_Ring) {
+        std::lock_guard<std::mutex> lock(s_RingsMutex);
+        t_Ring->Name = name;
+    }
+}
+
+uint64_t Profiler::GetTime() {
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - s_Epoch).count());
+}
+
+void Profiler::RecordEvent(const char* name, uint64_t start, uint64_t end) {
+    if (!IsEnabled()) {
+        return;
+    }
+    PushEvent(GetThreadRing(), name, start, end);
+}
+
+void Profiler::RecordGpuEvent(const char* name, uint64_t start, uint64_t duration) {
+    s_GpuFrameTime += duration;
+    if (!IsEnabled()) {
+        return;
+    }
+    if (!s_GpuRing) {
+        s_GpuRing = RegisterRing("GPU");
+    }
+    PushEvent(*s_GpuRing, name, start, start + duration);
+}
+
+void Profiler::SetCounter(const char* name, int64_t value) {
+    for (auto& counter : s_FrameCounters) {
+        if (std::strcmp(counter.first, name) == 0) {
+            counter.second = value;
+            return;
+        }
+    }
+    s_FrameCounters.emplace_back(name, value);
+}
+
+void Profiler::BeginFrame() {
+    s_FrameStart = GetTime();
+    s_FrameCounters.clear();
+}
+
+void Profiler::EndFrame() {
+    const uint64_t frameEnd = GetTime();
+    RecordEvent("Frame", s_FrameStart, frameEnd);
+
+    const uint32_t slot = static_cast<uint32_t>(s_FrameCount % PROFILER_HISTORY_FRAMES);
+    s_FrameHistory[slot] = (frameEnd - s_FrameStart) / 1e6;
+    s_GpuFrameHistory[slot] = s_GpuFrameTime.exchange(0) / 1e6;
+    s_FrameCount++;
+
+    if (s_Capturing) {
+        for (const auto& counter : s_FrameCounters) {
+            s_CaptureCounters.push_back({ counter.first, frameEnd, counter.second });
+        }
+    }
+    s_LastFrameCounters = s_FrameCounters;
+
+    std::lock_guard<std::mutex> lock(s_RingsMutex);
+    for (auto& ring : s_Rings) {
+        DrainRing(*ring);
+    }
+}
+
+void Profiler::BeginCapture() {
+    s_CaptureEvents.clear();
+    s_CaptureCounters.clear();
+    s_Capturing = true;
+}
+
+void Profiler::EndCapture() {
+    s_Capturing = false;
+}
+
+bool Profiler::IsCapturing() {
+    return s_Capturing;
+}
+
+bool Profiler::ExportChromeTrace(const std::string& path) {
+    FILE* file = std::fopen(path.c_str(), "w");
+    if (!file) {
+        std::cerr << "Profiler: cannot write " << path << std::endl;
+        return false;
+    }
+
+    std::fputs("{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n", file);
+    bool first = true;
+    auto separator = [&]() {
+        if (!first) {
+            std::fputs(",\n", file);
+        }
+        first = false;
+    };
+    {
+        std::lock_guard<std::mutex> lock(s_RingsMutex);
+        for (const auto& ring : s_Rings) {
+            separator();
+            std::fprintf(file, "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%u,\"args\":{\"name\":", ring->ThreadId);
+            WriteJsonString(file, ring->Name.c_str());
+            std::fputs("}}", file);
+        }
+    }
+    // Trace timestamps are in microseconds
+    for (const CapturedEvent& event : s_CaptureEvents) {
+        separator();
+        std::fputs("{\"name\":", file);
+        WriteJsonString(file, event.Name);
+        std::fprintf(file, ",\"ph\":\"X\",\"pid\":1,\"tid\":%u,\"ts\":%.3f,\"dur\":%.3f}",
+                     event.ThreadId, event.Start / 1e3, (event.End - event.Start) / 1e3);
+    }
+    for (const CapturedCounter& counter : s_CaptureCounters) {
+        separator();
+        std::fputs("{\"name\":", file);
+        WriteJsonString(file, counter.Name);
+        std::fprintf(file, ",\"ph\":\"C\",\"pid\":1,\"ts\":%.3f,\"args\":{\"value\":%lld}}",
+                     counter.Time / 1e3, static_cast<long long>(counter.Value));
+    }
+    std::fputs("\n]}\n", file);
+    const bool written = std::fclose(file) == 0;
+    std::cout << "Profiler: " << s_CaptureEvents.size() << " events written to " << path << std::endl;
+    return written;
+}
+
+std::vector<ProfilerZoneStats> Profiler::GetCaptureZones() {
+    const uint32_t gpuThreadId = s_GpuRing ? s_GpuRing->ThreadId : 0;
+    std::map<std::pair<std::string, bool>, ProfilerZoneStats> zones;
+    for (const CapturedEvent& event : s_CaptureEvents) {
+        const bool gpu = event.ThreadId == gpuThreadId;
+        ProfilerZoneStats& zone = zones[{ event.Name ? event.Name : "", gpu }];
+        const double durationMs = (event.End - event.Start) / 1e6;
+        zone.Count++;
+        zone.TotalMs += durationMs;
+        zone.MaxMs = std::max(zone.MaxMs, durationMs);
+    }
+
+    std::vector<ProfilerZoneStats> result;
+    result.reserve(zones.size());
+    for (auto& [key, zone] : zones) {
+        zone.Name = key.first;
+        zone.Gpu = key.second;
+        result.push_back(std::move(zone));
+    }
+    return result;
+}
+
+ProfilerSummary Profiler::GetSummary() {
+    ProfilerSummary summary;
+    summary.FrameCount = static_cast<uint32_t>(std::min<uint64_t>(s_FrameCount, PROFILER_HISTORY_FRAMES));
+    if (summary.FrameCount == 0) {
+        return summary;
+    }
+    std::vector<double> frameTimes(s_FrameHistory, s_FrameHistory + summary.FrameCount);
+    double total = 0.0, gpuTotal = 0.0;
+    for (uint32_t i = 0; i < summary.FrameCount; i++) {
+        total += frameTimes[i];
+        gpuTotal += s_GpuFrameHistory[i];
+        summary.MaxMs = std::max(summary.MaxMs, frameTimes[i]);
+    }
+    summary.AverageMs = total / summary.FrameCount;
+    summary.GpuAverageMs = gpuTotal / summary.FrameCount;
+    summary.P95Ms = Percentile(frameTimes, 0.95);
+    summary.P99Ms = Percentile(frameTimes, 0.99);
+    return summary;
+}
+
+void Profiler::PrintSummary() {
+    const ProfilerSummary summary = GetSummary();
+    std::cout << "Profiler: " << summary.FrameCount << " frames, avg " << summary.AverageMs << " ms, p95 " << summary.P95Ms
+              << " ms, p99 " << summary.P99Ms << " ms, max " << summary.MaxMs << " ms, GPU avg " << summary.GpuAverageMs << " ms" << std::endl;
+    for (const auto& counter : s_LastFrameCounters) {
+        std::cout << "  " << counter.first << ": " << counter.second << std::endl;
+    }
+}
@@ -0,0 +1,106 @@
+// src/Core/Profiler.h
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// Markers compile to nothing when the build defines PLUME_ENABLE_PROFILER=0.
+// Otherwise they stay in every build: a marker costs two clock reads and a
+// few relaxed stores, and nothing at all while the profiler is disabled.
+#ifndef PLUME_ENABLE_PROFILER
+#define PLUME_ENABLE_PROFILER 1
+#endif
+
+// Frame time statistics over the last PROFILER_HISTORY_FRAMES frames
+struct ProfilerSummary {
+    uint32_t FrameCount = 0;
+    double AverageMs = 0.0;
+    double P95Ms = 0.0;
+    double P99Ms = 0.0;
+    double MaxMs = 0.0;
+    double GpuAverageMs = 0.0; // Sum of the GPU zones of a frame, averaged (0 without GPU zones)
+};
+
+// Time spent under one marker name during a capture
+struct ProfilerZoneStats {
+    std::string Name;
+    bool Gpu = false;    // Measured by GpuProfiler
+    uint32_t Count = 0;
+    double TotalMs = 0.0; // Summed over every thread: parallel jobs add up
+    double MaxMs = 0.0;
+};
+
+// Engine-wide CPU profiler.
+// Every thread records its markers into its own ring buffer: the owner is the
+// only writer, so recording takes no lock. EndFrame (main thread) drains the
+// rings: events go to the capture while one is running and are dropped
+// otherwise. A thread that records faster than the frames drain it loses its
+// oldest events.
+// GPU durations (see GpuProfiler) and per-frame counters join the same
+// capture, which exports to the Chrome trace format (chrome://tracing, Perfetto).
+class Profiler {
+public:
+    // Events each thread can hold between two EndFrame calls
+    static constexpr uint32_t RING_CAPACITY = 16384;
+    static constexpr uint32_t PROFILER_HISTORY_FRAMES = 1024;
+
+    static void SetEnabled(bool enabled);
+    static bool IsEnabled();
+
+    // Name shown for the calling thread in the trace
+    static void SetThreadName(const std::string& name);
+
+    static void BeginFrame();
+    static void EndFrame();
+
+    // Nanoseconds on the profiler clock
+    static uint64_t GetTime();
+    // `name` must outlive the capture (string literals)
+    static void RecordEvent(const char* name, uint64_t start, uint64_t end);
+    // A GPU duration, drawn on its own track from the CPU time its commands were issued
+    static void RecordGpuEvent(const char* name, uint64_t start, uint64_t duration);
+    // Value of a counter for the current frame (draw calls, uploads...)
+    static void SetCounter(const char* name, int64_t value);
+
+    static void BeginCapture();
+    static void EndCapture();
+    static bool IsCapturing();
+    // Writes the last capture as Chrome trace JSON; false if the file cannot be written
+    static bool ExportChromeTrace(const std::string& path);
+    // Events of the last capture grouped by name (then CPU/GPU), sorted by name
+    static std::vector<ProfilerZoneStats> GetCaptureZones();
+
+    static ProfilerSummary GetSummary();
+    // Frame times and the counters of the last frame, on stdout
+    static void PrintSummary();
+};
+
+// Records the lifetime of the scope as one event
+class ProfileScope {
+public:
+    explicit ProfileScope(const char* name) : m_Name(name), m_Start(Profiler::IsEnabled() ? Profiler::GetTime() : DISABLED) {}
+    ~ProfileScope() {
+        if (m_Start != DISABLED) {
+            Profiler::RecordEvent(m_Name, m_Start, Profiler::GetTime());
+        }
+    }
+    ProfileScope(const ProfileScope&) = delete;
+    ProfileScope& operator=(const ProfileScope&) = delete;
+
+private:
+    static constexpr uint64_t DISABLED = UINT64_MAX;
+
+    const char* m_Name;
+    uint64_t m_Start;
+};
+
+#if PLUME_ENABLE_PROFILER
+#define PLUME_PROFILE_CONCAT_INNER(a, b) a##b
+#define PLUME_PROFILE_CONCAT(a, b) PLUME_PROFILE_CONCAT_INNER(a, b)
+#define PLUME_PROFILE_SCOPE(name) ProfileScope PLUME_PROFILE_CONCAT(profileScope, __LINE__)(name)
+#define PLUME_PROFILE_FUNCTION() PLUME_PROFILE_SCOPE(__func__)
+#else
+#define PLUME_PROFILE_SCOPE(name)
+#define PLUME_PROFILE_FUNCTION()
+#endif
@@ -0,0 +1,53 @@
+// src/Core/TripleBuffer.h
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+// Lock-free hand-off of the latest value from one producer thread to one
+// consumer thread. The producer fills its own slot and publishes it; the
+// consumer takes the most recently published slot. Neither side ever waits
+// for the other: a value published while the previous one was still unread
+// replaces it (see HasUnread to avoid that).
+//
+// Three slots: one owned by each side, one in the middle. Publish and Acquire
+// swap their own slot with the middle one, in a single atomic exchange.
+template<typename T>
+class TripleBuffer {
+public:
+    TripleBuffer() = default;
+    TripleBuffer(const TripleBuffer&) = delete;
+    TripleBuffer& operator=(const TripleBuffer&) = delete;
+
+    // --- Producer ---
+    // The slot being filled; the consumer never sees it before Publish
+    T& GetWriteBuffer() { return m_Slots[m_Write]; }
+    void Publish() {
+        m_Write = m_Middle.exchange(static_cast<uint8_t>(m_Write | UNREAD_BIT), std::memory_order_acq_rel) & INDEX_MASK;
+    }
+    // True while the last published value has not been acquired
+    bool HasUnread() const { return (m_Middle.load(std::memory_order_acquire) & UNREAD_BIT) != 0; }
+
+    // --- Consumer ---
+    // Takes the latest published value if there is a new one; false otherwise
+    // (GetReadBuffer still returns the previous value then)
+    bool Acquire() {
+        if (!HasUnread()) {
+            return false;
+        }
+        m_Read = m_Middle.exchange(m_Read, std::memory_order_acq_rel) & INDEX_MASK;
+        return true;
+    }
+    // The consumer owns this slot until its next Acquire, and may modify it
+    T& GetReadBuffer() { return m_Slots[m_Read]; }
+    const T& GetReadBuffer() const { return m_Slots[m_Read]; }
+
+private:
+    static constexpr uint8_t INDEX_MASK = 0x3;
+    static constexpr uint8_t UNREAD_BIT = 0x4;
+
+    T m_Slots[3];
+    uint8_t m_Write = 0; // Producer only
+    uint8_t m_Read = 1;  // Consumer only
+    std::atomic<uint8_t> m_Middle{ 2 };
+};
@@ -0,0 +1,60 @@
+// src/Renderer/Bounds.h
+#pragma once
+
+#include <glm/glm.hpp>
+#include <cfloat>
+
+// Axis-aligned bounding box. A default-constructed box is empty (Min > Max)
+// and grows with Expand().
+struct AABB {
+    glm::vec3 Min = glm::vec3(FLT_MAX);
+    glm::vec3 Max = glm::vec3(-FLT_MAX);
+
+    AABB() = default;
+    AABB(const glm::vec3& min, const glm::vec3& max) : Min(min), Max(max) {}
+
+    bool IsEmpty() const { return Min.x > Max.x; }
+    glm::vec3 GetCenter() const { return (Min + Max) * 0.5f; }
+    glm::vec3 GetExtents() const { return (Max - Min) * 0.5f; }
+
+    void Expand(const glm::vec3& point) {
+        Min = glm::min(Min, point);
+        Max = glm::max(Max, point);
+    }
+
+    void Expand(const AABB& other) {
+        if (!other.IsEmpty()) {
+            Min = glm::min(Min, other.Min);
+            Max = glm::max(Max, other.Max);
+        }
+    }
+
+    // Box enclosing this box once transformed (Arvo's method: center + absolute
+    // matrix applied to the extents), without going through the 8 corners
+    AABB Transform(const glm::mat4& matrix) const {
+        if (IsEmpty()) {
+            return *this;
+        }
+        glm::vec3 center = glm::vec3(matrix * glm::vec4(GetCenter(), 1.0f));
+        glm::vec3 extents = GetExtents();
+        glm::vec3 worldExtents = glm::abs(glm::vec3(matrix[0])) * extents.x
+                               + glm::abs(glm::vec3(matrix[1])) * extents.y
+                               + glm::abs(glm::vec3(matrix[2])) * extents.z;
+        return AABB(center - worldExtents, center + worldExtents);
+    }
+};
+
+struct BoundingSphere {
+    glm::vec3 Center = glm::vec3(0.0f);
+    float Radius = 0.0f;
+
+    BoundingSphere() = default;
+    BoundingSphere(const glm::vec3& center, float radius) : Center(center), Radius(radius) {}
+
+    // Conservative under non-uniform scale: the radius follows the largest axis
+    BoundingSphere Transform(const glm::mat4& matrix) const {
+        float scale = glm::max(glm::length(glm::vec3(matrix[0])),
+                      glm::max(glm::length(glm::vec3(matrix[1])), glm::length(glm::vec3(matrix[2]))));
+        return BoundingSphere(glm::vec3(matrix * glm::vec4(Center, 1.0f)), Radius * scale);
+    }
+};
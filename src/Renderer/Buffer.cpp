@@ -1,41 +1,126 @@
 // src/Renderer/Buffer.cpp
 #include "Buffer.h"
+#include "GLState.h"
 #include <glad/glad.h>
+#include <algorithm>
+#include <vector>
+
+// Buffer storage cannot grow in place: the content goes through a temporary
+// buffer while `buffer` gets its new storage. Copy targets are used so the
+// vertex array and element bindings are left alone.
+static void ResizeBufferStorage(uint32_t buffer, uint32_t oldSize, uint32_t newSize, GLenum usage) {
+    const uint32_t keptSize = oldSize < newSize ? oldSize : newSize;
+    uint32_t staging = 0;
+    if (keptSize > 0) {
+        glGenBuffers(1, &staging);
+        GLState::BindBuffer(GL_COPY_WRITE_BUFFER, staging);
+        glBufferData(GL_COPY_WRITE_BUFFER, keptSize, nullptr, GL_STREAM_COPY);
+        GLState::BindBuffer(GL_COPY_READ_BUFFER, buffer);
+        glCopyBufferSubData(GL_COPY_READ_BUFFER, GL_COPY_WRITE_BUFFER, 0, 0, keptSize);
+    }
+    GLState::BindBuffer(GL_COPY_WRITE_BUFFER, buffer);
+    glBufferData(GL_COPY_WRITE_BUFFER, newSize, nullptr, usage);
+    if (keptSize > 0) {
+        GLState::BindBuffer(GL_COPY_READ_BUFFER, staging);
+        glCopyBufferSubData(GL_COPY_READ_BUFFER, GL_COPY_WRITE_BUFFER, 0, 0, keptSize);
+        GLState::DeleteBuffer(staging);
+    }
+}
 
 // --- VertexBuffer ---
-VertexBuffer::VertexBuffer(const void* data, uint32_t size) {
+VertexBuffer::VertexBuffer(const void* data, uint32_t size) : m_Size(size) {
     glGenBuffers(1, &m_RendererID);
-    glBindBuffer(GL_ARRAY_BUFFER, m_RendererID);
+    GLState::BindBuffer(GL_ARRAY_BUFFER, m_RendererID);
     glBufferData(GL_ARRAY_BUFFER, size, data, GL_STATIC_DRAW);
 }
 
+VertexBuffer::VertexBuffer(uint32_t size) : m_Size(size) {
+    glGenBuffers(1, &m_RendererID);
+    GLState::BindBuffer(GL_ARRAY_BUFFER, m_RendererID);
+    glBufferData(GL_ARRAY_BUFFER, size, nullptr, GL_DYNAMIC_DRAW);
+}
+
+VertexBuffer::VertexBuffer(const std::shared_ptr<DynamicBuffer>& stream) : m_Stream(stream) {
+}
+
 VertexBuffer::~VertexBuffer() {
-    glDeleteBuffers(1, &m_RendererID);
+    if (m_RendererID) {
+        GLState::DeleteBuffer(m_RendererID);
+    }
 }
 
 void VertexBuffer::Bind() const {
-    glBindBuffer(GL_ARRAY_BUFFER, m_RendererID);
+    GLState::BindBuffer(GL_ARRAY_BUFFER, GetRendererID());
 }
 
 void VertexBuffer::Unbind() const {
-    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    GLState::BindBuffer(GL_ARRAY_BUFFER, 0);
+}
+
+void VertexBuffer::SetData(const void* data, uint32_t size) {
+    GLState::BindBuffer(GL_ARRAY_BUFFER, m_RendererID);
+    if (size > m_Size) {
+        // Grow geometrically so a slowly increasing instance count does not reallocate every frame
+        m_Size = size > m_Size * 2 ? size : m_Size * 2;
+    }
+    glBufferData(GL_ARRAY_BUFFER, m_Size, nullptr, GL_DYNAMIC_DRAW);
+    glBufferSubData(GL_ARRAY_BUFFER, 0, size, data);
+}
+
+void VertexBuffer::SetSubData(uint32_t offset, const void* data, uint32_t size) {
+    GLState::BindBuffer(GL_ARRAY_BUFFER, m_RendererID);
+    glBufferSubData(GL_ARRAY_BUFFER, offset, size, data);
+}
+
+void VertexBuffer::Resize(uint32_t size) {
+    ResizeBufferStorage(m_RendererID, m_Size, size, GL_DYNAMIC_DRAW);
+    m_Size = size;
 }
 
 // --- IndexBuffer ---
 IndexBuffer::IndexBuffer(const uint32_t* data, uint32_t count) : m_Count(count) {
+    const uint32_t maxIndex = count > 0 ? *std::max_element(data, data + count) : 0;
+    glGenBuffers(1, &m_RendererID);
+    // Upload through the copy target: binding GL_ELEMENT_ARRAY_BUFFER here would
+    // attach the buffer to whichever vertex array happens to be bound
+    GLState::BindBuffer(GL_COPY_WRITE_BUFFER, m_RendererID);
+    if (maxIndex <= 0xFFFF) {
+        std::vector<uint16_t> shortIndices(data, data + count);
+        m_ElementType = GL_UNSIGNED_SHORT;
+        m_ElementSize = sizeof(uint16_t);
+        glBufferData(GL_COPY_WRITE_BUFFER, count * sizeof(uint16_t), shortIndices.data(), GL_STATIC_DRAW);
+    } else {
+        m_ElementType = GL_UNSIGNED_INT;
+        m_ElementSize = sizeof(uint32_t);
+        glBufferData(GL_COPY_WRITE_BUFFER, count * sizeof(uint32_t), data, GL_STATIC_DRAW);
+    }
+}
+
+IndexBuffer::IndexBuffer(uint32_t count, uint32_t elementSize) : m_Count(count), m_ElementSize(elementSize) {
+    m_ElementType = elementSize == sizeof(uint16_t) ? GL_UNSIGNED_SHORT : GL_UNSIGNED_INT;
     glGenBuffers(1, &m_RendererID);
-    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_RendererID);
-    glBufferData(GL_ELEMENT_ARRAY_BUFFER, count * sizeof(uint32_t), data, GL_STATIC_DRAW);
+    GLState::BindBuffer(GL_COPY_WRITE_BUFFER, m_RendererID);
+    glBufferData(GL_COPY_WRITE_BUFFER, static_cast<GLsizeiptr>(count) * elementSize, nullptr, GL_DYNAMIC_DRAW);
 }
 
 IndexBuffer::~IndexBuffer() {
-    glDeleteBuffers(1, &m_RendererID);
+    GLState::DeleteBuffer(m_RendererID);
 }
 
 void IndexBuffer::Bind() const {
-    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_RendererID);
+    GLState::BindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_RendererID);
 }
 
 void IndexBuffer::Unbind() const {
-    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+    GLState::BindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+}
+
+void IndexBuffer::SetSubData(uint32_t firstIndex, const void* indices, uint32_t count) {
+    GLState::BindBuffer(GL_COPY_WRITE_BUFFER, m_RendererID);
+    glBufferSubData(GL_COPY_WRITE_BUFFER, static_cast<GLintptr>(firstIndex) * m_ElementSize, static_cast<GLsizeiptr>(count) * m_ElementSize, indices);
+}
+
+void IndexBuffer::Resize(uint32_t count) {
+    ResizeBufferStorage(m_RendererID, m_Count * m_ElementSize, count * m_ElementSize, GL_DYNAMIC_DRAW);
+    m_Count = count;
 }
\ No newline at end of file
@@ -1,13 +1,19 @@
 // src/Renderer/Buffer.h
 #pragma once
 
+#include "DynamicBuffer.h"
 #include <cstdint>
+#include <memory>
 #include <vector>
 #include <string>
 
 // --- Buffer Layout System ---
 enum class ShaderDataType {
-    None = 0, Float, Float2, Float3, Float4, Mat3, Mat4, Int, Int2, Int3, Int4, Bool
+    None = 0, Float, Float2, Float3, Float4, Mat3, Mat4, Int, Int2, Int3, Int4, Bool,
+    // Compact vertex formats. Read as floats by the shader: either normalized
+    // (BufferElement::Normalized) or as the raw integer values.
+    Half2, Half4, Short2, Short4, UShort2, UShort4,
+    Int1010102 // Signed 10:10:10:2 packed into 32 bits (GL_INT_2_10_10_10_REV)
 };
 
 static uint32_t ShaderDataTypeSize(ShaderDataType type) {
@@ -16,11 +22,21 @@ static uint32_t ShaderDataTypeSize(ShaderDataType type) {
         case ShaderDataType::Float2:   return 4 * 2;
         case ShaderDataType::Float3:   return 4 * 3;
         case ShaderDataType::Float4:   return 4 * 4;
+        case ShaderDataType::Mat3:     return 4 * 3 * 3;
+        case ShaderDataType::Mat4:     return 4 * 4 * 4;
         case ShaderDataType::Int:      return 4;
         case ShaderDataType::Int2:     return 4 * 2;
         case ShaderDataType::Int3:     return 4 * 3;
         case ShaderDataType::Int4:     return 4 * 4;
         case ShaderDataType::Bool:     return 1;
+        case ShaderDataType::Half2:    return 2 * 2;
+        case ShaderDataType::Half4:    return 2 * 4;
+        case ShaderDataType::Short2:   return 2 * 2;
+        case ShaderDataType::Short4:   return 2 * 4;
+        case ShaderDataType::UShort2:  return 2 * 2;
+        case ShaderDataType::UShort4:  return 2 * 4;
+        case ShaderDataType::Int1010102: return 4;
+        case ShaderDataType::None:     return 0;
     }
     return 0;
 }
@@ -32,11 +48,21 @@ static uint32_t ShaderDataTypeComponentCount(ShaderDataType type) {
         case ShaderDataType::Float2:   return 2;
         case ShaderDataType::Float3:   return 3;
         case ShaderDataType::Float4:   return 4;
+        case ShaderDataType::Mat3:     return 3; // Per column (one attribute per column)
+        case ShaderDataType::Mat4:     return 4; // Per column
         case ShaderDataType::Int:      return 1;
         case ShaderDataType::Int2:     return 2;
         case ShaderDataType::Int3:     return 3;
         case ShaderDataType::Int4:     return 4;
         case ShaderDataType::Bool:     return 1;
+        case ShaderDataType::Half2:    return 2;
+        case ShaderDataType::Half4:    return 4;
+        case ShaderDataType::Short2:   return 2;
+        case ShaderDataType::Short4:   return 4;
+        case ShaderDataType::UShort2:  return 2;
+        case ShaderDataType::UShort4:  return 4;
+        case ShaderDataType::Int1010102: return 4;
+        case ShaderDataType::None:     return 0;
     }
     return 0;
 }
@@ -64,9 +90,16 @@ public:
         : m_Elements(elements) {
         CalculateOffsetsAndStride();
     }
+    // instanceDivisor > 0: the attributes advance once every `instanceDivisor`
+    // instances instead of once per vertex (glVertexAttribDivisor)
+    BufferLayout(const std::initializer_list<BufferElement>& elements, uint32_t instanceDivisor)
+        : m_Elements(elements), m_InstanceDivisor(instanceDivisor) {
+        CalculateOffsetsAndStride();
+    }
 
     const std::vector<BufferElement>& GetElements() const { return m_Elements; }
     uint32_t GetStride() const { return m_Stride; }
+    uint32_t GetInstanceDivisor() const { return m_InstanceDivisor; }
 
 private:
     void CalculateOffsetsAndStride() {
@@ -81,35 +114,69 @@ private:
 
     std::vector<BufferElement> m_Elements;
     uint32_t m_Stride = 0;
+    uint32_t m_InstanceDivisor = 0;
 };
 
 class VertexBuffer {
 public:
     VertexBuffer(const void* data, uint32_t size);
+    // Dynamic buffer, filled every frame with SetData (e.g. per-instance data)
+    VertexBuffer(uint32_t size);
+    // Attributes read from a DynamicBuffer, whose storage (and GL name) may
+    // change from one frame to the next. SetData, SetSubData and Resize do
+    // not apply: write through the DynamicBuffer.
+    explicit VertexBuffer(const std::shared_ptr<DynamicBuffer>& stream);
     ~VertexBuffer();
 
     void Bind() const;
     void Unbind() const;
 
+    // Replaces the content, growing the storage if needed. The previous storage
+    // is orphaned so the upload never waits for draws still using it.
+    void SetData(const void* data, uint32_t size);
+    // Writes `size` bytes at `offset` without touching the rest of the storage
+    void SetSubData(uint32_t offset, const void* data, uint32_t size);
+    // Reallocates the storage, keeping the first min(old, new size) bytes
+    void Resize(uint32_t size);
+    uint32_t GetSize() const { return m_Stream ? m_Stream->GetSize() : m_Size; }
+    uint32_t GetRendererID() const { return m_Stream ? m_Stream->GetRendererID() : m_RendererID; }
+    const std::shared_ptr<DynamicBuffer>& GetStream() const { return m_Stream; }
+
     void SetLayout(const BufferLayout& layout) { m_Layout = layout; }
     const BufferLayout& GetLayout() const { return m_Layout; }
 
 private:
-    uint32_t m_RendererID;
+    uint32_t m_RendererID = 0;
+    uint32_t m_Size = 0;
     BufferLayout m_Layout;
+    std::shared_ptr<DynamicBuffer> m_Stream;
 };
 
 class IndexBuffer {
 public:
+    // Stored as 16-bit indices whenever every index fits, 32-bit otherwise
     IndexBuffer(const uint32_t* data, uint32_t count);
+    // Uninitialized storage for `count` indices of `elementSize` bytes (2 or 4),
+    // filled with SetSubData (e.g. a GeometryArena)
+    IndexBuffer(uint32_t count, uint32_t elementSize);
     ~IndexBuffer();
 
     void Bind() const;
     void Unbind() const;
 
     uint32_t GetCount() const { return m_Count; }
+    // GL_UNSIGNED_SHORT or GL_UNSIGNED_INT, as passed to glDrawElements*
+    uint32_t GetElementType() const { return m_ElementType; }
+    uint32_t GetElementSize() const { return m_ElementSize; }
+    uint32_t GetRendererID() const { return m_RendererID; }
+
+    // Same as VertexBuffer, in indices instead of bytes
+    void SetSubData(uint32_t firstIndex, const void* indices, uint32_t count);
+    void Resize(uint32_t count);
 
 private:
     uint32_t m_RendererID;
     uint32_t m_Count;
+    uint32_t m_ElementType;
+    uint32_t m_ElementSize;
 };
\ No newline at end of file
@@ -62,6 +62,16 @@ if (input.IsKeyPressed(SDL_SCANCODE_LCTRL))  {
     }
 }
 
+void Camera::LookAt(const glm::vec3& position, const glm::vec3& target) {
+    // The orientation is the rotation part of the view matrix, as in Update
+    m_Position = position;
+    m_Orientation = glm::normalize(glm::quat_cast(glm::mat3(glm::lookAt(position, target, glm::vec3(0.0f, 1.0f, 0.0f)))));
+    m_Front = glm::conjugate(m_Orientation) * glm::vec3(0.0, 0.0, -1.0);
+    m_Right = glm::conjugate(m_Orientation) * glm::vec3(1.0, 0.0, 0.0);
+    m_Up    = glm::conjugate(m_Orientation) * glm::vec3(0.0, 1.0, 0.0);
+    m_ViewMatrix = glm::mat4_cast(m_Orientation) * glm::translate(glm::mat4(1.0f), -m_Position);
+}
+
 void Camera::UpdateProjectionMatrix() {
     m_ProjectionMatrix = glm::perspective(glm::radians(m_Fov), m_AspectRatio, m_NearClip, m_FarClip);
 }
@@ -11,6 +11,8 @@ public:
     Camera(float fov, float aspectRatio, float near, float far);
 
     void Update(Input& input, float deltaTime);
+    // Places the camera without input (scripted paths, benchmarks)
+    void LookAt(const glm::vec3& position, const glm::vec3& target);
 
     const glm::mat4& GetProjectionMatrix() const { return m_ProjectionMatrix; }
     const glm::mat4& GetViewMatrix() const { return m_ViewMatrix; }
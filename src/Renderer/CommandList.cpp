@@ -0,0 +1,61 @@
+// src/Renderer/CommandList.cpp
+#include "CommandList.h"
+
+void CommandList::Reset() {
+    m_Items.clear();
+    m_CommandCount = 0;
+}
+
+RenderCommand& CommandList::Push(RenderCommandType type) {
+    const uint32_t chunk = m_CommandCount >> CHUNK_SHIFT;
+    if (chunk == m_Chunks.size()) {
+        m_Chunks.push_back(std::make_unique<RenderCommand[]>(CHUNK_SIZE));
+    }
+    RenderCommand& command = m_Chunks[chunk][m_CommandCount & (CHUNK_SIZE - 1)];
+    command.Type = type;
+    m_CommandCount++;
+    m_Items.back().CommandCount++;
+    return command;
+}
+
+void CommandList::BeginItem(uint64_t sortKey) {
+    CommandItem item;
+    item.SortKey = sortKey;
+    item.FirstCommand = m_CommandCount;
+    m_Items.push_back(item);
+}
+
+void CommandList::BindProgram(Shader* program) {
+    Push(RenderCommandType::BindProgram).BindProgram.Program = program;
+}
+
+void CommandList::BindTexture(const Texture* texture, uint32_t slot) {
+    RenderCommand& command = Push(RenderCommandType::BindTexture);
+    command.BindTexture.Image = texture;
+    command.BindTexture.Slot = slot;
+}
+
+void CommandList::BindGeometry(GeometryArena* arena) {
+    Push(RenderCommandType::BindGeometry).BindGeometry.Arena = arena;
+}
+
+void CommandList::SetDequantize(const VertexQuantization* ranges) {
+    Push(RenderCommandType::SetDequantize).SetDequantize.Ranges = ranges;
+}
+
+void CommandList::SetObjectConstants(uint32_t slot) {
+    Push(RenderCommandType::SetObjectConstants).SetObjectConstants.Slot = slot;
+}
+
+void CommandList::DrawIndexed(uint32_t indexCount, uint32_t firstIndex, int32_t baseVertex, uint32_t instanceCount, uint32_t firstInstance) {
+    RenderCommand& command = Push(RenderCommandType::DrawIndexed);
+    command.DrawIndexed.IndexCount = indexCount;
+    command.DrawIndexed.FirstIndex = firstIndex;
+    command.DrawIndexed.BaseVertex = baseVertex;
+    command.DrawIndexed.InstanceCount = instanceCount;
+    command.DrawIndexed.FirstInstance = firstInstance;
+}
+
+size_t CommandList::GetCapacityBytes() const {
+    return m_Chunks.size() * CHUNK_SIZE * sizeof(RenderCommand) + m_Items.capacity() * sizeof(CommandItem);
+}
@@ -0,0 +1,90 @@
+// src/Renderer/CommandList.h
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+class Shader;
+class Texture;
+class GeometryArena;
+struct VertexQuantization;
+
+enum class RenderCommandType : uint8_t {
+    BindProgram,
+    BindTexture,
+    BindGeometry,       // Arena VAO; also the index buffer the next draws read
+    SetDequantize,      // u_Dequantize of the bound program
+    SetObjectConstants, // ObjectConstants ring slot
+    DrawIndexed
+};
+
+// One recorded command. Resources are engine objects, never GL names, and
+// recording calls nothing but plain stores: it reads no GL state and runs on
+// any thread. Only RenderQueue::Execute talks to GL.
+struct RenderCommand {
+    RenderCommandType Type;
+    union {
+        struct { Shader* Program; } BindProgram;
+        struct { const Texture* Image; uint32_t Slot; } BindTexture;
+        struct { GeometryArena* Arena; } BindGeometry;
+        struct { const VertexQuantization* Ranges; } SetDequantize;
+        struct { uint32_t Slot; } SetObjectConstants;
+        // InstanceCount 0: plain draw. FirstIndex counts elements of the arena index buffer.
+        struct { uint32_t IndexCount; uint32_t FirstIndex; int32_t BaseVertex; uint32_t InstanceCount; uint32_t FirstInstance; } DrawIndexed;
+    };
+};
+static_assert(sizeof(RenderCommand) == 32, "RenderCommand should stay compact");
+
+// A sortable run of commands: everything one draw needs, so that the queue
+// can reorder items freely. Binds that repeat the current state are dropped
+// at replay.
+struct CommandItem {
+    uint64_t SortKey = 0; // See RenderQueue::MakeSortKey
+    uint32_t FirstCommand = 0;
+    uint32_t CommandCount = 0;
+};
+
+// Commands recorded by one thread during a frame. Storage is a chain of
+// fixed-size chunks filled linearly: recording never moves earlier commands,
+// and Reset() rewinds without freeing, so a warm list does not allocate.
+//
+// Every command belongs to the item opened by the last BeginItem().
+// A list is not thread-safe: use one per thread (see JobSystem::GetThreadIndex).
+class CommandList {
+public:
+    CommandList() = default;
+    CommandList(const CommandList&) = delete;
+    CommandList& operator=(const CommandList&) = delete;
+    CommandList(CommandList&&) = default;
+    CommandList& operator=(CommandList&&) = default;
+
+    // Drops the commands of the previous frame, keeps the memory
+    void Reset();
+
+    void BeginItem(uint64_t sortKey);
+    void BindProgram(Shader* program);
+    void BindTexture(const Texture* texture, uint32_t slot = 0);
+    void BindGeometry(GeometryArena* arena);
+    void SetDequantize(const VertexQuantization* ranges);
+    void SetObjectConstants(uint32_t slot);
+    void DrawIndexed(uint32_t indexCount, uint32_t firstIndex, int32_t baseVertex, uint32_t instanceCount = 0, uint32_t firstInstance = 0);
+
+    uint32_t GetItemCount() const { return static_cast<uint32_t>(m_Items.size()); }
+    const CommandItem& GetItem(uint32_t index) const { return m_Items[index]; }
+    uint32_t GetCommandCount() const { return m_CommandCount; }
+    const RenderCommand& GetCommand(uint32_t index) const { return m_Chunks[index >> CHUNK_SHIFT][index & (CHUNK_SIZE - 1)]; }
+
+    // Bytes reserved by the command chunks and the item array
+    size_t GetCapacityBytes() const;
+
+private:
+    static constexpr uint32_t CHUNK_SHIFT = 12;
+    static constexpr uint32_t CHUNK_SIZE = 1u << CHUNK_SHIFT; // Commands per chunk (128 KB)
+
+    RenderCommand& Push(RenderCommandType type);
+
+    std::vector<std::unique_ptr<RenderCommand[]>> m_Chunks;
+    std::vector<CommandItem> m_Items;
+    uint32_t m_CommandCount = 0;
+};
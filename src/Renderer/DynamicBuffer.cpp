@@ -0,0 +1,153 @@
+// src/Renderer/DynamicBuffer.cpp
+#include "DynamicBuffer.h"
+#include "GLState.h"
+#include "../Core/Profiler.h"
+#include <glad/glad.h>
+#include <algorithm>
+#include <iostream>
+
+// Granularity of the fence waits: the GPU gets the pending commands on the
+// first one, then the CPU checks again every millisecond
+static constexpr GLuint64 FENCE_WAIT_TIMEOUT_NS = 1000000;
+
+static uint32_t AlignUp(uint32_t value, uint32_t alignment) {
+    return (value + alignment - 1) / alignment * alignment;
+}
+
+DynamicBuffer::DynamicBuffer(uint32_t regionSize, uint32_t alignment)
+    : m_Alignment(std::max(1u, alignment)) {
+    m_RegionSize = AlignUp(std::max(1u, regionSize), m_Alignment);
+    m_Persistent = IsPersistentMappingSupported();
+    m_RegionCount = m_Persistent ? FRAMES_IN_FLIGHT : 1;
+    m_Stats.Persistent = m_Persistent;
+    CreateStorage();
+}
+
+DynamicBuffer::~DynamicBuffer() {
+    ReleaseStorage();
+}
+
+bool DynamicBuffer::IsPersistentMappingSupported() {
+    return GLAD_GL_VERSION_4_4 != 0;
+}
+
+void DynamicBuffer::CreateStorage() {
+    glGenBuffers(1, &m_RendererID);
+    // Copy target: the vertex array and uniform bindings are left alone
+    GLState::BindBuffer(GL_COPY_WRITE_BUFFER, m_RendererID);
+    const GLsizeiptr size = static_cast<GLsizeiptr>(m_RegionSize) * m_RegionCount;
+    if (m_Persistent) {
+        const GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+        glBufferStorage(GL_COPY_WRITE_BUFFER, size, nullptr, flags);
+        m_Mapping = static_cast<uint8_t*>(glMapBufferRange(GL_COPY_WRITE_BUFFER, 0, size, flags));
+        if (m_Mapping) {
+            m_Stats.RegionSize = m_RegionSize;
+            return;
+        }
+        // Storage is immutable: start over with a mutable one
+        std::cerr << "DynamicBuffer: persistent mapping failed, falling back to orphaning" << std::endl;
+        GLState::DeleteBuffer(m_RendererID);
+        m_Persistent = false;
+        m_RegionCount = 1;
+        m_Stats.Persistent = false;
+        glGenBuffers(1, &m_RendererID);
+        GLState::BindBuffer(GL_COPY_WRITE_BUFFER, m_RendererID);
+    }
+    glBufferData(GL_COPY_WRITE_BUFFER, m_RegionSize, nullptr, GL_STREAM_DRAW);
+    m_Staging.resize(m_RegionSize);
+    m_Stats.RegionSize = m_RegionSize;
+}
+
+void DynamicBuffer::ReleaseStorage() {
+    for (void*& fence : m_Fences) {
+        if (fence) {
+            glDeleteSync(static_cast<GLsync>(fence));
+            fence = nullptr;
+        }
+    }
+    if (m_Mapping) {
+        GLState::BindBuffer(GL_COPY_WRITE_BUFFER, m_RendererID);
+        glUnmapBuffer(GL_COPY_WRITE_BUFFER);
+        m_Mapping = nullptr;
+    }
+    // Draws still in flight keep the storage alive on the GL side
+    GLState::DeleteBuffer(m_RendererID);
+    m_RendererID = 0;
+}
+
+void DynamicBuffer::BeginFrame(uint32_t size) {
+    m_RegionOffset = 0;
+    m_Stats.BytesAllocated = 0;
+    m_Stats.LastFenceWaitNs = 0;
+
+    if (size > m_RegionSize) {
+        // Grow geometrically, as VertexBuffer::SetData. A new storage has no
+        // region in use: no fence to wait for.
+        ReleaseStorage();
+        m_RegionSize = AlignUp(std::max(size, m_RegionSize * 2), m_Alignment);
+        m_Region = 0;
+        m_Stats.Reallocations++;
+        CreateStorage();
+        return;
+    }
+
+    m_Region = (m_Region + 1) % m_RegionCount;
+    GLsync fence = static_cast<GLsync>(m_Fences[m_Region]);
+    if (!fence) {
+        return;
+    }
+    GLenum status = glClientWaitSync(fence, 0, 0);
+    if (status == GL_TIMEOUT_EXPIRED) {
+        // The GPU is more than FRAMES_IN_FLIGHT frames behind
+        PLUME_PROFILE_SCOPE("Fence wait");
+        const uint64_t start = Profiler::GetTime();
+        do {
+            status = glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, FENCE_WAIT_TIMEOUT_NS);
+        } while (status == GL_TIMEOUT_EXPIRED);
+        const uint64_t waited = Profiler::GetTime() - start;
+        m_Stats.FenceWaits++;
+        m_Stats.FenceWaitNs += waited;
+        m_Stats.LastFenceWaitNs = waited;
+    }
+    if (status == GL_WAIT_FAILED) {
+        std::cerr << "DynamicBuffer: glClientWaitSync failed" << std::endl;
+    }
+    glDeleteSync(fence);
+    m_Fences[m_Region] = nullptr;
+}
+
+DynamicAllocation DynamicBuffer::Allocate(uint32_t size) {
+    DynamicAllocation allocation;
+    const uint32_t alignedSize = AlignUp(size, m_Alignment);
+    if (alignedSize > m_RegionSize - m_RegionOffset) {
+        return allocation;
+    }
+    if (m_Persistent) {
+        allocation.Offset = m_Region * m_RegionSize + m_RegionOffset;
+        allocation.Data = m_Mapping + allocation.Offset;
+    } else {
+        allocation.Offset = m_RegionOffset;
+        allocation.Data = m_Staging.data() + m_RegionOffset;
+    }
+    m_RegionOffset += alignedSize;
+    m_Stats.BytesAllocated = m_RegionOffset;
+    return allocation;
+}
+
+void DynamicBuffer::Flush() {
+    // Coherent mapping: the writes are already visible to the next commands
+    if (m_Persistent || m_RegionOffset == 0) {
+        return;
+    }
+    GLState::BindBuffer(GL_COPY_WRITE_BUFFER, m_RendererID);
+    // Orphan the previous frame's storage so this upload never waits on the GPU
+    glBufferData(GL_COPY_WRITE_BUFFER, m_RegionSize, nullptr, GL_STREAM_DRAW);
+    glBufferSubData(GL_COPY_WRITE_BUFFER, 0, m_RegionOffset, m_Staging.data());
+}
+
+void DynamicBuffer::EndFrame() {
+    if (!m_Persistent || m_RegionOffset == 0) {
+        return;
+    }
+    m_Fences[m_Region] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+}
@@ -0,0 +1,86 @@
+// src/Renderer/DynamicBuffer.h
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+struct DynamicBufferStats {
+    bool Persistent = false;       // glBufferStorage mapping; orphaning otherwise
+    uint32_t RegionSize = 0;       // Bytes available to one frame
+    uint32_t BytesAllocated = 0;   // Last frame
+    uint32_t Reallocations = 0;    // Storage grown since creation
+    uint64_t FenceWaits = 0;       // Frames whose region was still read by the GPU
+    uint64_t FenceWaitNs = 0;      // Time the CPU spent blocked in those waits
+    uint64_t LastFenceWaitNs = 0;  // Same, last frame only
+};
+
+// Where Allocate placed the bytes: write them through Data, point the GPU at
+// Offset (from the start of the buffer)
+struct DynamicAllocation {
+    uint8_t* Data = nullptr;
+    uint32_t Offset = 0;
+};
+
+// Per-frame dynamic data (instances, particles, debug lines) written by the
+// CPU every frame and read by the GPU once.
+//
+// With GL 4.4 the storage is created with glBufferStorage and stays mapped
+// (persistent, coherent): allocations point straight into GPU-visible memory,
+// nothing is copied. The storage holds FRAMES_IN_FLIGHT regions used in
+// turn; a fence placed after the frame's draws tells when the GPU is done
+// with a region, and BeginFrame only waits when it comes back to a region
+// that is still in use (see DynamicBufferStats::FenceWaits).
+// Older contexts get one region in CPU memory, sent by Flush after orphaning
+// the previous storage, like VertexBuffer::SetData.
+//
+// The GL name changes when the storage grows: read it again after BeginFrame.
+// GL calls happen on the GL thread only; the bytes of an allocation may be
+// written from any thread until Flush.
+class DynamicBuffer {
+public:
+    static constexpr uint32_t FRAMES_IN_FLIGHT = 3;
+
+    // Regions start, and allocations are rounded, at multiples of `alignment`
+    // (any value: e.g. a vertex stride, or GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT)
+    DynamicBuffer(uint32_t regionSize, uint32_t alignment = 1);
+    ~DynamicBuffer();
+
+    DynamicBuffer(const DynamicBuffer&) = delete;
+    DynamicBuffer& operator=(const DynamicBuffer&) = delete;
+
+    // Moves to the next region, waiting for the GPU if it still reads it.
+    // `size`: bytes the frame is about to allocate, growing the regions if
+    // they are too small.
+    void BeginFrame(uint32_t size = 0);
+    // `size` bytes of the frame's region; Data is null when the region is full
+    DynamicAllocation Allocate(uint32_t size);
+    // Makes the frame's bytes visible to the GPU, before the draws that read them
+    void Flush();
+    // After the last draw that reads the frame's bytes: fences the region
+    void EndFrame();
+
+    uint32_t GetRendererID() const { return m_RendererID; }
+    // Whole storage, every region included
+    uint32_t GetSize() const { return m_RegionSize * m_RegionCount; }
+    const DynamicBufferStats& GetStats() const { return m_Stats; }
+
+    // GL 4.4 (glBufferStorage, persistent mapping); needs a current context
+    static bool IsPersistentMappingSupported();
+
+private:
+    void CreateStorage();
+    void ReleaseStorage();
+
+    uint32_t m_RendererID = 0;
+    uint32_t m_Alignment;
+    uint32_t m_RegionSize;
+    uint32_t m_RegionCount;
+    bool m_Persistent;
+
+    uint32_t m_Region = 0;       // Region of the current frame
+    uint32_t m_RegionOffset = 0; // Bytes allocated in it
+    uint8_t* m_Mapping = nullptr;       // Persistent: the whole storage
+    std::vector<uint8_t> m_Staging;     // Orphaning: the single region
+    void* m_Fences[FRAMES_IN_FLIGHT] = {}; // GLsync of each region, null once waited for
+    DynamicBufferStats m_Stats;
+};
@@ -0,0 +1,143 @@
+// src/Renderer/Frustum.cpp
+#include "Frustum.h"
+#include <cmath>
+
+#if defined(__AVX__)
+    #include <immintrin.h>
+    #define PLUME_FRUSTUM_AVX 1
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #include <emmintrin.h>
+    #define PLUME_FRUSTUM_SSE 1
+#endif
+
+Frustum::Frustum(const glm::mat4& viewProjection) {
+    Update(viewProjection);
+}
+
+void Frustum::Update(const glm::mat4& m) {
+    // Rows of the (column-major) matrix
+    glm::vec4 row0(m[0][0], m[1][0], m[2][0], m[3][0]);
+    glm::vec4 row1(m[0][1], m[1][1], m[2][1], m[3][1]);
+    glm::vec4 row2(m[0][2], m[1][2], m[2][2], m[3][2]);
+    glm::vec4 row3(m[0][3], m[1][3], m[2][3], m[3][3]);
+
+    m_Planes[0] = row3 + row0; // Left
+    m_Planes[1] = row3 - row0; // Right
+    m_Planes[2] = row3 + row1; // Bottom
+    m_Planes[3] = row3 - row1; // Top
+    m_Planes[4] = row3 + row2; // Near (OpenGL clip space: -w <= z)
+    m_Planes[5] = row3 - row2; // Far
+
+    for (int i = 0; i < 6; i++) {
+        float length = glm::length(glm::vec3(m_Planes[i]));
+        if (length > 0.0f) {
+            m_Planes[i] /= length;
+        }
+    }
+
+    for (int lane = 0; lane < 8; lane++) {
+        const glm::vec4& plane = m_Planes[lane < 6 ? lane : lane - 6];
+        m_NormalX[lane] = plane.x;
+        m_NormalY[lane] = plane.y;
+        m_NormalZ[lane] = plane.z;
+        m_AbsNormalX[lane] = std::fabs(plane.x);
+        m_AbsNormalY[lane] = std::fabs(plane.y);
+        m_AbsNormalZ[lane] = std::fabs(plane.z);
+        m_Distance[lane] = plane.w;
+    }
+}
+
+bool Frustum::Intersects(const AABB& box) const {
+    glm::vec3 center = box.GetCenter();
+    glm::vec3 extents = box.GetExtents();
+    for (int i = 0; i < 6; i++) {
+        const glm::vec4& plane = m_Planes[i];
+        float distance = glm::dot(glm::vec3(plane), center) + plane.w;
+        float radius = glm::dot(glm::abs(glm::vec3(plane)), extents);
+        if (distance + radius < 0.0f) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool Frustum::Intersects(const BoundingSphere& sphere) const {
+    for (int i = 0; i < 6; i++) {
+        const glm::vec4& plane = m_Planes[i];
+        if (glm::dot(glm::vec3(plane), sphere.Center) + plane.w < -sphere.Radius) {
+            return false;
+        }
+    }
+    return true;
+}
+
+size_t Frustum::Cull(const AABB* boxes, size_t count, uint8_t* outVisible) const {
+    size_t visibleCount = 0;
+
+#if defined(PLUME_FRUSTUM_AVX)
+    // One box per iteration, the 8 lanes hold the 6 planes
+    const __m256 nx = _mm256_load_ps(m_NormalX), ny = _mm256_load_ps(m_NormalY), nz = _mm256_load_ps(m_NormalZ);
+    const __m256 ax = _mm256_load_ps(m_AbsNormalX), ay = _mm256_load_ps(m_AbsNormalY), az = _mm256_load_ps(m_AbsNormalZ);
+    const __m256 d = _mm256_load_ps(m_Distance);
+    const __m256 half = _mm256_set1_ps(0.5f);
+    const __m256 zero = _mm256_setzero_ps();
+    for (size_t i = 0; i < count; i++) {
+        const AABB& box = boxes[i];
+        __m256 minX = _mm256_set1_ps(box.Min.x), minY = _mm256_set1_ps(box.Min.y), minZ = _mm256_set1_ps(box.Min.z);
+        __m256 maxX = _mm256_set1_ps(box.Max.x), maxY = _mm256_set1_ps(box.Max.y), maxZ = _mm256_set1_ps(box.Max.z);
+        __m256 cx = _mm256_mul_ps(_mm256_add_ps(minX, maxX), half);
+        __m256 cy = _mm256_mul_ps(_mm256_add_ps(minY, maxY), half);
+        __m256 cz = _mm256_mul_ps(_mm256_add_ps(minZ, maxZ), half);
+        __m256 ex = _mm256_mul_ps(_mm256_sub_ps(maxX, minX), half);
+        __m256 ey = _mm256_mul_ps(_mm256_sub_ps(maxY, minY), half);
+        __m256 ez = _mm256_mul_ps(_mm256_sub_ps(maxZ, minZ), half);
+
+        // distance(center) + projected radius, for every plane at once
+        __m256 dist = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(nx, cx), _mm256_mul_ps(ny, cy)), _mm256_add_ps(_mm256_mul_ps(nz, cz), d));
+        __m256 radius = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(ax, ex), _mm256_mul_ps(ay, ey)), _mm256_mul_ps(az, ez));
+        int outside = _mm256_movemask_ps(_mm256_cmp_ps(_mm256_add_ps(dist, radius), zero, _CMP_LT_OQ));
+
+        uint8_t visible = outside == 0 ? 1 : 0;
+        outVisible[i] = visible;
+        visibleCount += visible;
+    }
+#elif defined(PLUME_FRUSTUM_SSE)
+    // One box per iteration, planes 0-3 then planes 4-5 (+ 0-1 again)
+    const __m128 nx0 = _mm_load_ps(m_NormalX), ny0 = _mm_load_ps(m_NormalY), nz0 = _mm_load_ps(m_NormalZ);
+    const __m128 nx1 = _mm_load_ps(m_NormalX + 4), ny1 = _mm_load_ps(m_NormalY + 4), nz1 = _mm_load_ps(m_NormalZ + 4);
+    const __m128 ax0 = _mm_load_ps(m_AbsNormalX), ay0 = _mm_load_ps(m_AbsNormalY), az0 = _mm_load_ps(m_AbsNormalZ);
+    const __m128 ax1 = _mm_load_ps(m_AbsNormalX + 4), ay1 = _mm_load_ps(m_AbsNormalY + 4), az1 = _mm_load_ps(m_AbsNormalZ + 4);
+    const __m128 d0 = _mm_load_ps(m_Distance), d1 = _mm_load_ps(m_Distance + 4);
+    const __m128 half = _mm_set1_ps(0.5f);
+    const __m128 zero = _mm_setzero_ps();
+    for (size_t i = 0; i < count; i++) {
+        const AABB& box = boxes[i];
+        __m128 minX = _mm_set1_ps(box.Min.x), minY = _mm_set1_ps(box.Min.y), minZ = _mm_set1_ps(box.Min.z);
+        __m128 maxX = _mm_set1_ps(box.Max.x), maxY = _mm_set1_ps(box.Max.y), maxZ = _mm_set1_ps(box.Max.z);
+        __m128 cx = _mm_mul_ps(_mm_add_ps(minX, maxX), half);
+        __m128 cy = _mm_mul_ps(_mm_add_ps(minY, maxY), half);
+        __m128 cz = _mm_mul_ps(_mm_add_ps(minZ, maxZ), half);
+        __m128 ex = _mm_mul_ps(_mm_sub_ps(maxX, minX), half);
+        __m128 ey = _mm_mul_ps(_mm_sub_ps(maxY, minY), half);
+        __m128 ez = _mm_mul_ps(_mm_sub_ps(maxZ, minZ), half);
+
+        __m128 dist0 = _mm_add_ps(_mm_add_ps(_mm_mul_ps(nx0, cx), _mm_mul_ps(ny0, cy)), _mm_add_ps(_mm_mul_ps(nz0, cz), d0));
+        __m128 radius0 = _mm_add_ps(_mm_add_ps(_mm_mul_ps(ax0, ex), _mm_mul_ps(ay0, ey)), _mm_mul_ps(az0, ez));
+        __m128 dist1 = _mm_add_ps(_mm_add_ps(_mm_mul_ps(nx1, cx), _mm_mul_ps(ny1, cy)), _mm_add_ps(_mm_mul_ps(nz1, cz), d1));
+        __m128 radius1 = _mm_add_ps(_mm_add_ps(_mm_mul_ps(ax1, ex), _mm_mul_ps(ay1, ey)), _mm_mul_ps(az1, ez));
+        __m128 outside = _mm_or_ps(_mm_cmplt_ps(_mm_add_ps(dist0, radius0), zero), _mm_cmplt_ps(_mm_add_ps(dist1, radius1), zero));
+
+        uint8_t visible = _mm_movemask_ps(outside) == 0 ? 1 : 0;
+        outVisible[i] = visible;
+        visibleCount += visible;
+    }
+#else
+    for (size_t i = 0; i < count; i++) {
+        uint8_t visible = Intersects(boxes[i]) ? 1 : 0;
+        outVisible[i] = visible;
+        visibleCount += visible;
+    }
+#endif
+
+    return visibleCount;
+}
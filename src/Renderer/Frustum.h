@@ -0,0 +1,40 @@
+// src/Renderer/Frustum.h
+#pragma once
+
+#include "Bounds.h"
+#include <glm/glm.hpp>
+#include <cstddef>
+#include <cstdint>
+
+// View frustum extracted from a projection * view matrix (Gribb/Hartmann).
+// Planes point inward: a point p is inside when dot(plane.xyz, p) + plane.w >= 0.
+class Frustum {
+public:
+    Frustum() = default;
+    explicit Frustum(const glm::mat4& viewProjection);
+
+    void Update(const glm::mat4& viewProjection);
+
+    bool Intersects(const AABB& box) const;
+    bool Intersects(const BoundingSphere& sphere) const;
+
+    // Tests `count` boxes against the six planes with SIMD (AVX when compiled
+    // in, SSE otherwise). Writes 1 (visible) or 0 (culled) per box and returns
+    // the number of visible boxes. Conservative: boxes straddling a frustum
+    // corner may be reported visible.
+    size_t Cull(const AABB* boxes, size_t count, uint8_t* outVisible) const;
+
+    const glm::vec4& GetPlane(int index) const { return m_Planes[index]; }
+
+private:
+    glm::vec4 m_Planes[6];
+
+    // Planes transposed for SIMD: 8 lanes, lanes 6 and 7 repeat planes 0 and 1
+    alignas(32) float m_NormalX[8];
+    alignas(32) float m_NormalY[8];
+    alignas(32) float m_NormalZ[8];
+    alignas(32) float m_AbsNormalX[8];
+    alignas(32) float m_AbsNormalY[8];
+    alignas(32) float m_AbsNormalZ[8];
+    alignas(32) float m_Distance[8];
+};
@@ -0,0 +1,287 @@
+// src/Renderer/GLState.cpp
+#include "GLState.h"
+#include <glad/glad.h>
+
+// Value meaning "unknown": the next bind always goes through
+static constexpr uint32_t UNKNOWN_BINDING = 0xFFFFFFFFu;
+static constexpr uint32_t MAX_TEXTURE_SLOTS = 32;
+static constexpr uint32_t MAX_INDEXED_BINDINGS = 16;
+
+// Buffer targets tracked by the cache; others are passed through
+enum BufferTargetIndex {
+    ArrayBufferIndex = 0,
+    ElementArrayBufferIndex,
+    UniformBufferIndex,
+    PixelUnpackBufferIndex,
+    CopyReadBufferIndex,
+    CopyWriteBufferIndex,
+    DrawIndirectBufferIndex,
+    ShaderStorageBufferIndex,
+    TextureBufferIndex,
+    BufferTargetCount
+};
+
+// Texture targets tracked per slot
+enum TextureTargetIndex {
+    Texture2DIndex = 0,
+    TextureBufferTargetIndex,
+    TextureTargetCount
+};
+
+struct IndexedBinding {
+    uint32_t Buffer = UNKNOWN_BINDING;
+    intptr_t Offset = 0;
+    intptr_t Size = 0;
+};
+
+static uint32_t s_Program = UNKNOWN_BINDING;
+static uint32_t s_VertexArray = UNKNOWN_BINDING;
+static uint32_t s_ActiveSlot = UNKNOWN_BINDING;
+static uint32_t s_Buffers[BufferTargetCount];
+static uint32_t s_Textures[MAX_TEXTURE_SLOTS][TextureTargetCount];
+static IndexedBinding s_UniformBindings[MAX_INDEXED_BINDINGS];
+static IndexedBinding s_StorageBindings[MAX_INDEXED_BINDINGS];
+static bool s_Initialized = false;
+
+#ifdef NDEBUG
+static bool s_DebugMode = false;
+#else
+static bool s_DebugMode = true;
+#endif
+static GLStateStats s_Stats;
+
+static void EnsureInitialized() {
+    if (!s_Initialized) {
+        GLState::Invalidate();
+    }
+}
+
+static void Count(GLStateCounter& counter, bool issued) {
+    if (s_DebugMode) {
+        if (issued) {
+            counter.Issued++;
+        } else {
+            counter.Elided++;
+        }
+    }
+}
+
+static int GetBufferTargetIndex(uint32_t target) {
+    switch (target) {
+        case GL_ARRAY_BUFFER:          return ArrayBufferIndex;
+        case GL_ELEMENT_ARRAY_BUFFER:  return ElementArrayBufferIndex;
+        case GL_UNIFORM_BUFFER:        return UniformBufferIndex;
+        case GL_PIXEL_UNPACK_BUFFER:   return PixelUnpackBufferIndex;
+        case GL_COPY_READ_BUFFER:      return CopyReadBufferIndex;
+        case GL_COPY_WRITE_BUFFER:     return CopyWriteBufferIndex;
+        case GL_DRAW_INDIRECT_BUFFER:  return DrawIndirectBufferIndex;
+        case GL_SHADER_STORAGE_BUFFER: return ShaderStorageBufferIndex;
+        case GL_TEXTURE_BUFFER:        return TextureBufferIndex;
+    }
+    return -1;
+}
+
+static int GetTextureTargetIndex(uint32_t target) {
+    switch (target) {
+        case GL_TEXTURE_2D:     return Texture2DIndex;
+        case GL_TEXTURE_BUFFER: return TextureBufferTargetIndex;
+    }
+    return -1;
+}
+
+static IndexedBinding* GetIndexedBinding(uint32_t target, uint32_t index) {
+    if (index >= MAX_INDEXED_BINDINGS) {
+        return nullptr;
+    }
+    switch (target) {
+        case GL_UNIFORM_BUFFER:        return &s_UniformBindings[index];
+        case GL_SHADER_STORAGE_BUFFER: return &s_StorageBindings[index];
+    }
+    return nullptr;
+}
+
+void GLState::UseProgram(uint32_t program) {
+    EnsureInitialized();
+    bool issue = program != s_Program;
+    if (issue) {
+        glUseProgram(program);
+        s_Program = program;
+    }
+    Count(s_Stats.Program, issue);
+}
+
+void GLState::BindVertexArray(uint32_t vertexArray) {
+    EnsureInitialized();
+    bool issue = vertexArray != s_VertexArray;
+    if (issue) {
+        glBindVertexArray(vertexArray);
+        s_VertexArray = vertexArray;
+        // The element buffer binding is part of the VAO state
+        s_Buffers[ElementArrayBufferIndex] = UNKNOWN_BINDING;
+    }
+    Count(s_Stats.VertexArray, issue);
+}
+
+void GLState::BindBuffer(uint32_t target, uint32_t buffer) {
+    EnsureInitialized();
+    int index = GetBufferTargetIndex(target);
+    bool issue = index < 0 || s_Buffers[index] != buffer;
+    if (issue) {
+        glBindBuffer(target, buffer);
+        if (index >= 0) {
+            s_Buffers[index] = buffer;
+        }
+    }
+    Count(s_Stats.Buffer, issue);
+}
+
+void GLState::BindBufferBase(uint32_t target, uint32_t index, uint32_t buffer) {
+    EnsureInitialized();
+    IndexedBinding* binding = GetIndexedBinding(target, index);
+    bool issue = !binding || binding->Buffer != buffer || binding->Size != 0;
+    if (issue) {
+        glBindBufferBase(target, index, buffer);
+        if (binding) {
+            *binding = { buffer, 0, 0 };
+        }
+        int targetIndex = GetBufferTargetIndex(target);
+        if (targetIndex >= 0) {
+            s_Buffers[targetIndex] = buffer;
+        }
+    }
+    Count(s_Stats.Buffer, issue);
+}
+
+void GLState::BindBufferRange(uint32_t target, uint32_t index, uint32_t buffer, intptr_t offset, intptr_t size) {
+    EnsureInitialized();
+    IndexedBinding* binding = GetIndexedBinding(target, index);
+    bool issue = !binding || binding->Buffer != buffer || binding->Offset != offset || binding->Size != size;
+    if (issue) {
+        glBindBufferRange(target, index, buffer, static_cast<GLintptr>(offset), static_cast<GLsizeiptr>(size));
+        if (binding) {
+            *binding = { buffer, offset, size };
+        }
+        int targetIndex = GetBufferTargetIndex(target);
+        if (targetIndex >= 0) {
+            s_Buffers[targetIndex] = buffer;
+        }
+    }
+    Count(s_Stats.Buffer, issue);
+}
+
+void GLState::BindTexture(uint32_t slot, uint32_t target, uint32_t texture) {
+    EnsureInitialized();
+    int targetIndex = GetTextureTargetIndex(target);
+    bool tracked = slot < MAX_TEXTURE_SLOTS && targetIndex >= 0;
+    if (tracked && s_Textures[slot][targetIndex] == texture) {
+        Count(s_Stats.Texture, false);
+        return;
+    }
+
+    bool switchSlot = slot != s_ActiveSlot;
+    if (switchSlot) {
+        glActiveTexture(GL_TEXTURE0 + slot);
+        s_ActiveSlot = slot;
+    }
+    Count(s_Stats.ActiveTexture, switchSlot);
+
+    glBindTexture(target, texture);
+    if (tracked) {
+        s_Textures[slot][targetIndex] = texture;
+    }
+    Count(s_Stats.Texture, true);
+}
+
+void GLState::DeleteProgram(uint32_t program) {
+    EnsureInitialized();
+    glDeleteProgram(program);
+    // A program stays in use after deletion, but its name may be handed out again
+    if (s_Program == program) {
+        s_Program = UNKNOWN_BINDING;
+    }
+}
+
+void GLState::DeleteBuffer(uint32_t buffer) {
+    EnsureInitialized();
+    glDeleteBuffers(1, &buffer);
+    // GL reverts the bindings of a deleted buffer to 0 (the element binding
+    // only for the bound VAO, so it becomes unknown)
+    for (int i = 0; i < BufferTargetCount; i++) {
+        if (s_Buffers[i] == buffer) {
+            s_Buffers[i] = 0;
+        }
+    }
+    s_Buffers[ElementArrayBufferIndex] = UNKNOWN_BINDING;
+    for (uint32_t i = 0; i < MAX_INDEXED_BINDINGS; i++) {
+        if (s_UniformBindings[i].Buffer == buffer) {
+            s_UniformBindings[i] = IndexedBinding();
+        }
+        if (s_StorageBindings[i].Buffer == buffer) {
+            s_StorageBindings[i] = IndexedBinding();
+        }
+    }
+}
+
+void GLState::DeleteVertexArray(uint32_t vertexArray) {
+    EnsureInitialized();
+    glDeleteVertexArrays(1, &vertexArray);
+    if (s_VertexArray == vertexArray) {
+        s_VertexArray = 0;
+        s_Buffers[ElementArrayBufferIndex] = UNKNOWN_BINDING;
+    }
+}
+
+void GLState::DeleteTexture(uint32_t texture) {
+    EnsureInitialized();
+    glDeleteTextures(1, &texture);
+    for (uint32_t slot = 0; slot < MAX_TEXTURE_SLOTS; slot++) {
+        for (int target = 0; target < TextureTargetCount; target++) {
+            if (s_Textures[slot][target] == texture) {
+                s_Textures[slot][target] = 0;
+            }
+        }
+    }
+}
+
+uint32_t GLState::GetProgram() {
+    return s_Program;
+}
+
+uint32_t GLState::GetVertexArray() {
+    return s_VertexArray;
+}
+
+void GLState::Invalidate() {
+    s_Program = UNKNOWN_BINDING;
+    s_VertexArray = UNKNOWN_BINDING;
+    s_ActiveSlot = UNKNOWN_BINDING;
+    for (int i = 0; i < BufferTargetCount; i++) {
+        s_Buffers[i] = UNKNOWN_BINDING;
+    }
+    for (uint32_t slot = 0; slot < MAX_TEXTURE_SLOTS; slot++) {
+        for (int target = 0; target < TextureTargetCount; target++) {
+            s_Textures[slot][target] = UNKNOWN_BINDING;
+        }
+    }
+    for (uint32_t i = 0; i < MAX_INDEXED_BINDINGS; i++) {
+        s_UniformBindings[i] = IndexedBinding();
+        s_StorageBindings[i] = IndexedBinding();
+    }
+    s_Initialized = true;
+}
+
+void GLState::SetDebugMode(bool enabled) {
+    s_DebugMode = enabled;
+}
+
+bool GLState::IsDebugMode() {
+    return s_DebugMode;
+}
+
+const GLStateStats& GLState::GetStats() {
+    return s_Stats;
+}
+
+void GLState::ResetStats() {
+    s_Stats = GLStateStats();
+}
@@ -0,0 +1,52 @@
+// src/Renderer/GLState.h
+#pragma once
+
+#include <cstdint>
+
+struct GLStateCounter {
+    uint64_t Issued = 0; // Calls that reached the driver
+    uint64_t Elided = 0; // Calls dropped because the state was already current
+};
+
+struct GLStateStats {
+    GLStateCounter Program;
+    GLStateCounter VertexArray;
+    GLStateCounter Buffer;
+    GLStateCounter Texture;
+    GLStateCounter ActiveTexture;
+};
+
+// Shadow copy of the GL bindings. Every bind in the renderer (Shader,
+// VertexArray, buffers, textures) goes through here, so a bind that would not
+// change anything never reaches the driver. Single context, main thread only.
+//
+// Objects must be deleted through the Delete* functions (GL silently unbinds
+// deleted names, and names are reused). Call Invalidate() after any code that
+// binds objects behind the cache's back.
+class GLState {
+public:
+    static void UseProgram(uint32_t program);
+    static void BindVertexArray(uint32_t vertexArray);
+    static void BindBuffer(uint32_t target, uint32_t buffer);
+    // glBindBufferBase/Range; also updates the generic binding of `target`
+    static void BindBufferBase(uint32_t target, uint32_t index, uint32_t buffer);
+    static void BindBufferRange(uint32_t target, uint32_t index, uint32_t buffer, intptr_t offset, intptr_t size);
+    static void BindTexture(uint32_t slot, uint32_t target, uint32_t texture);
+
+    static void DeleteProgram(uint32_t program);
+    static void DeleteBuffer(uint32_t buffer);
+    static void DeleteVertexArray(uint32_t vertexArray);
+    static void DeleteTexture(uint32_t texture);
+
+    static uint32_t GetProgram();
+    static uint32_t GetVertexArray();
+
+    // Forgets everything: the next bind of each kind goes to the driver
+    static void Invalidate();
+
+    // Debug mode counts issued/elided calls (on by default in debug builds)
+    static void SetDebugMode(bool enabled);
+    static bool IsDebugMode();
+    static const GLStateStats& GetStats();
+    static void ResetStats();
+};
@@ -0,0 +1,222 @@
+// src/Renderer/GeometryArena.cpp
+#include "GeometryArena.h"
+#include "GLState.h"
+#include <glad/glad.h>
+#include <algorithm>
+#include <iostream>
+
+// Replays OffsetAllocator::Defragment on the GPU. Blocks only move down and,
+// from the first moved one on, every block moves: they are gathered in a
+// staging buffer, then copied back in one go (a buffer cannot be copied onto
+// an overlapping range of itself).
+static void ApplyRelocations(uint32_t buffer, const std::vector<OffsetRelocation>& relocations, uint32_t elementSize) {
+    if (relocations.empty()) {
+        return;
+    }
+    const GLintptr start = static_cast<GLintptr>(relocations.front().NewOffset) * elementSize;
+    const GLsizeiptr size = static_cast<GLintptr>(relocations.back().NewOffset + relocations.back().Size) * elementSize - start;
+
+    uint32_t staging = 0;
+    glGenBuffers(1, &staging);
+    GLState::BindBuffer(GL_COPY_WRITE_BUFFER, staging);
+    glBufferData(GL_COPY_WRITE_BUFFER, size, nullptr, GL_STREAM_COPY);
+    GLState::BindBuffer(GL_COPY_READ_BUFFER, buffer);
+    for (const OffsetRelocation& relocation : relocations) {
+        glCopyBufferSubData(GL_COPY_READ_BUFFER, GL_COPY_WRITE_BUFFER,
+                            static_cast<GLintptr>(relocation.OldOffset) * elementSize,
+                            static_cast<GLintptr>(relocation.NewOffset) * elementSize - start,
+                            static_cast<GLsizeiptr>(relocation.Size) * elementSize);
+    }
+    GLState::BindBuffer(GL_COPY_READ_BUFFER, staging);
+    GLState::BindBuffer(GL_COPY_WRITE_BUFFER, buffer);
+    glCopyBufferSubData(GL_COPY_READ_BUFFER, GL_COPY_WRITE_BUFFER, 0, start, size);
+    GLState::DeleteBuffer(staging);
+}
+
+// Doubles `capacity` until `count` more elements fit; 0 past the 4 GiB a GL buffer size can address here
+static uint32_t GrownCapacity(uint32_t capacity, uint32_t count, uint32_t elementSize) {
+    uint64_t grown = std::max<uint64_t>(static_cast<uint64_t>(capacity) * 2, static_cast<uint64_t>(capacity) + count);
+    if (grown * elementSize > UINT32_MAX) {
+        grown = UINT32_MAX / elementSize;
+    }
+    return grown >= static_cast<uint64_t>(capacity) + count ? static_cast<uint32_t>(grown) : 0;
+}
+
+// --- GeometryAllocation ---
+
+GeometryAllocation::~GeometryAllocation() {
+    m_Arena.Free(m_Handle);
+}
+
+const GeometryRange& GeometryAllocation::GetRange() const {
+    return m_Arena.GetRange(m_Handle);
+}
+
+// --- GeometryArena ---
+
+GeometryArena::GeometryArena(const BufferLayout& vertexLayout, uint32_t indexSize, uint32_t vertexCapacity, uint32_t indexCapacity)
+    : m_VertexSize(vertexLayout.GetStride()), m_VertexAllocator(vertexCapacity), m_IndexAllocator(indexCapacity) {
+    m_VertexArray = std::make_unique<VertexArray>();
+    m_VertexBuffer = std::make_shared<VertexBuffer>(vertexCapacity * m_VertexSize);
+    m_VertexBuffer->SetLayout(vertexLayout);
+    m_VertexArray->AddVertexBuffer(m_VertexBuffer);
+    m_IndexBuffer = std::make_shared<IndexBuffer>(indexCapacity, indexSize);
+    m_VertexArray->SetIndexBuffer(m_IndexBuffer);
+}
+
+GeometryArena::~GeometryArena() {
+    const size_t liveCount = m_Entries.size() - m_FreeHandles.size();
+    if (liveCount > 0) {
+        std::cerr << "GeometryArena: destroyed with " << liveCount << " meshes still allocated" << std::endl;
+    }
+}
+
+std::shared_ptr<GeometryAllocation> GeometryArena::Allocate(const void* vertices, uint32_t vertexCount, const uint32_t* indices, uint32_t indexCount) {
+    // Empty meshes still get a (one element) block so that every mesh has a range
+    Entry entry;
+    entry.Vertices = AllocateVertices(std::max(vertexCount, 1u));
+    entry.Indices = AllocateIndices(std::max(indexCount, 1u));
+    if (!entry.Vertices.IsValid() || !entry.Indices.IsValid()) {
+        std::cerr << "GeometryArena: out of space for a mesh of " << vertexCount << " vertices, " << indexCount << " indices" << std::endl;
+        m_VertexAllocator.Free(entry.Vertices);
+        m_IndexAllocator.Free(entry.Indices);
+        return nullptr;
+    }
+    // Making room for the indices may have defragmented the vertices
+    entry.Range.BaseVertex = m_VertexAllocator.GetOffset(entry.Vertices);
+    entry.Range.FirstIndex = m_IndexAllocator.GetOffset(entry.Indices);
+    entry.Range.VertexCount = vertexCount;
+    entry.Range.IndexCount = indexCount;
+
+    if (vertexCount > 0) {
+        m_VertexBuffer->SetSubData(entry.Range.BaseVertex * m_VertexSize, vertices, vertexCount * m_VertexSize);
+    }
+    if (indexCount > 0) {
+        if (GetIndexSize() == sizeof(uint16_t)) {
+            m_ShortIndices.assign(indices, indices + indexCount);
+            m_IndexBuffer->SetSubData(entry.Range.FirstIndex, m_ShortIndices.data(), indexCount);
+        } else {
+            m_IndexBuffer->SetSubData(entry.Range.FirstIndex, indices, indexCount);
+        }
+    }
+
+    uint32_t handle;
+    if (!m_FreeHandles.empty()) {
+        handle = m_FreeHandles.back();
+        m_FreeHandles.pop_back();
+        m_Entries[handle] = entry;
+    } else {
+        handle = static_cast<uint32_t>(m_Entries.size());
+        m_Entries.push_back(entry);
+    }
+    return std::make_shared<GeometryAllocation>(*this, handle);
+}
+
+void GeometryArena::Free(uint32_t handle) {
+    Entry& entry = m_Entries[handle];
+    m_VertexAllocator.Free(entry.Vertices);
+    m_IndexAllocator.Free(entry.Indices);
+    entry = Entry();
+    m_FreeHandles.push_back(handle);
+}
+
+OffsetAllocation GeometryArena::AllocateVertices(uint32_t count) {
+    OffsetAllocation allocation = m_VertexAllocator.Allocate(count);
+    if (!allocation.IsValid() && m_VertexAllocator.GetStats().FreeSpace >= count) {
+        Defragment();
+        allocation = m_VertexAllocator.Allocate(count);
+    }
+    if (!allocation.IsValid()) {
+        const uint32_t capacity = GrownCapacity(m_VertexAllocator.GetSize(), count, m_VertexSize);
+        if (capacity == 0) {
+            return allocation;
+        }
+        m_VertexBuffer->Resize(capacity * m_VertexSize);
+        m_VertexAllocator.Grow(capacity);
+        m_Growths++;
+        allocation = m_VertexAllocator.Allocate(count);
+    }
+    return allocation;
+}
+
+OffsetAllocation GeometryArena::AllocateIndices(uint32_t count) {
+    OffsetAllocation allocation = m_IndexAllocator.Allocate(count);
+    if (!allocation.IsValid() && m_IndexAllocator.GetStats().FreeSpace >= count) {
+        Defragment();
+        allocation = m_IndexAllocator.Allocate(count);
+    }
+    if (!allocation.IsValid()) {
+        const uint32_t capacity = GrownCapacity(m_IndexAllocator.GetSize(), count, GetIndexSize());
+        if (capacity == 0) {
+            return allocation;
+        }
+        m_IndexBuffer->Resize(capacity);
+        m_IndexAllocator.Grow(capacity);
+        m_Growths++;
+        allocation = m_IndexAllocator.Allocate(count);
+    }
+    return allocation;
+}
+
+void GeometryArena::Defragment() {
+    ApplyRelocations(m_VertexBuffer->GetRendererID(), m_VertexAllocator.Defragment(), m_VertexSize);
+    ApplyRelocations(m_IndexBuffer->GetRendererID(), m_IndexAllocator.Defragment(), GetIndexSize());
+    for (Entry& entry : m_Entries) {
+        if (entry.Vertices.IsValid()) {
+            entry.Vertices.Offset = m_VertexAllocator.GetOffset(entry.Vertices);
+            entry.Indices.Offset = m_IndexAllocator.GetOffset(entry.Indices);
+            entry.Range.BaseVertex = entry.Vertices.Offset;
+            entry.Range.FirstIndex = entry.Indices.Offset;
+        }
+    }
+    m_Defragmentations++;
+}
+
+void GeometryArena::AttachInstanceBuffer(const std::shared_ptr<VertexBuffer>& instanceBuffer) {
+    m_InstanceBufferIndex = m_VertexArray->GetVertexBuffers().size();
+    m_VertexArray->AddVertexBuffer(instanceBuffer);
+    m_FirstInstance = 0;
+    m_InstanceBufferID = instanceBuffer->GetRendererID();
+}
+
+void GeometryArena::SetFirstInstance(uint32_t firstInstance) {
+    if (m_InstanceBufferIndex == SIZE_MAX) {
+        return;
+    }
+    // A streamed instance buffer changes its GL name when it grows: the
+    // attribute pointers must be set again even for the same offset
+    const auto& instanceBuffer = m_VertexArray->GetVertexBuffers()[m_InstanceBufferIndex];
+    if (firstInstance == m_FirstInstance && instanceBuffer->GetRendererID() == m_InstanceBufferID) {
+        return;
+    }
+    m_VertexArray->SetVertexBufferOffset(m_InstanceBufferIndex, firstInstance * instanceBuffer->GetLayout().GetStride());
+    m_FirstInstance = firstInstance;
+    m_InstanceBufferID = instanceBuffer->GetRendererID();
+}
+
+void GeometryArena::AttachDrawIndexBuffer(const std::shared_ptr<VertexBuffer>& drawIndexBuffer) {
+    if (m_HasDrawIndexBuffer) {
+        return;
+    }
+    m_VertexArray->AddVertexBuffer(drawIndexBuffer);
+    m_HasDrawIndexBuffer = true;
+}
+
+GeometryArenaStats GeometryArena::GetStats() const {
+    GeometryArenaStats stats;
+    stats.Vertices = m_VertexAllocator.GetStats();
+    stats.Indices = m_IndexAllocator.GetStats();
+    stats.Growths = m_Growths;
+    stats.Defragmentations = m_Defragmentations;
+    return stats;
+}
+
+MemoryUsage GeometryArena::GetMemoryUsage() const {
+    MemoryUsage usage;
+    usage.CpuBytes = m_VertexAllocator.GetMetadataBytes() + m_IndexAllocator.GetMetadataBytes()
+                   + m_Entries.capacity() * sizeof(Entry) + m_FreeHandles.capacity() * sizeof(uint32_t)
+                   + m_ShortIndices.capacity() * sizeof(uint16_t);
+    usage.GpuBytes = static_cast<uint64_t>(m_VertexAllocator.GetSize()) * m_VertexSize
+                   + static_cast<uint64_t>(m_IndexAllocator.GetSize()) * GetIndexSize();
+    return usage;
+}
@@ -0,0 +1,123 @@
+// src/Renderer/GeometryArena.h
+#pragma once
+
+#include "MemoryUsage.h"
+#include "OffsetAllocator.h"
+#include "VertexArray.h"
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+class GeometryArena;
+
+// Where a mesh lives in its arena, in glDrawElementsBaseVertex terms: indices
+// are relative to BaseVertex, FirstIndex counts elements (not bytes)
+struct GeometryRange {
+    uint32_t BaseVertex = 0;
+    uint32_t FirstIndex = 0;
+    uint32_t VertexCount = 0;
+    uint32_t IndexCount = 0;
+};
+
+struct GeometryArenaStats {
+    OffsetAllocatorStats Vertices; // In vertices
+    OffsetAllocatorStats Indices;  // In indices
+    uint32_t Growths = 0;
+    uint32_t Defragmentations = 0;
+};
+
+// A range owned by a mesh. Shared by the copies of the mesh, handed back to
+// the arena when the last one goes away.
+class GeometryAllocation {
+public:
+    GeometryAllocation(GeometryArena& arena, uint32_t handle) : m_Arena(arena), m_Handle(handle) {}
+    ~GeometryAllocation();
+    GeometryAllocation(const GeometryAllocation&) = delete;
+    GeometryAllocation& operator=(const GeometryAllocation&) = delete;
+
+    GeometryArena& GetArena() const { return m_Arena; }
+    // Read at draw time: Defragment moves ranges
+    const GeometryRange& GetRange() const;
+
+private:
+    GeometryArena& m_Arena;
+    uint32_t m_Handle;
+};
+
+// Large vertex and index buffers shared by every mesh of one vertex format and
+// index size, behind a single VAO: switching meshes never rebinds anything,
+// draws only change their base vertex and first index.
+//
+// Both buffers are sub-allocated with an OffsetAllocator. When a mesh does not
+// fit, the arena defragments if the free space would be enough, and grows
+// (doubling, contents kept) otherwise.
+class GeometryArena {
+public:
+    // `indexSize` is 2 or 4 bytes; every mesh stored here must then have at
+    // most 65536 vertices or not. Capacities are in vertices and indices.
+    GeometryArena(const BufferLayout& vertexLayout, uint32_t indexSize, uint32_t vertexCapacity, uint32_t indexCapacity);
+    ~GeometryArena();
+    GeometryArena(const GeometryArena&) = delete;
+    GeometryArena& operator=(const GeometryArena&) = delete;
+
+    // Copies a mesh in (vertices in the arena layout, indices starting at 0)
+    std::shared_ptr<GeometryAllocation> Allocate(const void* vertices, uint32_t vertexCount, const uint32_t* indices, uint32_t indexCount);
+    // Packs every range at the start of the buffers (GPU-side copies)
+    void Defragment();
+
+    const GeometryRange& GetRange(uint32_t handle) const { return m_Entries[handle].Range; }
+
+    void Bind() const { m_VertexArray->Bind(); }
+    const VertexArray& GetVertexArray() const { return *m_VertexArray; }
+    // GL_UNSIGNED_SHORT or GL_UNSIGNED_INT
+    uint32_t GetIndexType() const { return m_IndexBuffer->GetElementType(); }
+    uint32_t GetIndexSize() const { return m_IndexBuffer->GetElementSize(); }
+
+    // Per-instance attributes stream from `instanceBuffer`, attached to the
+    // arena VAO after the vertex attributes. SetFirstInstance chooses where
+    // the next instanced draws start reading it.
+    void AttachInstanceBuffer(const std::shared_ptr<VertexBuffer>& instanceBuffer);
+    void SetFirstInstance(uint32_t firstInstance);
+    // Per-draw indices of the indirect path when the shaders lack
+    // gl_DrawID (see RenderQueue::ExecuteIndirect). Attached on first use;
+    // later calls do nothing.
+    void AttachDrawIndexBuffer(const std::shared_ptr<VertexBuffer>& drawIndexBuffer);
+
+    uint32_t GetVertexSize() const { return m_VertexSize; }
+
+    GeometryArenaStats GetStats() const;
+    // GPU: the whole capacity of both buffers. CPU: the allocator bookkeeping.
+    MemoryUsage GetMemoryUsage() const;
+
+private:
+    friend class GeometryAllocation;
+
+    struct Entry {
+        GeometryRange Range;
+        OffsetAllocation Vertices;
+        OffsetAllocation Indices;
+    };
+
+    void Free(uint32_t handle);
+    // Allocate, defragmenting or growing the buffer when the request does not fit
+    OffsetAllocation AllocateVertices(uint32_t count);
+    OffsetAllocation AllocateIndices(uint32_t count);
+
+    std::unique_ptr<VertexArray> m_VertexArray;
+    std::shared_ptr<VertexBuffer> m_VertexBuffer;
+    std::shared_ptr<IndexBuffer> m_IndexBuffer;
+    uint32_t m_VertexSize;
+    OffsetAllocator m_VertexAllocator;
+    OffsetAllocator m_IndexAllocator;
+
+    std::vector<Entry> m_Entries;
+    std::vector<uint32_t> m_FreeHandles;
+    std::vector<uint16_t> m_ShortIndices; // Conversion scratch of 16-bit arenas
+
+    size_t m_InstanceBufferIndex = SIZE_MAX;
+    uint32_t m_FirstInstance = 0;
+    uint32_t m_InstanceBufferID = 0; // GL name the attribute pointers were set with
+    bool m_HasDrawIndexBuffer = false;
+    uint32_t m_Growths = 0;
+    uint32_t m_Defragmentations = 0;
+};
@@ -0,0 +1,80 @@
+// src/Renderer/GpuProfiler.cpp
+#include "GpuProfiler.h"
+#include <glad/glad.h>
+
+struct GpuZone {
+    const char* Name = nullptr;
+    uint64_t CpuStart = 0; // Profiler time when the commands were issued
+};
+
+static bool s_Initialized = false;
+static GLuint s_Queries[GpuProfiler::QUERY_FRAME_COUNT][GpuProfiler::MAX_ZONES_PER_FRAME] = {};
+static GpuZone s_Zones[GpuProfiler::QUERY_FRAME_COUNT][GpuProfiler::MAX_ZONES_PER_FRAME];
+static uint32_t s_ZoneCounts[GpuProfiler::QUERY_FRAME_COUNT] = {};
+static uint32_t s_Frame = 0;
+static uint32_t s_Depth = 0;
+static bool s_ZoneOpen = false;
+static uint32_t s_DroppedZones = 0;
+
+void GpuProfiler::Init() {
+    if (s_Initialized) {
+        return;
+    }
+    glGenQueries(QUERY_FRAME_COUNT * MAX_ZONES_PER_FRAME, &s_Queries[0][0]);
+    s_Initialized = true;
+}
+
+void GpuProfiler::Shutdown() {
+    if (!s_Initialized) {
+        return;
+    }
+    glDeleteQueries(QUERY_FRAME_COUNT * MAX_ZONES_PER_FRAME, &s_Queries[0][0]);
+    for (uint32_t& count : s_ZoneCounts) {
+        count = 0;
+    }
+    s_Initialized = false;
+}
+
+void GpuProfiler::BeginFrame() {
+    if (!s_Initialized) {
+        return;
+    }
+    s_Frame = (s_Frame + 1) % QUERY_FRAME_COUNT;
+    for (uint32_t i = 0; i < s_ZoneCounts[s_Frame]; i++) {
+        GLint available = 0;
+        glGetQueryObjectiv(s_Queries[s_Frame][i], GL_QUERY_RESULT_AVAILABLE, &available);
+        if (!available) {
+            s_DroppedZones++;
+            continue;
+        }
+        GLuint64 elapsed = 0;
+        glGetQueryObjectui64v(s_Queries[s_Frame][i], GL_QUERY_RESULT, &elapsed);
+        Profiler::RecordGpuEvent(s_Zones[s_Frame][i].Name, s_Zones[s_Frame][i].CpuStart, elapsed);
+    }
+    s_ZoneCounts[s_Frame] = 0;
+}
+
+void GpuProfiler::BeginZone(const char* name) {
+    s_Depth++;
+    uint32_t& count = s_ZoneCounts[s_Frame];
+    if (!s_Initialized || s_Depth > 1 || count == MAX_ZONES_PER_FRAME || !Profiler::IsEnabled()) {
+        return;
+    }
+    s_Zones[s_Frame][count].Name = name;
+    s_Zones[s_Frame][count].CpuStart = Profiler::GetTime();
+    glBeginQuery(GL_TIME_ELAPSED, s_Queries[s_Frame][count]);
+    count++;
+    s_ZoneOpen = true;
+}
+
+void GpuProfiler::EndZone() {
+    s_Depth--;
+    if (s_Depth == 0 && s_ZoneOpen) {
+        glEndQuery(GL_TIME_ELAPSED);
+        s_ZoneOpen = false;
+    }
+}
+
+uint32_t GpuProfiler::GetDroppedZones() {
+    return s_DroppedZones;
+}
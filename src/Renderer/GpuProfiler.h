@@ -0,0 +1,43 @@
+// src/Renderer/GpuProfiler.h
+#pragma once
+
+#include "../Core/Profiler.h"
+#include <cstdint>
+
+// GPU durations of render passes, measured with GL_TIME_ELAPSED queries and
+// reported to the Profiler (GPU track, frame summary).
+// Each frame uses its own set of queries, read back QUERY_FRAME_COUNT frames
+// later when the GPU is done with them, so reading never stalls. A result
+// still unavailable by then is dropped rather than waited for.
+// Elapsed-time queries cannot nest: zones opened inside another one are ignored.
+class GpuProfiler {
+public:
+    static constexpr uint32_t QUERY_FRAME_COUNT = 2;
+    static constexpr uint32_t MAX_ZONES_PER_FRAME = 16;
+
+    static void Init();
+    static void Shutdown();
+
+    // Collects the results of the frame that used this query set, then reuses it
+    static void BeginFrame();
+    // `name` must be a string literal (it is kept until the read back)
+    static void BeginZone(const char* name);
+    static void EndZone();
+
+    // Zones whose result was not ready in time, since Init
+    static uint32_t GetDroppedZones();
+};
+
+class GpuProfileScope {
+public:
+    explicit GpuProfileScope(const char* name) { GpuProfiler::BeginZone(name); }
+    ~GpuProfileScope() { GpuProfiler::EndZone(); }
+    GpuProfileScope(const GpuProfileScope&) = delete;
+    GpuProfileScope& operator=(const GpuProfileScope&) = delete;
+};
+
+#if PLUME_ENABLE_PROFILER
+#define PLUME_PROFILE_GPU_SCOPE(name) GpuProfileScope PLUME_PROFILE_CONCAT(gpuProfileScope, __LINE__)(name)
+#else
+#define PLUME_PROFILE_GPU_SCOPE(name)
+#endif
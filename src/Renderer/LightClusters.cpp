@@ -0,0 +1,176 @@
+// src/Renderer/LightClusters.cpp
+#include "LightClusters.h"
+#include "../Core/JobSystem.h"
+#include "../Core/Profiler.h"
+#include <algorithm>
+#include <cmath>
+
+// A row is GRID_X clusters, four per SSE register. AVX builds use the same
+// path: 16 columns fill too few 8-wide registers to be worth a second one.
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #include <emmintrin.h>
+    #define PLUME_CLUSTERS_SSE 1
+#endif
+
+static_assert(LightClusters::GRID_X % 4 == 0, "Rows are tested four columns at a time");
+
+// Lights moved to view space per job
+static constexpr uint32_t TRANSFORM_GRAIN = 1024;
+
+void LightClusters::SetProjection(const glm::mat4& projection) {
+    if (projection == m_Projection) {
+        return;
+    }
+    m_Projection = projection;
+
+    // Near and far planes of a glm::perspective matrix
+    const float nearPlane = projection[3][2] / (projection[2][2] - 1.0f);
+    const float farPlane = projection[3][2] / (projection[2][2] + 1.0f);
+    const float logRatio = std::log(farPlane / nearPlane);
+    m_SliceScale = GRID_Z / logRatio;
+    m_SliceBias = -GRID_Z * std::log(nearPlane) / logRatio;
+    for (uint32_t z = 0; z <= GRID_Z; z++) {
+        m_SliceDepths[z] = nearPlane * std::pow(farPlane / nearPlane, static_cast<float>(z) / GRID_Z);
+    }
+
+    // View-space coordinate of an NDC coordinate at view depth d: the tile
+    // edges are planes through the eye, so a slice's bounds are reached at
+    // its near or far depth
+    auto toView = [](float ndc, float depth, float scale, float offset) { return depth * (ndc + offset) / scale; };
+    for (uint32_t z = 0; z < GRID_Z; z++) {
+        const float nearDepth = m_SliceDepths[z];
+        const float farDepth = m_SliceDepths[z + 1];
+        for (uint32_t x = 0; x < GRID_X; x++) {
+            const float ndc0 = -1.0f + 2.0f * x / GRID_X;
+            const float ndc1 = -1.0f + 2.0f * (x + 1) / GRID_X;
+            const float edges[4] = {
+                toView(ndc0, nearDepth, projection[0][0], projection[2][0]), toView(ndc0, farDepth, projection[0][0], projection[2][0]),
+                toView(ndc1, nearDepth, projection[0][0], projection[2][0]), toView(ndc1, farDepth, projection[0][0], projection[2][0]),
+            };
+            m_ColumnMinX[z][x] = *std::min_element(edges, edges + 4);
+            m_ColumnMaxX[z][x] = *std::max_element(edges, edges + 4);
+        }
+        for (uint32_t y = 0; y < GRID_Y; y++) {
+            const float ndc0 = -1.0f + 2.0f * y / GRID_Y;
+            const float ndc1 = -1.0f + 2.0f * (y + 1) / GRID_Y;
+            const float edges[4] = {
+                toView(ndc0, nearDepth, projection[1][1], projection[2][1]), toView(ndc0, farDepth, projection[1][1], projection[2][1]),
+                toView(ndc1, nearDepth, projection[1][1], projection[2][1]), toView(ndc1, farDepth, projection[1][1], projection[2][1]),
+            };
+            m_RowMinY[z][y] = *std::min_element(edges, edges + 4);
+            m_RowMaxY[z][y] = *std::max_element(edges, edges + 4);
+        }
+    }
+}
+
+// Squared distance from a point to an interval, 0 inside
+static float DistanceSq(float value, float min, float max) {
+    const float d = std::max(std::max(min - value, value - max), 0.0f);
+    return d * d;
+}
+
+void LightClusters::Assign(const RenderLight* lights, uint32_t count, const glm::mat4& view) {
+    PLUME_PROFILE_FUNCTION();
+    m_Stats = LightClustersStats();
+    m_Stats.Lights = count;
+    m_ClusterRanges.assign(CLUSTER_COUNT, glm::uvec2(0));
+    m_LightIndices.clear();
+    if (count == 0 || m_SliceScale == 0.0f) {
+        m_Stats.EmptyClusters = CLUSTER_COUNT;
+        return;
+    }
+
+    // --- 1. Light spheres in view space (depth is -z) ---
+    m_ViewLights.resize(count);
+    JobSystem::ParallelFor(count, TRANSFORM_GRAIN, [&](uint32_t begin, uint32_t end) {
+        for (uint32_t i = begin; i < end; i++) {
+            const glm::vec4 position = view * glm::vec4(lights[i].Position, 1.0f);
+            m_ViewLights[i] = glm::vec4(position.x, position.y, -position.z, lights[i].Range);
+        }
+    });
+
+    // --- 2. Cluster lists, one slice per job ---
+    // The x distances of a light are shared by every row of the slice; each
+    // row then only adds its own y and z distances to the test.
+    m_ClusterLists.resize(CLUSTER_COUNT);
+    JobSystem::ParallelFor(GRID_Z, 1, [&](uint32_t begin, uint32_t end) {
+        for (uint32_t z = begin; z < end; z++) {
+            std::vector<uint32_t>* sliceLists = m_ClusterLists.data() + z * TILES_PER_SLICE;
+            for (uint32_t tile = 0; tile < TILES_PER_SLICE; tile++) {
+                sliceLists[tile].clear();
+            }
+            const float nearDepth = m_SliceDepths[z];
+            const float farDepth = m_SliceDepths[z + 1];
+            for (uint32_t i = 0; i < count; i++) {
+                const glm::vec4& light = m_ViewLights[i];
+                const float radiusSq = light.w * light.w;
+                const float distanceZ = DistanceSq(light.z, nearDepth, farDepth);
+                if (light.w <= 0.0f || distanceZ > radiusSq) {
+                    continue;
+                }
+
+                alignas(16) float distanceX[GRID_X];
+#if defined(PLUME_CLUSTERS_SSE)
+                const __m128 cx = _mm_set1_ps(light.x);
+                const __m128 zero = _mm_setzero_ps();
+                for (uint32_t x = 0; x < GRID_X; x += 4) {
+                    const __m128 below = _mm_sub_ps(_mm_load_ps(&m_ColumnMinX[z][x]), cx);
+                    const __m128 above = _mm_sub_ps(cx, _mm_load_ps(&m_ColumnMaxX[z][x]));
+                    const __m128 d = _mm_max_ps(_mm_max_ps(below, above), zero);
+                    _mm_store_ps(distanceX + x, _mm_mul_ps(d, d));
+                }
+#else
+                for (uint32_t x = 0; x < GRID_X; x++) {
+                    distanceX[x] = DistanceSq(light.x, m_ColumnMinX[z][x], m_ColumnMaxX[z][x]);
+                }
+#endif
+
+                for (uint32_t y = 0; y < GRID_Y; y++) {
+                    const float remaining = radiusSq - distanceZ - DistanceSq(light.y, m_RowMinY[z][y], m_RowMaxY[z][y]);
+                    if (remaining < 0.0f) {
+                        continue;
+                    }
+                    std::vector<uint32_t>* rowLists = sliceLists + y * GRID_X;
+#if defined(PLUME_CLUSTERS_SSE)
+                    const __m128 limit = _mm_set1_ps(remaining);
+                    for (uint32_t x = 0; x < GRID_X; x += 4) {
+                        const int mask = _mm_movemask_ps(_mm_cmple_ps(_mm_load_ps(distanceX + x), limit));
+                        for (uint32_t lane = 0; mask != 0 && lane < 4; lane++) {
+                            if (mask & (1 << lane)) {
+                                rowLists[x + lane].push_back(i);
+                            }
+                        }
+                    }
+#else
+                    for (uint32_t x = 0; x < GRID_X; x++) {
+                        if (distanceX[x] <= remaining) {
+                            rowLists[x].push_back(i);
+                        }
+                    }
+#endif
+                }
+            }
+        }
+    });
+
+    // --- 3. Ranges of the flattened index list ---
+    uint32_t offset = 0;
+    for (uint32_t cluster = 0; cluster < CLUSTER_COUNT; cluster++) {
+        const uint32_t lightCount = static_cast<uint32_t>(m_ClusterLists[cluster].size());
+        m_ClusterRanges[cluster] = glm::uvec2(offset, lightCount);
+        offset += lightCount;
+        m_Stats.MaxLightsPerCluster = std::max(m_Stats.MaxLightsPerCluster, lightCount);
+        if (lightCount == 0) {
+            m_Stats.EmptyClusters++;
+        }
+    }
+    m_Stats.LightIndices = offset;
+
+    m_LightIndices.resize(offset);
+    JobSystem::ParallelFor(GRID_Z, 1, [&](uint32_t begin, uint32_t end) {
+        for (uint32_t cluster = begin * TILES_PER_SLICE; cluster < end * TILES_PER_SLICE; cluster++) {
+            const std::vector<uint32_t>& list = m_ClusterLists[cluster];
+            std::copy(list.begin(), list.end(), m_LightIndices.begin() + m_ClusterRanges[cluster].x);
+        }
+    });
+}
@@ -0,0 +1,74 @@
+// src/Renderer/LightClusters.h
+#pragma once
+
+#include "RenderSnapshot.h"
+#include <glm/glm.hpp>
+#include <cstdint>
+#include <vector>
+
+struct LightClustersStats {
+    uint32_t Lights = 0;              // Lights given to the last Assign
+    uint32_t LightIndices = 0;        // Entries of every cluster list
+    uint32_t MaxLightsPerCluster = 0;
+    uint32_t EmptyClusters = 0;
+};
+
+// Clustered forward lighting, CPU side: the view frustum is cut into a grid
+// of GRID_X x GRID_Y screen tiles and GRID_Z depth slices (exponential in
+// depth, so clusters stay roughly cubic), and every cluster gets the list of
+// the point lights whose sphere touches its view-space box. The fragment
+// shader finds its cluster from gl_FragCoord and its view depth, then only
+// loops over that list.
+//
+// Assign runs on the job system, one depth slice per job; a light is tested
+// against a whole row of cluster boxes at once with SIMD. No GL here: the renderer
+// uploads the results (see SceneRenderer).
+class LightClusters {
+public:
+    static constexpr uint32_t GRID_X = 16;
+    static constexpr uint32_t GRID_Y = 9;
+    static constexpr uint32_t GRID_Z = 24;
+    static constexpr uint32_t TILES_PER_SLICE = GRID_X * GRID_Y;
+    static constexpr uint32_t CLUSTER_COUNT = TILES_PER_SLICE * GRID_Z;
+
+    // Cluster boxes follow the projection (perspective only); rebuilt only
+    // when it changes
+    void SetProjection(const glm::mat4& projection);
+    // Builds the cluster lists of `count` world-space lights seen through `view`
+    void Assign(const RenderLight* lights, uint32_t count, const glm::mat4& view);
+
+    // Per cluster, x: first entry in GetLightIndices, y: entry count. Cluster
+    // (x, y, z) is at (z * GRID_Y + y) * GRID_X + x, y going up the screen.
+    const std::vector<glm::uvec2>& GetClusterRanges() const { return m_ClusterRanges; }
+    // Indices in the light array given to Assign
+    const std::vector<uint32_t>& GetLightIndices() const { return m_LightIndices; }
+
+    // Depth slice of a view depth d: floor(log(d) * scale + bias)
+    float GetSliceScale() const { return m_SliceScale; }
+    float GetSliceBias() const { return m_SliceBias; }
+    const LightClustersStats& GetStats() const { return m_Stats; }
+
+private:
+    glm::mat4 m_Projection = glm::mat4(0.0f);
+    float m_SliceScale = 0.0f;
+    float m_SliceBias = 0.0f;
+
+    // View-space cluster boxes. Their bounds are separable: x only depends on
+    // the tile column and the slice, y on the tile row and the slice, z on
+    // the slice. Columns are stored contiguously for SIMD.
+    float m_SliceDepths[GRID_Z + 1] = {}; // View depth of each slice boundary
+    alignas(16) float m_ColumnMinX[GRID_Z][GRID_X] = {};
+    alignas(16) float m_ColumnMaxX[GRID_Z][GRID_X] = {};
+    float m_RowMinY[GRID_Z][GRID_Y] = {};
+    float m_RowMaxY[GRID_Z][GRID_Y] = {};
+
+    // View-space spheres of the lights
+    std::vector<glm::vec4> m_ViewLights;
+    // Kept across frames to reuse their capacity: each one is only touched
+    // by the job of its slice
+    std::vector<std::vector<uint32_t>> m_ClusterLists;
+
+    std::vector<glm::uvec2> m_ClusterRanges;
+    std::vector<uint32_t> m_LightIndices;
+    LightClustersStats m_Stats;
+};
@@ -0,0 +1,17 @@
+// src/Renderer/MemoryUsage.h
+#pragma once
+
+#include <cstdint>
+
+// Memory held by a renderer resource: CPU heap bytes and GPU bytes (buffer and
+// texture storage as allocated by the engine; drivers may pad it)
+struct MemoryUsage {
+    uint64_t CpuBytes = 0;
+    uint64_t GpuBytes = 0;
+
+    MemoryUsage& operator+=(const MemoryUsage& other) {
+        CpuBytes += other.CpuBytes;
+        GpuBytes += other.GpuBytes;
+        return *this;
+    }
+};
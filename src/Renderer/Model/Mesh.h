@@ -5,8 +5,10 @@
 #include <vector>
 #include <memory>
 #include "../Shader.h"
-#include "../VertexArray.h"
+#include "../GeometryArena.h"
 #include "../Texture.h" // <-- INCLURE LA TEXTURE
+#include "../Bounds.h"
+#include "../MemoryUsage.h"
 
 struct Vertex {
     glm::vec3 Position;
@@ -14,18 +16,79 @@ struct Vertex {
     glm::vec2 TexCoords;
 };
 
+// Ranges needed to unpack a quantized mesh (see VertexQuantizer), uploaded
+// as the `u_Dequantize` vec4[3] uniform
+struct VertexQuantization {
+    glm::vec4 PositionOffset = glm::vec4(0.0f);
+    glm::vec4 PositionScale = glm::vec4(1.0f);
+    glm::vec4 TexCoordTransform = glm::vec4(0.0f, 0.0f, 1.0f, 1.0f); // xy: offset, zw: scale
+};
+static_assert(sizeof(VertexQuantization) == 3 * sizeof(glm::vec4), "VertexQuantization is uploaded as a vec4 array");
+
+// One level of detail: a range of the mesh index buffer. Every level indexes
+// the same vertices (see MeshSimplifier).
+struct MeshLod {
+    uint32_t IndexOffset = 0;
+    uint32_t IndexCount = 0;
+    float Error = 0.0f; // Object-space deviation from level 0: farthest level 0 vertex from this surface
+};
+
+// What a mesh keeps once its geometry is in GPU memory
+enum class MeshStorage {
+    GpuOnly,    // `vertices` and `indices` are released after the upload
+    KeepCpuCopy // They stay filled, for CPU queries (collision, picking...)
+};
+
 class Mesh {
 public:
-    // Données du maillage
+    // Données du maillage (empty unless the mesh was created with MeshStorage::KeepCpuCopy)
     std::vector<Vertex>       vertices;
     std::vector<unsigned int> indices;
     std::vector<std::shared_ptr<Texture>> textures; // <-- MODIFIÉ
-    std::shared_ptr<VertexArray> VAO;
+    // PackedVertex range in one of the shared arenas (see GetArena)
+    std::shared_ptr<GeometryAllocation> Geometry;
+    // Object-space bounds, computed at import (or read from the mesh cache)
+    AABB Bounds;
+    BoundingSphere Sphere;
+    // The GPU vertices are PackedVertex; shaders unpack them with this
+    VertexQuantization Quantization;
+    // Level 0 is the full mesh, coarser levels follow. Never empty.
+    std::vector<MeshLod> Lods;
 
     // MODIFIÉ : Le constructeur accepte maintenant des textures
-    Mesh(const std::vector<Vertex>& vertices, const std::vector<unsigned int>& indices, std::vector<std::shared_ptr<Texture>> textures);
-    void Draw(Shader& shader);
+    // Takes the arrays over (move them in to avoid any copy)
+    Mesh(std::vector<Vertex> vertices, std::vector<unsigned int> indices, std::vector<std::shared_ptr<Texture>> textures,
+         MeshStorage storage = MeshStorage::GpuOnly);
+    // Uploads data that is already in the `Vertex` layout (e.g. a mapped cache
+    // file). The arrays are only copied for MeshStorage::KeepCpuCopy.
+    Mesh(const Vertex* vertexData, uint32_t vertexCount, const uint32_t* indexData, uint32_t indexCount, std::vector<std::shared_ptr<Texture>> textures,
+         MeshStorage storage = MeshStorage::GpuOnly);
+
+    // Clamped to the coarsest level available
+    const MeshLod& GetLod(uint32_t level) const { return Lods[level < Lods.size() ? level : Lods.size() - 1]; }
+
+    bool HasCpuData() const { return !vertices.empty(); }
+    // CPU arrays and the mesh's slice of its arena (textures are shared and
+    // counted on their own, see Texture::GetMemoryUsage)
+    MemoryUsage GetMemoryUsage() const;
+
+    // Engine-wide arenas holding the GPU geometry of every mesh, one per index
+    // size (2 bytes when the mesh has at most 65536 vertices, 4 otherwise)
+    static GeometryArena& GetArena(uint32_t indexSize);
+    // Per-instance attributes (InstanceData) of the instanced draws, attached
+    // to every arena. Filled by the renderer once per frame, through the
+    // DynamicBuffer behind it (GetInstanceStream).
+    static const std::shared_ptr<VertexBuffer>& GetInstanceBuffer();
+    static DynamicBuffer& GetInstanceStream();
+    // 0, 1, 2... one float per draw, read at the base instance of an
+    // indirect draw by all of its instances to tell which draw they belong
+    // to. Holds at least `drawCount` values.
+    static const std::shared_ptr<VertexBuffer>& GetDrawIndexBuffer(uint32_t drawCount);
+    // Destroys the arenas while the GL context is alive. Meshes must be gone.
+    static void ReleaseArenas();
+    // Whole capacity of the arenas and of the instance buffer
+    static MemoryUsage GetArenaMemoryUsage();
 
 private:
-    void setupMesh();
+    void setupMesh(const Vertex* vertexData, uint32_t vertexCount, const uint32_t* indexData, uint32_t indexCount);
 };
\ No newline at end of file
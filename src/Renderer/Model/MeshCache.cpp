@@ -0,0 +1,312 @@
+// src/Renderer/Model/MeshCache.cpp
+#include "MeshCache.h"
+#include "../../Core/Hash.h"
+#include <algorithm>
+#include <cctype>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+
+// --- File layout ---
+// [CookedHeader][CookedMeshEntry x MeshCount][vertex/index/LOD/texture blocks, 16-byte aligned]
+static constexpr char COOKED_MAGIC[4] = { 'P', 'L', 'M', 'C' };
+static constexpr uint64_t COOKED_ALIGNMENT = 16;
+
+struct CookedHeader {
+    char Magic[4];
+    uint32_t Version;
+    uint64_t SourceHash;
+    uint32_t VertexStride;
+    uint32_t MeshCount;
+};
+
+struct CookedMeshEntry {
+    uint64_t VertexOffset;
+    uint64_t IndexOffset;
+    uint64_t LodOffset;     // MeshLod x LodCount
+    uint64_t TextureOffset; // Sequence of [uint32_t length][chars]
+    uint32_t VertexCount;
+    uint32_t IndexCount;
+    uint32_t LodCount;
+    uint32_t TextureCount;
+    glm::vec3 BoundsMin;
+    glm::vec3 BoundsMax;
+    glm::vec3 SphereCenter;
+    float SphereRadius;
+};
+
+static uint64_t AlignUp(uint64_t value, uint64_t alignment) {
+    return (value + alignment - 1) & ~(alignment - 1);
+}
+
+std::string MeshCache::GetCachePath(const std::string& sourcePath) {
+    return sourcePath + ".plmesh";
+}
+
+// Calls fn(keyword, arguments) for every statement of an OBJ or MTL text:
+// the first word of a line, then the rest of it, blanks trimmed
+template<typename Function>
+static void ForEachStatement(const MappedFile& file, Function fn) {
+    const char* text = reinterpret_cast<const char*>(file.GetData());
+    const size_t size = file.GetSize();
+    auto isBlank = [](char c) { return std::isspace(static_cast<unsigned char>(c)) != 0; };
+    size_t lineStart = 0;
+    while (lineStart < size) {
+        const void* newline = std::memchr(text + lineStart, '\n', size - lineStart);
+        const size_t lineEnd = newline ? static_cast<size_t>(static_cast<const char*>(newline) - text) : size;
+        size_t begin = lineStart;
+        size_t end = lineEnd;
+        while (begin < end && isBlank(text[begin])) {
+            begin++;
+        }
+        while (end > begin && isBlank(text[end - 1])) {
+            end--;
+        }
+        size_t keywordEnd = begin;
+        while (keywordEnd < end && !isBlank(text[keywordEnd])) {
+            keywordEnd++;
+        }
+        size_t argumentsBegin = keywordEnd;
+        while (argumentsBegin < end && isBlank(text[argumentsBegin])) {
+            argumentsBegin++;
+        }
+        if (keywordEnd > begin) {
+            fn(std::string(text + begin, keywordEnd - begin), std::string(text + argumentsBegin, end - argumentsBegin));
+        }
+        lineStart = lineEnd + 1;
+    }
+}
+
+static std::string GetDirectory(const std::string& path) {
+    const size_t slash = path.find_last_of("/\\");
+    return slash == std::string::npos ? std::string(".") : path.substr(0, slash);
+}
+
+static bool HasExtension(const std::string& path, const char* extension) {
+    const size_t dot = path.find_last_of('.');
+    if (dot == std::string::npos) {
+        return false;
+    }
+    std::string suffix = path.substr(dot + 1);
+    std::transform(suffix.begin(), suffix.end(), suffix.begin(), [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+    return suffix == extension;
+}
+
+// MTL texture statements (map_Kd, map_Bump, bump, ...)
+static bool IsTextureStatement(const std::string& keyword) {
+    return keyword.compare(0, 4, "map_") == 0 || keyword == "bump" || keyword == "disp" || keyword == "decal" || keyword == "norm";
+}
+
+// Folds the material libraries of an OBJ file into `hash`: their content,
+// and the paths of the textures they reference, which end up in the cooked
+// file. A missing library hashes differently from any content, so creating
+// it later invalidates the cache too.
+static uint64_t HashObjMaterials(const MappedFile& objFile, const std::string& directory, uint64_t hash) {
+    ForEachStatement(objFile, [&](const std::string& keyword, const std::string& arguments) {
+        if (keyword != "mtllib") {
+            return;
+        }
+        // Several libraries may share one statement
+        size_t begin = 0;
+        while (begin < arguments.size()) {
+            size_t end = arguments.find_first_of(" \t", begin);
+            end = end == std::string::npos ? arguments.size() : end;
+            if (end > begin) {
+                const std::string libraryPath = directory + '/' + arguments.substr(begin, end - begin);
+                hash = HashBytes(libraryPath.data(), libraryPath.size(), hash);
+                MappedFile library;
+                if (!library.Open(libraryPath)) {
+                    hash = HashCombine(hash, 0);
+                } else {
+                    hash = HashBytes(library.GetData(), library.GetSize(), hash);
+                    ForEachStatement(library, [&](const std::string& mtlKeyword, const std::string& mtlArguments) {
+                        if (!IsTextureStatement(mtlKeyword) || mtlArguments.empty()) {
+                            return;
+                        }
+                        // Options (-bm 1.0, ...) come first, the path is the last word
+                        const size_t pathStart = mtlArguments.find_last_of(" \t");
+                        const std::string relativePath = pathStart == std::string::npos ? mtlArguments : mtlArguments.substr(pathStart + 1);
+                        const std::string texturePath = GetDirectory(libraryPath) + '/' + relativePath;
+                        hash = HashBytes(texturePath.data(), texturePath.size(), hash);
+                    });
+                }
+            }
+            begin = end + 1;
+        }
+    });
+    return hash;
+}
+
+bool MeshCache::ComputeSourceHash(const std::string& sourcePath, uint32_t importFlags, uint64_t& outHash) {
+    MappedFile source;
+    if (!source.Open(sourcePath)) {
+        return false;
+    }
+    uint64_t hash = HashBytes(source.GetData(), source.GetSize());
+    // Materials and texture bindings are cooked too: an edited .mtl must
+    // invalidate the cache as much as an edited .obj
+    if (HasExtension(sourcePath, "obj")) {
+        hash = HashObjMaterials(source, GetDirectory(sourcePath), hash);
+    }
+    hash = HashCombine(hash, importFlags);
+    hash = HashCombine(hash, FormatVersion);
+    hash = HashCombine(hash, sizeof(Vertex));
+    outHash = hash;
+    return true;
+}
+
+bool MeshCache::Write(const std::string& cachePath, uint64_t sourceHash, const std::vector<CookedMesh>& meshes) {
+    CookedHeader header;
+    std::memcpy(header.Magic, COOKED_MAGIC, sizeof(COOKED_MAGIC));
+    header.Version = FormatVersion;
+    header.SourceHash = sourceHash;
+    header.VertexStride = sizeof(Vertex);
+    header.MeshCount = static_cast<uint32_t>(meshes.size());
+
+    // First pass: compute the offsets
+    std::vector<CookedMeshEntry> entries(meshes.size());
+    uint64_t offset = AlignUp(sizeof(CookedHeader) + sizeof(CookedMeshEntry) * meshes.size(), COOKED_ALIGNMENT);
+    for (size_t i = 0; i < meshes.size(); i++) {
+        const CookedMesh& mesh = meshes[i];
+        CookedMeshEntry& entry = entries[i];
+        entry.VertexCount = mesh.VertexCount;
+        entry.IndexCount = mesh.IndexCount;
+        entry.LodCount = mesh.LodCount;
+        entry.TextureCount = static_cast<uint32_t>(mesh.DiffuseTextures.size());
+        entry.BoundsMin = mesh.Bounds.Min;
+        entry.BoundsMax = mesh.Bounds.Max;
+        entry.SphereCenter = mesh.Sphere.Center;
+        entry.SphereRadius = mesh.Sphere.Radius;
+
+        entry.VertexOffset = offset;
+        offset = AlignUp(offset + uint64_t(mesh.VertexCount) * sizeof(Vertex), COOKED_ALIGNMENT);
+        entry.IndexOffset = offset;
+        offset = AlignUp(offset + uint64_t(mesh.IndexCount) * sizeof(uint32_t), COOKED_ALIGNMENT);
+        entry.LodOffset = offset;
+        offset = AlignUp(offset + uint64_t(mesh.LodCount) * sizeof(MeshLod), COOKED_ALIGNMENT);
+        entry.TextureOffset = offset;
+        for (const auto& texture : mesh.DiffuseTextures) {
+            offset += sizeof(uint32_t) + texture.size();
+        }
+        offset = AlignUp(offset, COOKED_ALIGNMENT);
+    }
+
+    // Write to a temporary file and rename it, so a crash while writing never
+    // leaves a half-written cache behind.
+    std::string tempPath = cachePath + ".tmp";
+    {
+        std::ofstream out(tempPath, std::ios::binary | std::ios::trunc);
+        if (!out) {
+            std::cerr << "MeshCache: unable to write cache file " << cachePath << std::endl;
+            return false;
+        }
+
+        static const char zeros[COOKED_ALIGNMENT] = {};
+        auto pad = [&out]() {
+            uint64_t position = static_cast<uint64_t>(out.tellp());
+            uint64_t padding = AlignUp(position, COOKED_ALIGNMENT) - position;
+            out.write(zeros, static_cast<std::streamsize>(padding));
+        };
+
+        out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        out.write(reinterpret_cast<const char*>(entries.data()), static_cast<std::streamsize>(sizeof(CookedMeshEntry) * entries.size()));
+        pad();
+        for (const CookedMesh& mesh : meshes) {
+            out.write(reinterpret_cast<const char*>(mesh.Vertices), static_cast<std::streamsize>(uint64_t(mesh.VertexCount) * sizeof(Vertex)));
+            pad();
+            out.write(reinterpret_cast<const char*>(mesh.Indices), static_cast<std::streamsize>(uint64_t(mesh.IndexCount) * sizeof(uint32_t)));
+            pad();
+            out.write(reinterpret_cast<const char*>(mesh.Lods), static_cast<std::streamsize>(uint64_t(mesh.LodCount) * sizeof(MeshLod)));
+            pad();
+            for (const auto& texture : mesh.DiffuseTextures) {
+                uint32_t length = static_cast<uint32_t>(texture.size());
+                out.write(reinterpret_cast<const char*>(&length), sizeof(length));
+                out.write(texture.data(), length);
+            }
+            pad();
+        }
+        if (!out) {
+            std::cerr << "MeshCache: write error on cache file " << cachePath << std::endl;
+            return false;
+        }
+    }
+
+    std::remove(cachePath.c_str());
+    if (std::rename(tempPath.c_str(), cachePath.c_str()) != 0) {
+        std::remove(tempPath.c_str());
+        return false;
+    }
+    return true;
+}
+
+bool MeshCache::Open(const std::string& cachePath, uint64_t expectedHash) {
+    Close();
+    if (!m_File.Open(cachePath)) {
+        return false;
+    }
+
+    const uint8_t* data = m_File.GetData();
+    const uint64_t size = m_File.GetSize();
+    if (size < sizeof(CookedHeader)) {
+        Close();
+        return false;
+    }
+
+    CookedHeader header;
+    std::memcpy(&header, data, sizeof(header));
+    if (std::memcmp(header.Magic, COOKED_MAGIC, sizeof(COOKED_MAGIC)) != 0
+        || header.Version != FormatVersion
+        || header.SourceHash != expectedHash
+        || header.VertexStride != sizeof(Vertex)
+        || sizeof(CookedHeader) + uint64_t(header.MeshCount) * sizeof(CookedMeshEntry) > size) {
+        Close();
+        return false;
+    }
+
+    const CookedMeshEntry* entries = reinterpret_cast<const CookedMeshEntry*>(data + sizeof(CookedHeader));
+    m_Meshes.resize(header.MeshCount);
+    for (uint32_t i = 0; i < header.MeshCount; i++) {
+        const CookedMeshEntry& entry = entries[i];
+        if (entry.VertexOffset + uint64_t(entry.VertexCount) * sizeof(Vertex) > size
+            || entry.IndexOffset + uint64_t(entry.IndexCount) * sizeof(uint32_t) > size
+            || entry.LodOffset + uint64_t(entry.LodCount) * sizeof(MeshLod) > size
+            || entry.TextureOffset > size) {
+            Close();
+            return false;
+        }
+
+        CookedMesh& mesh = m_Meshes[i];
+        mesh.Vertices = reinterpret_cast<const Vertex*>(data + entry.VertexOffset);
+        mesh.VertexCount = entry.VertexCount;
+        mesh.Indices = reinterpret_cast<const uint32_t*>(data + entry.IndexOffset);
+        mesh.IndexCount = entry.IndexCount;
+        mesh.Lods = reinterpret_cast<const MeshLod*>(data + entry.LodOffset);
+        mesh.LodCount = entry.LodCount;
+        for (uint32_t level = 0; level < mesh.LodCount; level++) {
+            if (uint64_t(mesh.Lods[level].IndexOffset) + mesh.Lods[level].IndexCount > entry.IndexCount) {
+                Close();
+                return false;
+            }
+        }
+        mesh.Bounds = AABB(entry.BoundsMin, entry.BoundsMax);
+        mesh.Sphere = BoundingSphere(entry.SphereCenter, entry.SphereRadius);
+
+        uint64_t cursor = entry.TextureOffset;
+        for (uint32_t t = 0; t < entry.TextureCount; t++) {
+            uint32_t length = 0;
+            if (cursor + sizeof(length) > size) { Close(); return false; }
+            std::memcpy(&length, data + cursor, sizeof(length));
+            cursor += sizeof(length);
+            if (cursor + length > size) { Close(); return false; }
+            mesh.DiffuseTextures.emplace_back(reinterpret_cast<const char*>(data + cursor), length);
+            cursor += length;
+        }
+    }
+    return true;
+}
+
+void MeshCache::Close() {
+    m_Meshes.clear();
+    m_File.Close();
+}
@@ -0,0 +1,54 @@
+// src/Renderer/Model/MeshCache.h
+#pragma once
+
+#include "Mesh.h"
+#include "../Bounds.h"
+#include "../../Core/MappedFile.h"
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// View over a cooked mesh. The pointers reference either the mapped cache file
+// (when reading) or the imported model data (when writing).
+struct CookedMesh {
+    const Vertex* Vertices = nullptr;
+    uint32_t VertexCount = 0;
+    const uint32_t* Indices = nullptr;
+    uint32_t IndexCount = 0;
+    const MeshLod* Lods = nullptr; // Ranges of the index block, level 0 first
+    uint32_t LodCount = 0;
+    std::vector<std::string> DiffuseTextures; // Paths relative to the model directory
+    AABB Bounds;
+    BoundingSphere Sphere;
+};
+
+// Binary cache of the models imported through Assimp.
+// Vertex blobs are stored in the `Vertex` layout, so once the file is mapped they
+// are handed as-is to VertexBuffer/IndexBuffer without any per-vertex parsing.
+// A cache file is stale as soon as the source content (material libraries
+// included), the import flags or the format version change.
+class MeshCache {
+public:
+    static constexpr uint32_t FormatVersion = 5;
+
+    // Cache file associated with a source model (stored next to it)
+    static std::string GetCachePath(const std::string& sourcePath);
+
+    // Hash identifying a source: file content + import flags + format version.
+    // For OBJ files, the referenced .mtl files and the texture paths they
+    // list are part of the content.
+    static bool ComputeSourceHash(const std::string& sourcePath, uint32_t importFlags, uint64_t& outHash);
+
+    static bool Write(const std::string& cachePath, uint64_t sourceHash, const std::vector<CookedMesh>& meshes);
+
+    // Maps the file and validates its header.
+    // Returns false if the cache is missing, corrupted or stale.
+    bool Open(const std::string& cachePath, uint64_t expectedHash);
+    void Close();
+
+    const std::vector<CookedMesh>& GetMeshes() const { return m_Meshes; }
+
+private:
+    MappedFile m_File;
+    std::vector<CookedMesh> m_Meshes;
+};
@@ -0,0 +1,444 @@
+// src/Renderer/Model/MeshOptimizer.cpp
+#include "MeshOptimizer.h"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+// Forsyth's scoring parameters (from "Linear-Speed Vertex Cache Optimisation")
+static constexpr uint32_t FORSYTH_CACHE_SIZE = 32;
+static constexpr float FORSYTH_CACHE_DECAY_POWER = 1.5f;
+static constexpr float FORSYTH_LAST_TRIANGLE_SCORE = 0.75f;
+static constexpr float FORSYTH_VALENCE_BOOST_SCALE = 2.0f;
+static constexpr float FORSYTH_VALENCE_BOOST_POWER = 0.5f;
+static constexpr uint32_t FORSYTH_MAX_VALENCE = 64;
+
+static constexpr uint32_t INVALID_INDEX = 0xFFFFFFFFu;
+
+static_assert(sizeof(Vertex) == 8 * sizeof(float), "Vertex must not contain padding: welding compares raw bytes");
+
+// --- Welding ---
+static uint32_t HashVertex(const Vertex& vertex) {
+    uint32_t words[sizeof(Vertex) / sizeof(uint32_t)];
+    std::memcpy(words, &vertex, sizeof(Vertex));
+    uint32_t hash = 2166136261u;
+    for (uint32_t word : words) {
+        // Murmur-style mix per word, FNV-style combine
+        word *= 0xCC9E2D51u;
+        word = (word << 15) | (word >> 17);
+        word *= 0x1B873593u;
+        hash = (hash ^ word) * 16777619u;
+    }
+    return hash ^ (hash >> 16);
+}
+
+uint32_t MeshOptimizer::WeldVertices(std::vector<Vertex>& vertices, std::vector<uint32_t>& indices) {
+    const uint32_t vertexCount = static_cast<uint32_t>(vertices.size());
+    if (vertexCount == 0) {
+        return 0;
+    }
+
+    // Open addressing, load factor <= 0.5
+    uint32_t tableSize = 16;
+    while (tableSize < vertexCount * 2) {
+        tableSize *= 2;
+    }
+    std::vector<uint32_t> table(tableSize, INVALID_INDEX);
+    std::vector<uint32_t> remap(vertexCount);
+
+    // Unique vertices are compacted in place: the write cursor never passes the
+    // read cursor, so the table only points at already-compacted entries.
+    uint32_t uniqueCount = 0;
+    for (uint32_t v = 0; v < vertexCount; v++) {
+        uint32_t slot = HashVertex(vertices[v]) & (tableSize - 1);
+        while (table[slot] != INVALID_INDEX && std::memcmp(&vertices[table[slot]], &vertices[v], sizeof(Vertex)) != 0) {
+            slot = (slot + 1) & (tableSize - 1);
+        }
+        if (table[slot] == INVALID_INDEX) {
+            vertices[uniqueCount] = vertices[v];
+            table[slot] = uniqueCount++;
+        }
+        remap[v] = table[slot];
+    }
+
+    for (uint32_t& index : indices) {
+        index = remap[index];
+    }
+    vertices.resize(uniqueCount);
+    return uniqueCount;
+}
+
+// --- Vertex cache (Forsyth) ---
+struct ForsythScoreTable {
+    float Cache[FORSYTH_CACHE_SIZE];
+    float Valence[FORSYTH_MAX_VALENCE + 1];
+
+    ForsythScoreTable() {
+        for (uint32_t i = 0; i < FORSYTH_CACHE_SIZE; i++) {
+            if (i < 3) {
+                // The last triangle's vertices score the same whatever their order,
+                // and lower than the next few so the strip does not fold back on itself
+                Cache[i] = FORSYTH_LAST_TRIANGLE_SCORE;
+            } else {
+                float scale = 1.0f / static_cast<float>(FORSYTH_CACHE_SIZE - 3);
+                Cache[i] = std::pow(1.0f - static_cast<float>(i - 3) * scale, FORSYTH_CACHE_DECAY_POWER);
+            }
+        }
+        Valence[0] = 0.0f;
+        for (uint32_t i = 1; i <= FORSYTH_MAX_VALENCE; i++) {
+            // Vertices with few triangles left are finished first, to free cache slots
+            Valence[i] = FORSYTH_VALENCE_BOOST_SCALE * std::pow(static_cast<float>(i), -FORSYTH_VALENCE_BOOST_POWER);
+        }
+    }
+};
+
+static float ScoreVertex(const ForsythScoreTable& table, int32_t cachePosition, uint32_t valence) {
+    if (valence == 0) {
+        return -1.0f; // No triangle left to draw
+    }
+    float score = cachePosition >= 0 ? table.Cache[cachePosition] : 0.0f;
+    return score + table.Valence[std::min(valence, FORSYTH_MAX_VALENCE)];
+}
+
+void MeshOptimizer::OptimizeVertexCache(uint32_t* indices, size_t indexCount, uint32_t vertexCount) {
+    static const ForsythScoreTable s_ScoreTable;
+    const size_t triangleCount = indexCount / 3;
+    if (triangleCount == 0 || vertexCount == 0) {
+        return;
+    }
+
+    // Vertex -> remaining triangles adjacency, as one flat array
+    std::vector<uint32_t> valence(vertexCount, 0);
+    for (size_t i = 0; i < triangleCount * 3; i++) {
+        valence[indices[i]]++;
+    }
+    std::vector<uint32_t> adjacencyOffsets(vertexCount + 1, 0);
+    for (uint32_t v = 0; v < vertexCount; v++) {
+        adjacencyOffsets[v + 1] = adjacencyOffsets[v] + valence[v];
+    }
+    std::vector<uint32_t> adjacency(adjacencyOffsets[vertexCount]);
+    {
+        std::vector<uint32_t> fill(adjacencyOffsets.begin(), adjacencyOffsets.end() - 1);
+        for (size_t i = 0; i < triangleCount * 3; i++) {
+            adjacency[fill[indices[i]]++] = static_cast<uint32_t>(i / 3);
+        }
+    }
+
+    std::vector<int32_t> cachePosition(vertexCount, -1);
+    std::vector<float> vertexScore(vertexCount);
+    for (uint32_t v = 0; v < vertexCount; v++) {
+        vertexScore[v] = ScoreVertex(s_ScoreTable, -1, valence[v]);
+    }
+
+    std::vector<uint8_t> emitted(triangleCount, 0);
+    uint32_t bestTriangle = INVALID_INDEX;
+    float bestScore = -1.0f;
+    for (size_t t = 0; t < triangleCount; t++) {
+        const uint32_t* triangle = indices + t * 3;
+        float score = vertexScore[triangle[0]] + vertexScore[triangle[1]] + vertexScore[triangle[2]];
+        if (score > bestScore) {
+            bestScore = score;
+            bestTriangle = static_cast<uint32_t>(t);
+        }
+    }
+
+    std::vector<uint32_t> output(triangleCount * 3);
+    uint32_t cache[FORSYTH_CACHE_SIZE + 3];
+    uint32_t cacheCount = 0;
+    size_t scanCursor = 0;
+
+    for (size_t outputTriangle = 0; outputTriangle < triangleCount; outputTriangle++) {
+        if (bestTriangle == INVALID_INDEX) {
+            // Nothing adjacent to the cache: restart from the first triangle left
+            while (emitted[scanCursor]) {
+                scanCursor++;
+            }
+            bestTriangle = static_cast<uint32_t>(scanCursor);
+        }
+
+        const uint32_t triangle[3] = { indices[bestTriangle * 3 + 0], indices[bestTriangle * 3 + 1], indices[bestTriangle * 3 + 2] };
+        output[outputTriangle * 3 + 0] = triangle[0];
+        output[outputTriangle * 3 + 1] = triangle[1];
+        output[outputTriangle * 3 + 2] = triangle[2];
+        emitted[bestTriangle] = 1;
+
+        for (uint32_t vertex : triangle) {
+            // Swap-remove the triangle from the vertex's remaining list
+            uint32_t begin = adjacencyOffsets[vertex];
+            uint32_t end = begin + valence[vertex];
+            for (uint32_t i = begin; i < end; i++) {
+                if (adjacency[i] == bestTriangle) {
+                    adjacency[i] = adjacency[end - 1];
+                    valence[vertex]--;
+                    break;
+                }
+            }
+        }
+
+        // New LRU order: the triangle's vertices in front, then the previous entries
+        uint32_t newCache[FORSYTH_CACHE_SIZE + 3];
+        uint32_t newCount = 0;
+        for (uint32_t vertex : triangle) {
+            if (std::find(newCache, newCache + newCount, vertex) == newCache + newCount) {
+                newCache[newCount++] = vertex;
+            }
+        }
+        for (uint32_t i = 0; i < cacheCount; i++) {
+            uint32_t vertex = cache[i];
+            if (std::find(newCache, newCache + newCount, vertex) == newCache + newCount) {
+                newCache[newCount++] = vertex;
+            }
+        }
+
+        // Rescore every vertex whose position changed, including the ones pushed out
+        for (uint32_t i = 0; i < newCount; i++) {
+            uint32_t vertex = newCache[i];
+            int32_t position = i < FORSYTH_CACHE_SIZE ? static_cast<int32_t>(i) : -1;
+            cachePosition[vertex] = position;
+            vertexScore[vertex] = ScoreVertex(s_ScoreTable, position, valence[vertex]);
+        }
+        cacheCount = std::min(newCount, FORSYTH_CACHE_SIZE);
+        std::memcpy(cache, newCache, cacheCount * sizeof(uint32_t));
+
+        // Next triangle: the best one touching the cache
+        bestTriangle = INVALID_INDEX;
+        bestScore = -1.0f;
+        for (uint32_t i = 0; i < cacheCount; i++) {
+            uint32_t vertex = cache[i];
+            uint32_t begin = adjacencyOffsets[vertex];
+            uint32_t end = begin + valence[vertex];
+            for (uint32_t j = begin; j < end; j++) {
+                uint32_t t = adjacency[j];
+                const uint32_t* candidate = indices + static_cast<size_t>(t) * 3;
+                float score = vertexScore[candidate[0]] + vertexScore[candidate[1]] + vertexScore[candidate[2]];
+                if (score > bestScore) {
+                    bestScore = score;
+                    bestTriangle = t;
+                }
+            }
+        }
+    }
+
+    std::memcpy(indices, output.data(), output.size() * sizeof(uint32_t));
+}
+
+// --- Overdraw ---
+// FIFO cache simulated with timestamps: a vertex is resident while fewer than
+// `cacheSize` misses happened since its own.
+struct FifoCacheSimulator {
+    std::vector<uint32_t> Timestamps;
+    uint32_t Time;
+    uint32_t Size;
+
+    FifoCacheSimulator(uint32_t entryCount, uint32_t size) : Timestamps(entryCount, 0), Time(size + 1), Size(size) {}
+
+    bool Access(uint32_t entry) {
+        if (Time - Timestamps[entry] > Size) {
+            Timestamps[entry] = Time++;
+            return false;
+        }
+        return true;
+    }
+
+    void Flush() { Time += Size + 1; }
+};
+
+static uint32_t CountTriangleMisses(FifoCacheSimulator& cache, const uint32_t* triangle) {
+    uint32_t misses = 0;
+    for (int i = 0; i < 3; i++) {
+        misses += cache.Access(triangle[i]) ? 0 : 1;
+    }
+    return misses;
+}
+
+void MeshOptimizer::OptimizeOverdraw(uint32_t* indices, size_t indexCount, const Vertex* vertices, uint32_t vertexCount, float threshold) {
+    const size_t triangleCount = indexCount / 3;
+    if (triangleCount < 2 || vertexCount == 0) {
+        return;
+    }
+
+    // 1. Hard boundaries: triangles where the cache was cold anyway (three misses)
+    std::vector<size_t> hardClusters;
+    {
+        FifoCacheSimulator cache(vertexCount, ANALYZE_CACHE_SIZE);
+        for (size_t t = 0; t < triangleCount; t++) {
+            if (CountTriangleMisses(cache, indices + t * 3) == 3 || t == 0) {
+                hardClusters.push_back(t);
+            }
+        }
+    }
+    hardClusters.push_back(triangleCount);
+
+    // 2. Soft boundaries: split a cluster as soon as its prefix is as cheap as
+    // the whole cluster (within threshold), so the restart costs little ACMR
+    std::vector<size_t> clusters;
+    FifoCacheSimulator cache(vertexCount, ANALYZE_CACHE_SIZE);
+    for (size_t c = 0; c + 1 < hardClusters.size(); c++) {
+        const size_t begin = hardClusters[c];
+        const size_t end = hardClusters[c + 1];
+
+        cache.Flush();
+        uint32_t clusterMisses = 0;
+        for (size_t t = begin; t < end; t++) {
+            clusterMisses += CountTriangleMisses(cache, indices + t * 3);
+        }
+        const float clusterThreshold = threshold * static_cast<float>(clusterMisses) / static_cast<float>(end - begin);
+
+        cache.Flush();
+        size_t start = begin;
+        uint32_t runningMisses = 0;
+        clusters.push_back(begin);
+        for (size_t t = begin; t < end; t++) {
+            runningMisses += CountTriangleMisses(cache, indices + t * 3);
+            if (t + 1 < end && static_cast<float>(runningMisses) <= clusterThreshold * static_cast<float>(t + 1 - start)) {
+                clusters.push_back(t + 1);
+                start = t + 1;
+                runningMisses = 0;
+                cache.Flush();
+            }
+        }
+    }
+    clusters.push_back(triangleCount);
+    const size_t clusterCount = clusters.size() - 1;
+    if (clusterCount < 2) {
+        return;
+    }
+
+    // 3. Sort key: how much the cluster faces away from the mesh center.
+    // Area-weighted centroids and normals (the cross product length is twice the area).
+    std::vector<glm::vec3> clusterCentroids(clusterCount);
+    std::vector<glm::vec3> clusterNormals(clusterCount);
+    glm::vec3 meshCentroid(0.0f);
+    float meshArea = 0.0f;
+    for (size_t c = 0; c < clusterCount; c++) {
+        glm::vec3 centroid(0.0f);
+        glm::vec3 normal(0.0f);
+        float area = 0.0f;
+        for (size_t t = clusters[c]; t < clusters[c + 1]; t++) {
+            const glm::vec3& p0 = vertices[indices[t * 3 + 0]].Position;
+            const glm::vec3& p1 = vertices[indices[t * 3 + 1]].Position;
+            const glm::vec3& p2 = vertices[indices[t * 3 + 2]].Position;
+            glm::vec3 triangleNormal = glm::cross(p1 - p0, p2 - p0);
+            float triangleArea = glm::length(triangleNormal);
+            centroid += (p0 + p1 + p2) * (triangleArea / 3.0f);
+            normal += triangleNormal;
+            area += triangleArea;
+        }
+        meshCentroid += centroid;
+        meshArea += area;
+        clusterCentroids[c] = area > 0.0f ? centroid / area : centroid;
+        clusterNormals[c] = normal;
+    }
+    if (meshArea > 0.0f) {
+        meshCentroid /= meshArea;
+    }
+
+    std::vector<float> sortKeys(clusterCount);
+    for (size_t c = 0; c < clusterCount; c++) {
+        float length = glm::length(clusterNormals[c]);
+        sortKeys[c] = length > 0.0f ? glm::dot(clusterCentroids[c] - meshCentroid, clusterNormals[c] / length) : 0.0f;
+    }
+
+    std::vector<uint32_t> order(clusterCount);
+    for (size_t c = 0; c < clusterCount; c++) {
+        order[c] = static_cast<uint32_t>(c);
+    }
+    std::stable_sort(order.begin(), order.end(), [&](uint32_t a, uint32_t b) { return sortKeys[a] > sortKeys[b]; });
+
+    std::vector<uint32_t> output;
+    output.reserve(triangleCount * 3);
+    for (uint32_t c : order) {
+        output.insert(output.end(), indices + clusters[c] * 3, indices + clusters[c + 1] * 3);
+    }
+    std::memcpy(indices, output.data(), output.size() * sizeof(uint32_t));
+}
+
+// --- Vertex fetch ---
+uint32_t MeshOptimizer::OptimizeVertexFetch(std::vector<Vertex>& vertices, std::vector<uint32_t>& indices) {
+    std::vector<uint32_t> remap(vertices.size(), INVALID_INDEX);
+    uint32_t nextVertex = 0;
+    for (uint32_t& index : indices) {
+        if (remap[index] == INVALID_INDEX) {
+            remap[index] = nextVertex++;
+        }
+        index = remap[index];
+    }
+
+    std::vector<Vertex> reordered(nextVertex);
+    for (size_t v = 0; v < vertices.size(); v++) {
+        if (remap[v] != INVALID_INDEX) {
+            reordered[remap[v]] = vertices[v];
+        }
+    }
+    vertices.swap(reordered);
+    return nextVertex;
+}
+
+// --- Analysis ---
+static uint32_t CountReferencedVertices(const uint32_t* indices, size_t indexCount, uint32_t vertexCount) {
+    std::vector<uint8_t> referenced(vertexCount, 0);
+    uint32_t count = 0;
+    for (size_t i = 0; i < indexCount; i++) {
+        count += referenced[indices[i]] ? 0 : 1;
+        referenced[indices[i]] = 1;
+    }
+    return count;
+}
+
+VertexCacheStats MeshOptimizer::AnalyzeVertexCache(const uint32_t* indices, size_t indexCount, uint32_t vertexCount, uint32_t cacheSize) {
+    VertexCacheStats stats;
+    if (indexCount < 3 || vertexCount == 0) {
+        return stats;
+    }
+
+    FifoCacheSimulator cache(vertexCount, cacheSize);
+    for (size_t i = 0; i < indexCount; i++) {
+        stats.VerticesTransformed += cache.Access(indices[i]) ? 0 : 1;
+    }
+    stats.ACMR = static_cast<float>(stats.VerticesTransformed) / static_cast<float>(indexCount / 3);
+    stats.ATVR = static_cast<float>(stats.VerticesTransformed) / static_cast<float>(CountReferencedVertices(indices, indexCount, vertexCount));
+    return stats;
+}
+
+VertexFetchStats MeshOptimizer::AnalyzeVertexFetch(const uint32_t* indices, size_t indexCount, uint32_t vertexCount, uint32_t vertexSize) {
+    VertexFetchStats stats;
+    if (indexCount == 0 || vertexCount == 0) {
+        return stats;
+    }
+
+    // Only vertices that miss the post-transform cache are fetched
+    const uint32_t lineCount = static_cast<uint32_t>((static_cast<uint64_t>(vertexCount) * vertexSize + ANALYZE_CACHE_LINE - 1) / ANALYZE_CACHE_LINE);
+    FifoCacheSimulator vertexCache(vertexCount, ANALYZE_CACHE_SIZE);
+    FifoCacheSimulator lineCache(lineCount, ANALYZE_CACHE_LINES);
+    for (size_t i = 0; i < indexCount; i++) {
+        uint32_t vertex = indices[i];
+        if (vertexCache.Access(vertex)) {
+            continue;
+        }
+        uint64_t firstByte = static_cast<uint64_t>(vertex) * vertexSize;
+        uint32_t firstLine = static_cast<uint32_t>(firstByte / ANALYZE_CACHE_LINE);
+        uint32_t lastLine = static_cast<uint32_t>((firstByte + vertexSize - 1) / ANALYZE_CACHE_LINE);
+        for (uint32_t line = firstLine; line <= lastLine; line++) {
+            stats.BytesFetched += lineCache.Access(line) ? 0 : ANALYZE_CACHE_LINE;
+        }
+    }
+    uint64_t referencedBytes = static_cast<uint64_t>(CountReferencedVertices(indices, indexCount, vertexCount)) * vertexSize;
+    stats.Overfetch = static_cast<float>(stats.BytesFetched) / static_cast<float>(referencedBytes);
+    return stats;
+}
+
+MeshOptimizationReport MeshOptimizer::Optimize(std::vector<Vertex>& vertices, std::vector<uint32_t>& indices) {
+    MeshOptimizationReport report;
+    report.VerticesBefore = static_cast<uint32_t>(vertices.size());
+    report.CacheBefore = AnalyzeVertexCache(indices.data(), indices.size(), report.VerticesBefore);
+    report.FetchBefore = AnalyzeVertexFetch(indices.data(), indices.size(), report.VerticesBefore, sizeof(Vertex));
+
+    uint32_t vertexCount = WeldVertices(vertices, indices);
+    OptimizeVertexCache(indices.data(), indices.size(), vertexCount);
+    OptimizeOverdraw(indices.data(), indices.size(), vertices.data(), vertexCount);
+    vertexCount = OptimizeVertexFetch(vertices, indices);
+
+    report.VerticesAfter = vertexCount;
+    report.CacheAfter = AnalyzeVertexCache(indices.data(), indices.size(), vertexCount);
+    report.FetchAfter = AnalyzeVertexFetch(indices.data(), indices.size(), vertexCount, sizeof(Vertex));
+    return report;
+}
@@ -0,0 +1,67 @@
+// src/Renderer/Model/MeshOptimizer.h
+#pragma once
+
+#include "Mesh.h"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// Post-transform vertex cache efficiency of an index buffer, measured on a
+// simulated FIFO cache.
+struct VertexCacheStats {
+    uint32_t VerticesTransformed = 0;
+    float ACMR = 0.0f; // Transformed vertices per triangle (0.5 is the ideal for a regular grid, 3 the worst)
+    float ATVR = 0.0f; // Transformed vertices per referenced vertex (1 is ideal)
+};
+
+// Pre-transform vertex fetch efficiency: memory traffic for the vertices that
+// miss the post-transform cache, in cache lines.
+struct VertexFetchStats {
+    uint32_t BytesFetched = 0;
+    float Overfetch = 0.0f; // Bytes fetched / bytes of referenced vertices (1 is ideal)
+};
+
+struct MeshOptimizationReport {
+    uint32_t VerticesBefore = 0;
+    uint32_t VerticesAfter = 0;
+    VertexCacheStats CacheBefore;
+    VertexCacheStats CacheAfter;
+    VertexFetchStats FetchBefore;
+    VertexFetchStats FetchAfter;
+};
+
+// CPU-only mesh optimization, run on the import workers before the mesh is
+// cooked. Every step keeps the rendered result identical; only the order of
+// triangles and vertices (and duplicate vertices) change.
+class MeshOptimizer {
+public:
+    // Cache size assumed by the analyzers. Real GPUs vary (and are not strict
+    // FIFOs), so the numbers are comparable with each other, not absolute.
+    static constexpr uint32_t ANALYZE_CACHE_SIZE = 16;
+    static constexpr uint32_t ANALYZE_CACHE_LINE = 64;
+    static constexpr uint32_t ANALYZE_CACHE_LINES = 64;
+    // Overdraw reordering may lose at most this much ACMR
+    static constexpr float OVERDRAW_THRESHOLD = 1.05f;
+
+    // Runs the full pipeline below and measures it
+    static MeshOptimizationReport Optimize(std::vector<Vertex>& vertices, std::vector<uint32_t>& indices);
+
+    // Merges bitwise-identical vertices and remaps the indices. Returns the new vertex count.
+    static uint32_t WeldVertices(std::vector<Vertex>& vertices, std::vector<uint32_t>& indices);
+
+    // Reorders triangles for the post-transform vertex cache (Forsyth's
+    // linear-speed algorithm).
+    static void OptimizeVertexCache(uint32_t* indices, size_t indexCount, uint32_t vertexCount);
+
+    // Reorders clusters of the cache-optimized triangle list so that outward
+    // facing ones come first, which lets early-z reject more of what follows.
+    // Clusters are only split where it keeps ACMR within `threshold` of the input.
+    static void OptimizeOverdraw(uint32_t* indices, size_t indexCount, const Vertex* vertices, uint32_t vertexCount, float threshold = OVERDRAW_THRESHOLD);
+
+    // Renumbers vertices in order of first use so fetches walk memory linearly.
+    // Unreferenced vertices are dropped. Returns the new vertex count.
+    static uint32_t OptimizeVertexFetch(std::vector<Vertex>& vertices, std::vector<uint32_t>& indices);
+
+    static VertexCacheStats AnalyzeVertexCache(const uint32_t* indices, size_t indexCount, uint32_t vertexCount, uint32_t cacheSize = ANALYZE_CACHE_SIZE);
+    static VertexFetchStats AnalyzeVertexFetch(const uint32_t* indices, size_t indexCount, uint32_t vertexCount, uint32_t vertexSize);
+};
@@ -0,0 +1,485 @@
+// src/Renderer/Model/MeshSimplifier.cpp
+#include "MeshSimplifier.h"
+#include "../Bounds.h"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+
+static constexpr uint32_t INVALID_INDEX = 0xFFFFFFFFu;
+
+// Symmetric 4x4 quadric stored as its 10 distinct terms, plus the total weight
+struct Quadric {
+    float A00 = 0.0f, A11 = 0.0f, A22 = 0.0f;
+    float A10 = 0.0f, A20 = 0.0f, A21 = 0.0f;
+    float B0 = 0.0f, B1 = 0.0f, B2 = 0.0f;
+    float C = 0.0f;
+    float Weight = 0.0f;
+
+    // Squared distance to the plane n.p + d = 0 (n normalized), times weight
+    static Quadric FromPlane(const glm::vec3& n, float d, float weight) {
+        Quadric q;
+        q.A00 = weight * n.x * n.x;
+        q.A11 = weight * n.y * n.y;
+        q.A22 = weight * n.z * n.z;
+        q.A10 = weight * n.y * n.x;
+        q.A20 = weight * n.z * n.x;
+        q.A21 = weight * n.z * n.y;
+        q.B0 = weight * n.x * d;
+        q.B1 = weight * n.y * d;
+        q.B2 = weight * n.z * d;
+        q.C = weight * d * d;
+        q.Weight = weight;
+        return q;
+    }
+
+    void Add(const Quadric& other) {
+        A00 += other.A00; A11 += other.A11; A22 += other.A22;
+        A10 += other.A10; A20 += other.A20; A21 += other.A21;
+        B0 += other.B0; B1 += other.B1; B2 += other.B2;
+        C += other.C;
+        Weight += other.Weight;
+    }
+
+    float Evaluate(const glm::vec3& p) const {
+        float rx = A00 * p.x + A10 * p.y + A20 * p.z + B0;
+        float ry = A10 * p.x + A11 * p.y + A21 * p.z + B1;
+        float rz = A20 * p.x + A21 * p.y + A22 * p.z + B2;
+        float r = rx * p.x + ry * p.y + rz * p.z + (B0 * p.x + B1 * p.y + B2 * p.z) + C;
+        return std::fabs(r);
+    }
+};
+
+enum class VertexKind : uint8_t {
+    Manifold, // Interior vertex: may collapse onto any neighbor
+    Border,   // On exactly one open boundary: may only slide along it
+    Locked    // Seam, corner or non-manifold: never moves
+};
+
+struct CollapseCandidate {
+    uint32_t From;
+    uint32_t To;
+    float Error;
+};
+
+static uint64_t EdgeKey(uint32_t a, uint32_t b) {
+    return (static_cast<uint64_t>(a) << 32) | b;
+}
+
+static bool ContainsEdge(const std::vector<uint64_t>& sortedEdges, uint32_t a, uint32_t b) {
+    return std::binary_search(sortedEdges.begin(), sortedEdges.end(), EdgeKey(a, b));
+}
+
+// Maps every vertex to the first vertex sharing its exact position
+static void BuildPositionRemap(const Vertex* vertices, uint32_t vertexCount, std::vector<uint32_t>& outRemap, std::vector<uint32_t>& outWedgeCount) {
+    uint32_t tableSize = 16;
+    while (tableSize < vertexCount * 2) {
+        tableSize *= 2;
+    }
+    std::vector<uint32_t> table(tableSize, INVALID_INDEX);
+    outRemap.resize(vertexCount);
+    outWedgeCount.assign(vertexCount, 0);
+    for (uint32_t v = 0; v < vertexCount; v++) {
+        uint32_t bits[3];
+        std::memcpy(bits, &vertices[v].Position, sizeof(bits));
+        uint32_t hash = (bits[0] * 73856093u) ^ (bits[1] * 19349663u) ^ (bits[2] * 83492791u);
+        uint32_t slot = (hash ^ (hash >> 15)) & (tableSize - 1);
+        while (table[slot] != INVALID_INDEX && std::memcmp(&vertices[table[slot]].Position, &vertices[v].Position, sizeof(glm::vec3)) != 0) {
+            slot = (slot + 1) & (tableSize - 1);
+        }
+        if (table[slot] == INVALID_INDEX) {
+            table[slot] = v;
+        }
+        outRemap[v] = table[slot];
+        outWedgeCount[table[slot]]++;
+    }
+}
+
+std::vector<uint32_t> MeshSimplifier::Simplify(const Vertex* vertices, uint32_t vertexCount,
+                                               const uint32_t* indices, size_t indexCount,
+                                               size_t targetIndexCount, float targetError, float* outError) {
+    std::vector<uint32_t> result(indices, indices + indexCount / 3 * 3);
+    if (outError) {
+        *outError = 0.0f;
+    }
+    if (result.size() <= targetIndexCount || vertexCount == 0) {
+        return result;
+    }
+
+    // Work in a unit box so errors and the float quadrics are scale-independent
+    AABB bounds;
+    for (uint32_t v = 0; v < vertexCount; v++) {
+        bounds.Expand(vertices[v].Position);
+    }
+    const glm::vec3 extents = bounds.Max - bounds.Min;
+    const float extent = std::max(std::max(extents.x, extents.y), std::max(extents.z, 1e-12f));
+    const float inverseExtent = 1.0f / extent;
+    std::vector<glm::vec3> positions(vertexCount);
+    for (uint32_t v = 0; v < vertexCount; v++) {
+        positions[v] = (vertices[v].Position - bounds.Min) * inverseExtent;
+    }
+
+    // --- Topology: seams and open borders ---
+    std::vector<uint32_t> positionRemap, wedgeCount;
+    BuildPositionRemap(vertices, vertexCount, positionRemap, wedgeCount);
+
+    std::vector<uint64_t> edges;
+    edges.reserve(result.size());
+    for (size_t i = 0; i < result.size(); i += 3) {
+        for (int e = 0; e < 3; e++) {
+            edges.push_back(EdgeKey(positionRemap[result[i + e]], positionRemap[result[i + (e + 1) % 3]]));
+        }
+    }
+    std::sort(edges.begin(), edges.end());
+
+    // An edge is open when no triangle uses it in the opposite direction
+    std::vector<uint64_t> borderEdges;
+    std::vector<uint8_t> borderOut(vertexCount, 0), borderIn(vertexCount, 0);
+    for (uint64_t edge : edges) {
+        uint32_t a = static_cast<uint32_t>(edge >> 32);
+        uint32_t b = static_cast<uint32_t>(edge);
+        if (!ContainsEdge(edges, b, a)) {
+            borderEdges.push_back(edge);
+            borderOut[a] = static_cast<uint8_t>(std::min(borderOut[a] + 1, 255));
+            borderIn[b] = static_cast<uint8_t>(std::min(borderIn[b] + 1, 255));
+        }
+    }
+
+    std::vector<VertexKind> kinds(vertexCount, VertexKind::Manifold);
+    for (uint32_t v = 0; v < vertexCount; v++) {
+        uint32_t p = positionRemap[v];
+        if (wedgeCount[p] > 1) {
+            kinds[v] = VertexKind::Locked;
+        } else if (borderOut[p] == 1 && borderIn[p] == 1) {
+            kinds[v] = VertexKind::Border;
+        } else if (borderOut[p] != 0 || borderIn[p] != 0) {
+            kinds[v] = VertexKind::Locked;
+        }
+    }
+
+    // --- Quadrics: area-weighted face planes, plus border planes ---
+    std::vector<Quadric> quadrics(vertexCount);
+    for (size_t i = 0; i < result.size(); i += 3) {
+        const uint32_t triangle[3] = { result[i], result[i + 1], result[i + 2] };
+        const glm::vec3& p0 = positions[triangle[0]];
+        glm::vec3 normal = glm::cross(positions[triangle[1]] - p0, positions[triangle[2]] - p0);
+        float area = glm::length(normal);
+        if (area <= 0.0f) {
+            continue;
+        }
+        normal /= area;
+        Quadric face = Quadric::FromPlane(normal, -glm::dot(normal, p0), area);
+        for (int e = 0; e < 3; e++) {
+            quadrics[triangle[e]].Add(face);
+        }
+
+        for (int e = 0; e < 3; e++) {
+            uint32_t a = triangle[e];
+            uint32_t b = triangle[(e + 1) % 3];
+            if (!ContainsEdge(borderEdges, positionRemap[a], positionRemap[b])) {
+                continue;
+            }
+            glm::vec3 edge = positions[b] - positions[a];
+            float length = glm::length(edge);
+            if (length <= 0.0f) {
+                continue;
+            }
+            glm::vec3 planeNormal = glm::normalize(glm::cross(edge, normal));
+            Quadric border = Quadric::FromPlane(planeNormal, -glm::dot(planeNormal, positions[a]), length * length * BORDER_WEIGHT);
+            quadrics[a].Add(border);
+            quadrics[b].Add(border);
+        }
+    }
+
+    // --- Collapse passes ---
+    // Each pass ranks every candidate edge, then applies the cheapest ones
+    // whose neighborhoods do not overlap, so the flip checks stay valid.
+    const float maxError = targetError * targetError;
+    float reachedError = 0.0f;
+    std::vector<CollapseCandidate> candidates;
+    std::vector<uint32_t> remap(vertexCount);
+    std::vector<uint8_t> touched(vertexCount);
+    std::vector<uint32_t> adjacencyOffsets(vertexCount + 1);
+    std::vector<uint32_t> adjacency;
+
+    while (result.size() > targetIndexCount) {
+        // Vertex -> triangle adjacency of the current result
+        std::fill(adjacencyOffsets.begin(), adjacencyOffsets.end(), 0);
+        for (uint32_t index : result) {
+            adjacencyOffsets[index + 1]++;
+        }
+        for (uint32_t v = 0; v < vertexCount; v++) {
+            adjacencyOffsets[v + 1] += adjacencyOffsets[v];
+        }
+        adjacency.resize(result.size());
+        {
+            std::vector<uint32_t> fill(adjacencyOffsets.begin(), adjacencyOffsets.end() - 1);
+            for (size_t i = 0; i < result.size(); i++) {
+                adjacency[fill[result[i]]++] = static_cast<uint32_t>(i / 3);
+            }
+        }
+
+        candidates.clear();
+        for (size_t i = 0; i < result.size(); i += 3) {
+            for (int e = 0; e < 3; e++) {
+                uint32_t a = result[i + e];
+                uint32_t b = result[i + (e + 1) % 3];
+                for (int direction = 0; direction < 2; direction++) {
+                    uint32_t from = direction == 0 ? a : b;
+                    uint32_t to = direction == 0 ? b : a;
+                    if (kinds[from] == VertexKind::Locked) {
+                        continue;
+                    }
+                    if (kinds[from] == VertexKind::Border
+                        && !ContainsEdge(borderEdges, positionRemap[from], positionRemap[to])
+                        && !ContainsEdge(borderEdges, positionRemap[to], positionRemap[from])) {
+                        continue;
+                    }
+                    Quadric merged = quadrics[from];
+                    merged.Add(quadrics[to]);
+                    float error = merged.Weight > 0.0f ? merged.Evaluate(positions[to]) / merged.Weight : 0.0f;
+                    candidates.push_back({ from, to, error });
+                }
+            }
+        }
+        std::sort(candidates.begin(), candidates.end(), [](const CollapseCandidate& a, const CollapseCandidate& b) {
+            return a.Error < b.Error;
+        });
+
+        for (uint32_t v = 0; v < vertexCount; v++) {
+            remap[v] = v;
+        }
+        std::fill(touched.begin(), touched.end(), 0);
+
+        // A manifold collapse removes two triangles, a border one removes one
+        const size_t trianglesToRemove = (result.size() - targetIndexCount) / 3;
+        size_t trianglesRemoved = 0;
+        size_t collapses = 0;
+        for (const CollapseCandidate& candidate : candidates) {
+            if (candidate.Error > maxError || trianglesRemoved >= trianglesToRemove) {
+                break;
+            }
+            const uint32_t from = candidate.From;
+            const uint32_t to = candidate.To;
+            if (touched[from] || touched[to]) {
+                continue;
+            }
+
+            // Reject collapses that would flip (or fold to zero area) a remaining triangle
+            bool flips = false;
+            uint32_t removed = 0;
+            for (uint32_t j = adjacencyOffsets[from]; j < adjacencyOffsets[from + 1] && !flips; j++) {
+                const uint32_t* triangle = result.data() + static_cast<size_t>(adjacency[j]) * 3;
+                if (triangle[0] == to || triangle[1] == to || triangle[2] == to) {
+                    removed++;
+                    continue;
+                }
+                int corner = triangle[0] == from ? 0 : (triangle[1] == from ? 1 : 2);
+                const glm::vec3& p1 = positions[triangle[(corner + 1) % 3]];
+                const glm::vec3& p2 = positions[triangle[(corner + 2) % 3]];
+                glm::vec3 before = glm::cross(p1 - positions[from], p2 - positions[from]);
+                glm::vec3 after = glm::cross(p1 - positions[to], p2 - positions[to]);
+                flips = glm::dot(before, after) <= 1e-4f * glm::dot(before, before);
+            }
+            if (flips) {
+                continue;
+            }
+
+            // Lock the whole one-ring: a neighbor moving in the same pass could
+            // invalidate the flip test above
+            for (uint32_t j = adjacencyOffsets[from]; j < adjacencyOffsets[from + 1]; j++) {
+                const uint32_t* triangle = result.data() + static_cast<size_t>(adjacency[j]) * 3;
+                touched[triangle[0]] = touched[triangle[1]] = touched[triangle[2]] = 1;
+            }
+            touched[to] = 1;
+
+            remap[from] = to;
+            quadrics[to].Add(quadrics[from]);
+            reachedError = std::max(reachedError, candidate.Error);
+            trianglesRemoved += removed;
+            collapses++;
+        }
+        if (collapses == 0) {
+            break;
+        }
+
+        // Apply the collapses and drop the triangles that became degenerate
+        size_t write = 0;
+        for (size_t i = 0; i < result.size(); i += 3) {
+            uint32_t a = remap[result[i]];
+            uint32_t b = remap[result[i + 1]];
+            uint32_t c = remap[result[i + 2]];
+            if (a != b && b != c && a != c) {
+                result[write++] = a;
+                result[write++] = b;
+                result[write++] = c;
+            }
+        }
+        result.resize(write);
+    }
+
+    if (outError) {
+        *outError = std::sqrt(reachedError) * extent;
+    }
+    return result;
+}
+
+// --- Deviation ---
+
+// Cells per axis of the MeasureDeviation grid, at most
+static constexpr uint32_t DEVIATION_GRID_MAX = 64;
+
+// Closest point of triangle abc to p (Ericson, Real-Time Collision Detection 5.1.5)
+static glm::vec3 ClosestPointOnTriangle(const glm::vec3& p, const glm::vec3& a, const glm::vec3& b, const glm::vec3& c) {
+    const glm::vec3 ab = b - a;
+    const glm::vec3 ac = c - a;
+    const glm::vec3 ap = p - a;
+    const float d1 = glm::dot(ab, ap);
+    const float d2 = glm::dot(ac, ap);
+    if (d1 <= 0.0f && d2 <= 0.0f) {
+        return a;
+    }
+    const glm::vec3 bp = p - b;
+    const float d3 = glm::dot(ab, bp);
+    const float d4 = glm::dot(ac, bp);
+    if (d3 >= 0.0f && d4 <= d3) {
+        return b;
+    }
+    const float vc = d1 * d4 - d3 * d2;
+    if (vc <= 0.0f && d1 >= 0.0f && d3 <= 0.0f) {
+        return a + ab * (d1 / (d1 - d3));
+    }
+    const glm::vec3 cp = p - c;
+    const float d5 = glm::dot(ab, cp);
+    const float d6 = glm::dot(ac, cp);
+    if (d6 >= 0.0f && d5 <= d6) {
+        return c;
+    }
+    const float vb = d5 * d2 - d1 * d6;
+    if (vb <= 0.0f && d2 >= 0.0f && d6 <= 0.0f) {
+        return a + ac * (d2 / (d2 - d6));
+    }
+    const float va = d3 * d6 - d5 * d4;
+    if (va <= 0.0f && (d4 - d3) >= 0.0f && (d5 - d6) >= 0.0f) {
+        return b + (c - b) * ((d4 - d3) / ((d4 - d3) + (d5 - d6)));
+    }
+    const float denominator = 1.0f / (va + vb + vc);
+    return a + ab * (vb * denominator) + ac * (vc * denominator);
+}
+
+float MeshSimplifier::MeasureDeviation(const Vertex* vertices, uint32_t vertexCount,
+                                       const uint32_t* indices, size_t indexCount,
+                                       const uint32_t* lodIndices, size_t lodIndexCount) {
+    const size_t triangleCount = lodIndexCount / 3;
+    if (indexCount == 0 || triangleCount == 0 || vertexCount == 0) {
+        return 0.0f;
+    }
+
+    // --- Uniform grid over the LOD triangles, about one triangle per cell ---
+    AABB bounds;
+    for (size_t i = 0; i < triangleCount * 3; i++) {
+        bounds.Expand(vertices[lodIndices[i]].Position);
+    }
+    const glm::vec3 extents = bounds.Max - bounds.Min;
+    const float extent = std::max(std::max(extents.x, extents.y), std::max(extents.z, 1e-12f));
+    const float cellSize = std::max(extent / DEVIATION_GRID_MAX, extent / std::sqrt(static_cast<float>(triangleCount)));
+    const float inverseCellSize = 1.0f / cellSize;
+    int dims[3];
+    for (int axis = 0; axis < 3; axis++) {
+        dims[axis] = std::min(static_cast<int>(extents[axis] * inverseCellSize) + 1, static_cast<int>(DEVIATION_GRID_MAX));
+    }
+    auto cellOf = [&](const glm::vec3& position, int* cell) {
+        for (int axis = 0; axis < 3; axis++) {
+            const int coordinate = static_cast<int>(std::floor((position[axis] - bounds.Min[axis]) * inverseCellSize));
+            cell[axis] = std::min(std::max(coordinate, 0), dims[axis] - 1);
+        }
+    };
+
+    // Triangles listed in every cell their box overlaps (counting sort)
+    const size_t cellCount = static_cast<size_t>(dims[0]) * dims[1] * dims[2];
+    std::vector<uint32_t> cellStart(cellCount + 1, 0);
+    std::vector<uint32_t> cellTriangles;
+    for (int pass = 0; pass < 2; pass++) {
+        for (size_t t = 0; t < triangleCount; t++) {
+            AABB box;
+            for (int corner = 0; corner < 3; corner++) {
+                box.Expand(vertices[lodIndices[t * 3 + corner]].Position);
+            }
+            int first[3], last[3];
+            cellOf(box.Min, first);
+            cellOf(box.Max, last);
+            for (int z = first[2]; z <= last[2]; z++) {
+                for (int y = first[1]; y <= last[1]; y++) {
+                    for (int x = first[0]; x <= last[0]; x++) {
+                        const size_t cell = (static_cast<size_t>(z) * dims[1] + y) * dims[0] + x;
+                        if (pass == 0) {
+                            cellStart[cell + 1]++;
+                        } else {
+                            cellTriangles[cellStart[cell]++] = static_cast<uint32_t>(t);
+                        }
+                    }
+                }
+            }
+        }
+        if (pass == 0) {
+            for (size_t cell = 0; cell < cellCount; cell++) {
+                cellStart[cell + 1] += cellStart[cell];
+            }
+            cellTriangles.resize(cellStart[cellCount]);
+        } else {
+            // The fill advanced every start to the next cell's: shift back
+            for (size_t cell = cellCount; cell > 0; cell--) {
+                cellStart[cell] = cellStart[cell - 1];
+            }
+            cellStart[0] = 0;
+        }
+    }
+
+    // --- Nearest triangle of each vertex, searching rings of cells outward ---
+    // Once ring r is done, any triangle left is at least r cells away.
+    std::vector<bool> visited(vertexCount, false);
+    std::vector<uint32_t> testedBy(triangleCount, INVALID_INDEX);
+    float deviationSquared = 0.0f;
+    for (size_t i = 0; i < indexCount; i++) {
+        const uint32_t vertex = indices[i];
+        if (vertex >= vertexCount || visited[vertex]) {
+            continue;
+        }
+        visited[vertex] = true;
+
+        const glm::vec3& p = vertices[vertex].Position;
+        int center[3];
+        cellOf(p, center);
+        const int maxRing = std::max(std::max(dims[0], dims[1]), dims[2]);
+        float closestSquared = std::numeric_limits<float>::max();
+        for (int ring = 0; ring <= maxRing; ring++) {
+            for (int z = std::max(center[2] - ring, 0); z <= std::min(center[2] + ring, dims[2] - 1); z++) {
+                for (int y = std::max(center[1] - ring, 0); y <= std::min(center[1] + ring, dims[1] - 1); y++) {
+                    for (int x = std::max(center[0] - ring, 0); x <= std::min(center[0] + ring, dims[0] - 1); x++) {
+                        const int distance = std::max(std::max(std::abs(x - center[0]), std::abs(y - center[1])), std::abs(z - center[2]));
+                        if (distance != ring) {
+                            continue;
+                        }
+                        const size_t cell = (static_cast<size_t>(z) * dims[1] + y) * dims[0] + x;
+                        for (uint32_t entry = cellStart[cell]; entry < cellStart[cell + 1]; entry++) {
+                            const uint32_t t = cellTriangles[entry];
+                            if (testedBy[t] == vertex) {
+                                continue;
+                            }
+                            testedBy[t] = vertex;
+                            const glm::vec3 q = ClosestPointOnTriangle(p, vertices[lodIndices[t * 3]].Position,
+                                                                       vertices[lodIndices[t * 3 + 1]].Position, vertices[lodIndices[t * 3 + 2]].Position);
+                            closestSquared = std::min(closestSquared, glm::dot(p - q, p - q));
+                        }
+                    }
+                }
+            }
+            const float searched = ring * cellSize;
+            if (closestSquared <= searched * searched) {
+                break;
+            }
+        }
+        deviationSquared = std::max(deviationSquared, closestSquared);
+    }
+    return std::sqrt(deviationSquared);
+}
@@ -0,0 +1,36 @@
+// src/Renderer/Model/MeshSimplifier.h
+#pragma once
+
+#include "Mesh.h"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// Quadric error metric simplification (Garland & Heckbert), by edge collapse
+// onto existing vertices: the result indexes the input vertex array, so every
+// LOD of a mesh can share one vertex buffer.
+//
+// Open borders only collapse along themselves, and vertices on attribute seams
+// (same position, different normal/UV) are kept, so neither tears.
+class MeshSimplifier {
+public:
+    // Open edges get an extra perpendicular quadric this much heavier than
+    // the faces, so borders keep their outline
+    static constexpr float BORDER_WEIGHT = 10.0f;
+
+    // Collapses edges, cheapest first, until the index count reaches
+    // `targetIndexCount` or the next collapse would move the surface by more
+    // than `targetError` (relative to the mesh extent, e.g. 0.01 = 1%).
+    // outError receives the error reached, in object-space units.
+    static std::vector<uint32_t> Simplify(const Vertex* vertices, uint32_t vertexCount,
+                                          const uint32_t* indices, size_t indexCount,
+                                          size_t targetIndexCount, float targetError, float* outError = nullptr);
+
+    // Largest distance from a vertex of `indices` to the surface of
+    // `lodIndices` (one-sided Hausdorff distance), in object-space units.
+    // Exact, unlike the quadric error of Simplify, which averages plane
+    // distances and can under-report it. Both index the same vertices.
+    static float MeasureDeviation(const Vertex* vertices, uint32_t vertexCount,
+                                  const uint32_t* indices, size_t indexCount,
+                                  const uint32_t* lodIndices, size_t lodIndexCount);
+};
@@ -1,124 +1,365 @@
 // src/Renderer/Model/Model.cpp
 #include "Model.h"
 #include "Mesh.h"
+#include "MeshCache.h"
+#include "ModelImporter.h"
+#include "VertexQuantizer.h"
 #include "../Buffer.h"
+#include "../TextureCache.h"
+#include "../../Core/Profiler.h"
 #include <glad/glad.h>
 #include <assimp/Importer.hpp>
 #include <assimp/postprocess.h>
+#include <algorithm>
+#include <chrono>
 #include <iostream>
+#include <unordered_set>
+
+static constexpr unsigned int MODEL_IMPORT_FLAGS = aiProcess_Triangulate | aiProcess_FlipUVs | aiProcess_GenNormals;
+
+// Initial capacity of each mesh arena: 4 MiB of PackedVertex, 1M indices. Arenas grow on demand.
+static constexpr uint32_t ARENA_VERTEX_CAPACITY = 256 * 1024;
+static constexpr uint32_t ARENA_INDEX_CAPACITY = 1024 * 1024;
+// Instances the shared instance buffer starts with
+static constexpr uint32_t INSTANCE_BUFFER_CAPACITY = 1024;
+// Draws the draw index buffer of the indirect path starts with
+static constexpr uint32_t DRAW_INDEX_CAPACITY = 4096;
+// Instance k of a draw reads element BaseInstance + k / divisor: with the
+// largest divisor, every instance of the draw reads its base instance
+static constexpr uint32_t DRAW_INDEX_DIVISOR = 0xFFFFFFFFu;
+
+static std::unique_ptr<GeometryArena> s_Arenas[2]; // 16-bit, 32-bit indices
+static std::shared_ptr<DynamicBuffer> s_InstanceStream;
+static std::shared_ptr<VertexBuffer> s_InstanceBuffer; // Attribute view of s_InstanceStream
+static std::shared_ptr<VertexBuffer> s_DrawIndexBuffer;
+static uint32_t s_DrawIndexCount = 0;
+
+static double MillisecondsSince(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
 
 // --- Implémentation de la classe Model ---
 
-Model::Model(const std::string& path) {
+Model::Model(const std::string& path, MeshStorage storage) : m_Storage(storage) {
     loadModel(path);
 }
 
-void Model::Draw(Shader& shader) {
-    for (unsigned int i = 0; i < m_Meshes.size(); i++) {
-        m_Meshes[i].Draw(shader);
+void Model::loadModel(const std::string& path) {
+    PLUME_PROFILE_FUNCTION();
+    auto start = std::chrono::steady_clock::now();
+    m_Directory = path.substr(0, path.find_last_of('/'));
+
+    // 1. Fast path: the cooked cache is up to date, Assimp is skipped entirely
+    const std::string cachePath = MeshCache::GetCachePath(path);
+    uint64_t sourceHash = 0;
+    bool hasSourceHash = MeshCache::ComputeSourceHash(path, MODEL_IMPORT_FLAGS, sourceHash);
+    if (hasSourceHash && loadFromCache(cachePath, sourceHash)) {
+        computeBounds();
+        std::cout << "Model: " << path << " loaded from cache (" << m_Meshes.size() << " meshes) in "
+                  << MillisecondsSince(start) << " ms" << std::endl;
+        logMemoryUsage();
+        return;
     }
-}
 
-void Model::loadModel(const std::string& path) {
+    // 2. Full Assimp import, then cook the cache for the next launches
     Assimp::Importer importer;
-    const aiScene* scene = importer.ReadFile(path, aiProcess_Triangulate | aiProcess_FlipUVs | aiProcess_GenNormals);
+    const aiScene* scene = importer.ReadFile(path, MODEL_IMPORT_FLAGS);
 
     if (!scene || scene->mFlags & AI_SCENE_FLAGS_INCOMPLETE || !scene->mRootNode) {
         std::cerr << "ERREUR::ASSIMP::" << importer.GetErrorString() << std::endl;
         return;
     }
-    m_Directory = path.substr(0, path.find_last_of('/'));
-    processNode(scene->mRootNode, scene);
+    double readMs = MillisecondsSince(start);
+
+    // Vertex/index conversion runs on worker threads; GL buffers are created
+    // below, on the thread that owns the context.
+    auto convertStart = std::chrono::steady_clock::now();
+    std::vector<const aiMesh*> meshes;
+    ModelImporter::CollectMeshes(scene->mRootNode, scene, meshes);
+    std::vector<MeshData> meshData = ModelImporter::ConvertMeshes(meshes, scene);
+    double convertMs = MillisecondsSince(convertStart);
+
+    // The cache is cooked from the converted arrays, before the meshes take them over
+    if (hasSourceHash) {
+        writeCache(cachePath, sourceHash, meshData);
+    }
+    logOptimization(meshData);
+
+    // Arrays are moved, never copied, from the importer to the mesh, which
+    // releases them after the upload unless m_Storage keeps them
+    m_Meshes.reserve(meshData.size());
+    for (MeshData& data : meshData) {
+        std::vector<std::shared_ptr<Texture>> textures;
+        for (const auto& texturePath : data.DiffuseTextures) {
+            textures.push_back(loadTexture(texturePath));
+        }
+        m_Meshes.emplace_back(std::move(data.Vertices), std::move(data.Indices), std::move(textures), m_Storage);
+        m_Meshes.back().Bounds = data.Bounds;
+        m_Meshes.back().Sphere = data.Sphere;
+        m_Meshes.back().Lods = std::move(data.Lods);
+    }
+    computeBounds();
+    std::cout << "Model: " << path << " imported with Assimp (" << m_Meshes.size() << " meshes) in "
+              << MillisecondsSince(start) << " ms (read " << readMs << " ms, convert " << convertMs << " ms)" << std::endl;
+    logMemoryUsage();
 }
 
-void Model::processNode(aiNode* node, const aiScene* scene) {
-    for (unsigned int i = 0; i < node->mNumMeshes; i++) {
-        aiMesh* mesh = scene->mMeshes[node->mMeshes[i]];
-        m_Meshes.push_back(processMesh(mesh, scene));
+bool Model::loadFromCache(const std::string& cachePath, uint64_t sourceHash) {
+    MeshCache cache;
+    if (!cache.Open(cachePath, sourceHash)) {
+        return false;
     }
-    for (unsigned int i = 0; i < node->mNumChildren; i++) {
-        processNode(node->mChildren[i], scene);
+
+    // Mapped blocks go straight to the GPU; the mapping is released when
+    // `cache` goes out of scope.
+    m_Meshes.reserve(cache.GetMeshes().size());
+    for (const CookedMesh& cooked : cache.GetMeshes()) {
+        std::vector<std::shared_ptr<Texture>> textures;
+        for (const auto& texturePath : cooked.DiffuseTextures) {
+            textures.push_back(loadTexture(texturePath));
+        }
+        m_Meshes.emplace_back(cooked.Vertices, cooked.VertexCount, cooked.Indices, cooked.IndexCount, std::move(textures), m_Storage);
+        m_Meshes.back().Bounds = cooked.Bounds;
+        m_Meshes.back().Sphere = cooked.Sphere;
+        if (cooked.LodCount > 0) {
+            m_Meshes.back().Lods.assign(cooked.Lods, cooked.Lods + cooked.LodCount);
+        }
     }
+    return true;
 }
 
-Mesh Model::processMesh(aiMesh* mesh, const aiScene* scene) {
-    std::vector<Vertex> vertices;
-    std::vector<unsigned int> indices;
-    std::vector<std::shared_ptr<Texture>> textures;
+void Model::computeBounds() {
+    m_LodCount = 1;
+    for (const Mesh& mesh : m_Meshes) {
+        m_LodCount = std::max(m_LodCount, static_cast<uint32_t>(mesh.Lods.size()));
+    }
+
+    m_Bounds = AABB();
+    for (const Mesh& mesh : m_Meshes) {
+        m_Bounds.Expand(mesh.Bounds);
+    }
+    if (m_Bounds.IsEmpty()) {
+        m_Sphere = BoundingSphere();
+        return;
+    }
 
-    for (unsigned int i = 0; i < mesh->mNumVertices; i++) {
-        Vertex vertex;
-        vertex.Position = { mesh->mVertices[i].x, mesh->mVertices[i].y, mesh->mVertices[i].z };
-        if (mesh->HasNormals()) { vertex.Normal = { mesh->mNormals[i].x, mesh->mNormals[i].y, mesh->mNormals[i].z }; }
-        if (mesh->mTextureCoords[0]) { vertex.TexCoords = { mesh->mTextureCoords[0][i].x, mesh->mTextureCoords[0][i].y }; }
-        else { vertex.TexCoords = { 0.0f, 0.0f }; }
-        vertices.push_back(vertex);
+    // Sphere centered on the model box, enclosing every mesh sphere
+    glm::vec3 center = m_Bounds.GetCenter();
+    float radius = 0.0f;
+    for (const Mesh& mesh : m_Meshes) {
+        radius = glm::max(radius, glm::length(mesh.Sphere.Center - center) + mesh.Sphere.Radius);
     }
+    m_Sphere = BoundingSphere(center, radius);
+}
 
-    for (unsigned int i = 0; i < mesh->mNumFaces; i++) {
-        aiFace face = mesh->mFaces[i];
-        for (unsigned int j = 0; j < face.mNumIndices; j++) {
-            indices.push_back(face.mIndices[j]);
-        }
+void Model::logOptimization(const std::vector<MeshData>& meshData) const {
+    uint64_t verticesBefore = 0, verticesAfter = 0, transformedBefore = 0, transformedAfter = 0;
+    uint64_t fetchedBefore = 0, fetchedAfter = 0, triangles = 0;
+    uint64_t gpuBytesBefore = 0, gpuBytesAfter = 0;
+    float maxPositionError = 0.0f, maxNormalError = 0.0f, maxTexCoordError = 0.0f;
+    for (const MeshData& data : meshData) {
+        const QuantizationReport& quantization = data.Quantization;
+        gpuBytesBefore += quantization.BytesBefore;
+        gpuBytesAfter += quantization.BytesAfter;
+        maxPositionError = std::max(maxPositionError, quantization.MaxPositionError);
+        maxNormalError = std::max(maxNormalError, quantization.MaxNormalErrorDegrees);
+        maxTexCoordError = std::max(maxTexCoordError, quantization.MaxTexCoordError);
+
+        const MeshOptimizationReport& report = data.Optimization;
+        verticesBefore += report.VerticesBefore;
+        verticesAfter += report.VerticesAfter;
+        transformedBefore += report.CacheBefore.VerticesTransformed;
+        transformedAfter += report.CacheAfter.VerticesTransformed;
+        fetchedBefore += report.FetchBefore.BytesFetched;
+        fetchedAfter += report.FetchAfter.BytesFetched;
+        triangles += data.Lods[0].IndexCount / 3;
+    }
+    if (triangles == 0) {
+        return;
     }
+    std::cout << "Model: optimized " << verticesBefore << " -> " << verticesAfter << " vertices, ACMR "
+              << static_cast<double>(transformedBefore) / triangles << " -> " << static_cast<double>(transformedAfter) / triangles
+              << ", fetched " << fetchedBefore / 1024 << " -> " << fetchedAfter / 1024 << " KiB" << std::endl;
+    std::cout << "Model: quantized GPU geometry " << gpuBytesBefore / 1024 << " -> " << gpuBytesAfter / 1024
+              << " KiB, max error: position " << maxPositionError << ", normal " << maxNormalError
+              << " deg, UV " << maxTexCoordError << std::endl;
+}
 
-    if (mesh->mMaterialIndex >= 0) {
-        aiMaterial* material = scene->mMaterials[mesh->mMaterialIndex];
-        std::vector<std::shared_ptr<Texture>> diffuseMaps = loadMaterialTextures(material, aiTextureType_DIFFUSE, "texture_diffuse");
-        textures.insert(textures.end(), diffuseMaps.begin(), diffuseMaps.end());
+void Model::writeCache(const std::string& cachePath, uint64_t sourceHash, const std::vector<MeshData>& meshData) {
+    std::vector<CookedMesh> cooked(meshData.size());
+    for (size_t i = 0; i < meshData.size(); i++) {
+        const MeshData& data = meshData[i];
+        cooked[i].Vertices = data.Vertices.data();
+        cooked[i].VertexCount = static_cast<uint32_t>(data.Vertices.size());
+        cooked[i].Indices = data.Indices.data();
+        cooked[i].IndexCount = static_cast<uint32_t>(data.Indices.size());
+        cooked[i].Bounds = data.Bounds;
+        cooked[i].Sphere = data.Sphere;
+        cooked[i].Lods = data.Lods.data();
+        cooked[i].LodCount = static_cast<uint32_t>(data.Lods.size());
+        // Already relative to the model directory, as the cache stores them
+        cooked[i].DiffuseTextures = data.DiffuseTextures;
     }
+    MeshCache::Write(cachePath, sourceHash, cooked);
+}
 
-    return Mesh(vertices, indices, textures);
+MemoryUsage Model::GetMemoryUsage() const {
+    MemoryUsage usage;
+    usage.CpuBytes = m_Meshes.capacity() * sizeof(Mesh);
+    for (const Mesh& mesh : m_Meshes) {
+        usage += mesh.GetMemoryUsage();
+    }
+    return usage;
 }
 
-std::vector<std::shared_ptr<Texture>> Model::loadMaterialTextures(aiMaterial* mat, aiTextureType type, std::string typeName) {
-    std::vector<std::shared_ptr<Texture>> textures;
-    for (unsigned int i = 0; i < mat->GetTextureCount(type); i++) {
-        aiString str;
-        mat->GetTexture(type, i, &str);
-        bool skip = false;
-        
-        // Note: La vérification du cache n'est pas implémentée pour rester simple
-        if (!skip) {
-            std::string texturePath = m_Directory + '/' + std::string(str.C_Str());
-            auto texture = std::make_shared<Texture>(texturePath);
-            textures.push_back(texture);
-            m_TexturesLoaded.push_back(texture);
+MemoryUsage Model::GetTextureMemoryUsage() const {
+    MemoryUsage usage;
+    std::unordered_set<const Texture*> counted;
+    for (const Mesh& mesh : m_Meshes) {
+        for (const auto& texture : mesh.textures) {
+            if (counted.insert(texture.get()).second) {
+                usage += texture->GetMemoryUsage();
+            }
         }
     }
-    return textures;
+    return usage;
+}
+
+void Model::logMemoryUsage() const {
+    const MemoryUsage usage = GetMemoryUsage();
+    std::cout << "Model: geometry memory CPU " << usage.CpuBytes / 1024 << " KiB, GPU " << usage.GpuBytes / 1024
+              << " KiB (" << (m_Storage == MeshStorage::KeepCpuCopy ? "CPU copy kept" : "CPU copy released") << ")" << std::endl;
+}
+
+std::shared_ptr<Texture> Model::loadTexture(const std::string& relativePath) {
+    // Shared engine-wide: every mesh/model referencing the same image reuses one GPU texture.
+    // Streamed so that loading a model mid-session does not stall the frame on JPEG decodes.
+    return TextureCache::Load(m_Directory + '/' + relativePath, TextureLoadMode::Streamed);
 }
 
 // --- Implémentation de la classe Mesh ---
 // (Le reste du fichier ne change pas)
 
-Mesh::Mesh(const std::vector<Vertex>& vertices, const std::vector<unsigned int>& indices, std::vector<std::shared_ptr<Texture>> textures) {
-    this->vertices = vertices;
-    this->indices = indices;
-    this->textures = textures;
-    setupMesh();
+Mesh::Mesh(std::vector<Vertex> vertices, std::vector<unsigned int> indices, std::vector<std::shared_ptr<Texture>> textures, MeshStorage storage) {
+    this->textures = std::move(textures);
+    setupMesh(vertices.data(), static_cast<uint32_t>(vertices.size()), indices.data(), static_cast<uint32_t>(indices.size()));
+    if (storage == MeshStorage::KeepCpuCopy) {
+        this->vertices = std::move(vertices);
+        this->indices = std::move(indices);
+    }
+    // Otherwise the arrays die with the parameters: the GPU holds the only copy
+}
+
+Mesh::Mesh(const Vertex* vertexData, uint32_t vertexCount, const uint32_t* indexData, uint32_t indexCount, std::vector<std::shared_ptr<Texture>> textures, MeshStorage storage) {
+    this->textures = std::move(textures);
+    setupMesh(vertexData, vertexCount, indexData, indexCount);
+    if (storage == MeshStorage::KeepCpuCopy) {
+        vertices.assign(vertexData, vertexData + vertexCount);
+        indices.assign(indexData, indexData + indexCount);
+    }
+}
+
+void Mesh::setupMesh(const Vertex* vertexData, uint32_t vertexCount, const uint32_t* indexData, uint32_t indexCount) {
+    // The GPU copy is quantized (16 bytes per vertex instead of 32)
+    Quantization = VertexQuantizer::ComputeQuantization(vertexData, vertexCount);
+    std::vector<PackedVertex> packed(vertexCount);
+    VertexQuantizer::Pack(vertexData, vertexCount, Quantization, packed.data());
+
+    // Indices are relative to the mesh's base vertex, so they fit in 16 bits
+    // whenever the mesh itself has at most 65536 vertices
+    const uint32_t indexSize = vertexCount <= 0x10000 ? sizeof(uint16_t) : sizeof(uint32_t);
+    Geometry = GetArena(indexSize).Allocate(packed.data(), vertexCount, indexData, indexCount);
+    // Single level until the importer (or the cache) provides a LOD chain
+    Lods.assign(1, MeshLod{ 0, indexCount, 0.0f });
+}
+
+GeometryArena& Mesh::GetArena(uint32_t indexSize) {
+    std::unique_ptr<GeometryArena>& arena = s_Arenas[indexSize == sizeof(uint16_t) ? 0 : 1];
+    if (!arena) {
+        BufferLayout layout({
+            { ShaderDataType::UShort4, "a_Position", true },
+            { ShaderDataType::Short2,  "a_Normal" },
+            { ShaderDataType::UShort2, "a_TexCoords", true }
+        });
+        arena = std::make_unique<GeometryArena>(layout, indexSize, ARENA_VERTEX_CAPACITY, ARENA_INDEX_CAPACITY);
+        arena->AttachInstanceBuffer(GetInstanceBuffer());
+    }
+    return *arena;
+}
+
+DynamicBuffer& Mesh::GetInstanceStream() {
+    return *GetInstanceBuffer()->GetStream();
+}
+
+const std::shared_ptr<VertexBuffer>& Mesh::GetInstanceBuffer() {
+    if (!s_InstanceBuffer) {
+        // Region starts are whole instances, so a draw can start at any of them
+        s_InstanceStream = std::make_shared<DynamicBuffer>(static_cast<uint32_t>(INSTANCE_BUFFER_CAPACITY * sizeof(InstanceData)), static_cast<uint32_t>(sizeof(InstanceData)));
+        s_InstanceBuffer = std::make_shared<VertexBuffer>(s_InstanceStream);
+        s_InstanceBuffer->SetLayout(BufferLayout({
+            { ShaderDataType::Mat4, "a_Model" },
+            { ShaderDataType::Mat3, "a_NormalMatrix" }
+        }, 1));
+    }
+    return s_InstanceBuffer;
+}
+
+const std::shared_ptr<VertexBuffer>& Mesh::GetDrawIndexBuffer(uint32_t drawCount) {
+    if (!s_DrawIndexBuffer) {
+        s_DrawIndexBuffer = std::make_shared<VertexBuffer>(static_cast<uint32_t>(DRAW_INDEX_CAPACITY * sizeof(float)));
+        s_DrawIndexBuffer->SetLayout(BufferLayout({
+            { ShaderDataType::Float, "a_DrawIndex" }
+        }, DRAW_INDEX_DIVISOR));
+        drawCount = std::max(drawCount, DRAW_INDEX_CAPACITY);
+    }
+    if (drawCount > s_DrawIndexCount) {
+        // Floats are exact up to 2^24 draws; the GL name stays the same, so
+        // the vertex arrays it is attached to need nothing
+        std::vector<float> indices(std::max(drawCount, s_DrawIndexCount * 2));
+        for (size_t i = 0; i < indices.size(); i++) {
+            indices[i] = static_cast<float>(i);
+        }
+        s_DrawIndexBuffer->SetData(indices.data(), static_cast<uint32_t>(indices.size() * sizeof(float)));
+        s_DrawIndexCount = static_cast<uint32_t>(indices.size());
+    }
+    return s_DrawIndexBuffer;
 }
 
-void Mesh::setupMesh() {
-    VAO = std::make_shared<VertexArray>();
-    auto vb = std::make_shared<VertexBuffer>(vertices.data(), static_cast<uint32_t>(vertices.size() * sizeof(Vertex)));
-    vb->SetLayout({
-        { ShaderDataType::Float3, "a_Position" },
-        { ShaderDataType::Float3, "a_Normal" },
-        { ShaderDataType::Float2, "a_TexCoords" }
-    });
-    VAO->AddVertexBuffer(vb);
-    auto ib = std::make_shared<IndexBuffer>(indices.data(), static_cast<uint32_t>(indices.size()));
-    VAO->SetIndexBuffer(ib);
+MemoryUsage Mesh::GetMemoryUsage() const {
+    MemoryUsage usage;
+    usage.CpuBytes = vertices.capacity() * sizeof(Vertex) + indices.capacity() * sizeof(unsigned int)
+                   + Lods.capacity() * sizeof(MeshLod) + textures.capacity() * sizeof(std::shared_ptr<Texture>);
+    if (Geometry) {
+        const GeometryArena& arena = Geometry->GetArena();
+        const GeometryRange& range = Geometry->GetRange();
+        usage.GpuBytes = static_cast<uint64_t>(range.VertexCount) * arena.GetVertexSize()
+                       + static_cast<uint64_t>(range.IndexCount) * arena.GetIndexSize();
+    }
+    return usage;
 }
 
-void Mesh::Draw(Shader& shader) {
-    for (unsigned int i = 0; i < textures.size(); i++) {
-        textures[i]->Bind(0);
-        shader.SetInt("u_TextureDiffuse", 0);
+MemoryUsage Mesh::GetArenaMemoryUsage() {
+    MemoryUsage usage;
+    for (const auto& arena : s_Arenas) {
+        if (arena) {
+            usage += arena->GetMemoryUsage();
+        }
     }
+    if (s_InstanceBuffer) {
+        usage.GpuBytes += s_InstanceBuffer->GetSize();
+    }
+    if (s_DrawIndexBuffer) {
+        usage.GpuBytes += s_DrawIndexBuffer->GetSize();
+    }
+    return usage;
+}
 
-    VAO->Bind();
-    glDrawElements(GL_TRIANGLES, static_cast<GLsizei>(indices.size()), GL_UNSIGNED_INT, 0);
-    VAO->Unbind();
+void Mesh::ReleaseArenas() {
+    for (auto& arena : s_Arenas) {
+        arena.reset();
+    }
+    s_InstanceBuffer.reset();
+    s_InstanceStream.reset();
+    s_DrawIndexBuffer.reset();
+    s_DrawIndexCount = 0;
 }
\ No newline at end of file
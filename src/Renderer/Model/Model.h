@@ -2,26 +2,48 @@
 #pragma once
 
 #include "Mesh.h"
+#include "../RenderConstants.h"
 #include <string>
 #include <vector>
 #include <assimp/scene.h>
 
+struct MeshData;
+
 class Model {
 public:
-    Model(const std::string& path);
-    void Draw(Shader& shader);
+    // `storage` applies to every mesh: GpuOnly unless the CPU needs the triangles
+    Model(const std::string& path, MeshStorage storage = MeshStorage::GpuOnly);
     const std::vector<Mesh>& GetMeshes() const { return m_Meshes; }
 
+    // Object-space bounds enclosing every mesh
+    const AABB& GetBounds() const { return m_Bounds; }
+    const BoundingSphere& GetBoundingSphere() const { return m_Sphere; }
+    // Levels of the mesh with the longest LOD chain (meshes clamp to their own)
+    uint32_t GetLodCount() const { return m_LodCount; }
+
+    // Geometry of every mesh (see Mesh::GetMemoryUsage)
+    MemoryUsage GetMemoryUsage() const;
+    // Textures used by the meshes, each counted once. They may be shared with other models.
+    MemoryUsage GetTextureMemoryUsage() const;
+
 private:
     // Données du modèle
     std::vector<Mesh> m_Meshes;
     std::string m_Directory;
-    std::vector<std::shared_ptr<Texture>> m_TexturesLoaded; // Cache pour les textures
+    MeshStorage m_Storage;
+    AABB m_Bounds;
+    BoundingSphere m_Sphere;
+    uint32_t m_LodCount = 1;
 
     void loadModel(const std::string& path);
-    void processNode(aiNode *node, const aiScene *scene);
-    Mesh processMesh(aiMesh *mesh, const aiScene *scene);
-    
-    // La déclaration qui manquait
-    std::vector<std::shared_ptr<Texture>> loadMaterialTextures(aiMaterial *mat, aiTextureType type, std::string typeName);
+    bool loadFromCache(const std::string& cachePath, uint64_t sourceHash);
+    void writeCache(const std::string& cachePath, uint64_t sourceHash, const std::vector<MeshData>& meshData);
+    // Prints the vertex cache/fetch gains of the import-time optimization and
+    // the memory saved (and precision lost) by the quantized GPU format
+    void logOptimization(const std::vector<MeshData>& meshData) const;
+    // Prints GetMemoryUsage, so budgets can be checked from the logs
+    void logMemoryUsage() const;
+    std::shared_ptr<Texture> loadTexture(const std::string& relativePath);
+    // Model bounds and LOD count, from the meshes
+    void computeBounds();
 };
\ No newline at end of file
@@ -0,0 +1,120 @@
+// src/Renderer/Model/ModelImporter.cpp
+#include "ModelImporter.h"
+#include "MeshSimplifier.h"
+#include "../../Core/JobSystem.h"
+#include "../../Core/Profiler.h"
+#include <cmath>
+
+void ModelImporter::CollectMeshes(const aiNode* node, const aiScene* scene, std::vector<const aiMesh*>& outMeshes) {
+    for (unsigned int i = 0; i < node->mNumMeshes; i++) {
+        outMeshes.push_back(scene->mMeshes[node->mMeshes[i]]);
+    }
+    for (unsigned int i = 0; i < node->mNumChildren; i++) {
+        CollectMeshes(node->mChildren[i], scene, outMeshes);
+    }
+}
+
+void ModelImporter::ConvertMesh(const aiMesh* mesh, const aiScene* scene, MeshData& outData) {
+    PLUME_PROFILE_FUNCTION();
+    const aiVector3D* positions = mesh->mVertices;
+    const aiVector3D* normals = mesh->HasNormals() ? mesh->mNormals : nullptr;
+    const aiVector3D* texCoords = mesh->mTextureCoords[0];
+
+    outData.Vertices.resize(mesh->mNumVertices);
+    Vertex* vertices = outData.Vertices.data();
+    for (unsigned int i = 0; i < mesh->mNumVertices; i++) {
+        Vertex& vertex = vertices[i];
+        vertex.Position = { positions[i].x, positions[i].y, positions[i].z };
+        vertex.Normal = normals ? glm::vec3(normals[i].x, normals[i].y, normals[i].z) : glm::vec3(0.0f);
+        vertex.TexCoords = texCoords ? glm::vec2(texCoords[i].x, texCoords[i].y) : glm::vec2(0.0f);
+    }
+
+    // Count first so the index array is allocated exactly once
+    size_t indexCount = 0;
+    for (unsigned int i = 0; i < mesh->mNumFaces; i++) {
+        indexCount += mesh->mFaces[i].mNumIndices;
+    }
+    outData.Indices.resize(indexCount);
+    uint32_t* indices = outData.Indices.data();
+    for (unsigned int i = 0; i < mesh->mNumFaces; i++) {
+        const aiFace& face = mesh->mFaces[i];
+        for (unsigned int j = 0; j < face.mNumIndices; j++) {
+            *indices++ = face.mIndices[j];
+        }
+    }
+
+    // Assimp emits one vertex per face corner; weld and reorder for the GPU caches
+    outData.Optimization = MeshOptimizer::Optimize(outData.Vertices, outData.Indices);
+    ComputeBounds(outData.Vertices.data(), static_cast<uint32_t>(outData.Vertices.size()), outData.Bounds, outData.Sphere);
+    GenerateLods(outData);
+    outData.Quantization = VertexQuantizer::Analyze(outData.Vertices.data(), static_cast<uint32_t>(outData.Vertices.size()), static_cast<uint32_t>(outData.Indices.size()));
+
+    outData.DiffuseTextures.clear();
+    if (mesh->mMaterialIndex < scene->mNumMaterials) {
+        const aiMaterial* material = scene->mMaterials[mesh->mMaterialIndex];
+        unsigned int textureCount = material->GetTextureCount(aiTextureType_DIFFUSE);
+        outData.DiffuseTextures.reserve(textureCount);
+        for (unsigned int i = 0; i < textureCount; i++) {
+            aiString path;
+            material->GetTexture(aiTextureType_DIFFUSE, i, &path);
+            outData.DiffuseTextures.emplace_back(path.C_Str());
+        }
+    }
+}
+
+void ModelImporter::GenerateLods(MeshData& data) {
+    const uint32_t vertexCount = static_cast<uint32_t>(data.Vertices.size());
+    data.Lods.assign(1, MeshLod{ 0, static_cast<uint32_t>(data.Indices.size()), 0.0f });
+
+    // Each level simplifies the previous one, which is cheaper. The errors
+    // the simplifier reports do not add up to a bound, so each level's
+    // deviation from level 0 is measured instead.
+    std::vector<uint32_t> previous = data.Indices;
+    const size_t baseIndexCount = data.Indices.size();
+    for (uint32_t level = 1; level < LOD_LEVEL_COUNT; level++) {
+        size_t target = static_cast<size_t>(previous.size() / 3 * LOD_REDUCTION) * 3;
+        std::vector<uint32_t> simplified = MeshSimplifier::Simplify(data.Vertices.data(), vertexCount, previous.data(), previous.size(), target, LOD_MAX_ERROR);
+        if (simplified.empty() || simplified.size() > previous.size() * LOD_MIN_REDUCTION) {
+            break;
+        }
+        MeshOptimizer::OptimizeVertexCache(simplified.data(), simplified.size(), vertexCount);
+
+        const float error = MeshSimplifier::MeasureDeviation(data.Vertices.data(), vertexCount, data.Indices.data(), baseIndexCount, simplified.data(), simplified.size());
+        data.Lods.push_back(MeshLod{ static_cast<uint32_t>(data.Indices.size()), static_cast<uint32_t>(simplified.size()), error });
+        data.Indices.insert(data.Indices.end(), simplified.begin(), simplified.end());
+        previous.swap(simplified);
+    }
+}
+
+void ModelImporter::ComputeBounds(const Vertex* vertices, uint32_t vertexCount, AABB& outBounds, BoundingSphere& outSphere) {
+    AABB bounds;
+    for (uint32_t i = 0; i < vertexCount; i++) {
+        bounds.Expand(vertices[i].Position);
+    }
+    outBounds = bounds;
+    if (bounds.IsEmpty()) {
+        outSphere = BoundingSphere();
+        return;
+    }
+
+    glm::vec3 center = bounds.GetCenter();
+    float radiusSquared = 0.0f;
+    for (uint32_t i = 0; i < vertexCount; i++) {
+        glm::vec3 offset = vertices[i].Position - center;
+        radiusSquared = glm::max(radiusSquared, glm::dot(offset, offset));
+    }
+    outSphere = BoundingSphere(center, std::sqrt(radiusSquared));
+}
+
+std::vector<MeshData> ModelImporter::ConvertMeshes(const std::vector<const aiMesh*>& meshes, const aiScene* scene) {
+    std::vector<MeshData> results(meshes.size());
+
+    // One job per mesh: sub-mesh sizes vary a lot, and work stealing balances
+    // the big ones better than fixed slices would.
+    JobSystem::ParallelFor(static_cast<uint32_t>(meshes.size()), 1, [&](uint32_t begin, uint32_t end) {
+        for (uint32_t i = begin; i < end; i++) {
+            ConvertMesh(meshes[i], scene, results[i]);
+        }
+    });
+    return results;
+}
@@ -0,0 +1,53 @@
+// src/Renderer/Model/ModelImporter.h
+#pragma once
+
+#include "Mesh.h"
+#include "MeshOptimizer.h"
+#include "VertexQuantizer.h"
+#include "../Bounds.h"
+#include <assimp/scene.h>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// CPU-side result of converting one aiMesh. No GL object is involved, so it can
+// be produced on any thread; only the upload in Mesh::setupMesh needs the context.
+struct MeshData {
+    std::vector<Vertex>      Vertices;
+    std::vector<uint32_t>    Indices;         // Every LOD, one after the other
+    std::vector<MeshLod>     Lods;
+    std::vector<std::string> DiffuseTextures; // Paths relative to the model directory
+    AABB                     Bounds;
+    BoundingSphere           Sphere;
+    MeshOptimizationReport   Optimization;
+    QuantizationReport       Quantization;
+};
+
+class ModelImporter {
+public:
+    // LOD chain: each level targets LOD_REDUCTION of the triangles of the
+    // previous one, without moving the surface by more than LOD_MAX_ERROR
+    // (relative to the mesh extent) per step. A level that cannot get below
+    // LOD_MIN_REDUCTION of the previous one ends the chain.
+    static constexpr uint32_t LOD_LEVEL_COUNT = 4;
+    static constexpr float LOD_REDUCTION = 0.5f;
+    static constexpr float LOD_MAX_ERROR = 0.02f;
+    static constexpr float LOD_MIN_REDUCTION = 0.9f;
+
+    // Gathers the meshes referenced by the node hierarchy, in depth-first order
+    static void CollectMeshes(const aiNode* node, const aiScene* scene, std::vector<const aiMesh*>& outMeshes);
+
+    // Converts one aiMesh into the engine `Vertex` layout. Arrays are sized up
+    // front and filled in place, then run through MeshOptimizer.
+    static void ConvertMesh(const aiMesh* mesh, const aiScene* scene, MeshData& outData);
+
+    // Appends the coarser levels to `data.Indices` (see LOD_* above)
+    static void GenerateLods(MeshData& data);
+
+    // Box and sphere enclosing the vertex positions. The sphere is centered on
+    // the box and tight around the actual vertices.
+    static void ComputeBounds(const Vertex* vertices, uint32_t vertexCount, AABB& outBounds, BoundingSphere& outSphere);
+
+    // Converts every mesh in parallel on the JobSystem workers
+    static std::vector<MeshData> ConvertMeshes(const std::vector<const aiMesh*>& meshes, const aiScene* scene);
+};
@@ -0,0 +1,131 @@
+// src/Renderer/Model/VertexQuantizer.cpp
+#include "VertexQuantizer.h"
+#include "../Bounds.h"
+#include <algorithm>
+#include <cmath>
+
+static constexpr float UNORM16_MAX = 65535.0f;
+static constexpr float SNORM16_MAX = 32767.0f;
+
+static uint16_t QuantizeUnorm16(float value, float offset, float inverseScale) {
+    float normalized = std::min(std::max((value - offset) * inverseScale, 0.0f), 1.0f);
+    return static_cast<uint16_t>(std::lround(normalized * UNORM16_MAX));
+}
+
+static int16_t QuantizeSnorm16(float value) {
+    float clamped = std::min(std::max(value, -1.0f), 1.0f);
+    return static_cast<int16_t>(std::lround(clamped * SNORM16_MAX));
+}
+
+// Same rule as the shader: -32768 and -32767 both map to -1
+static float DequantizeSnorm16(int16_t value) {
+    return std::max(static_cast<float>(value) / SNORM16_MAX, -1.0f);
+}
+
+static float InverseOrZero(float scale) {
+    return scale > 0.0f ? 1.0f / scale : 0.0f;
+}
+
+VertexQuantization VertexQuantizer::ComputeQuantization(const Vertex* vertices, uint32_t vertexCount) {
+    VertexQuantization quantization;
+    if (vertexCount == 0) {
+        return quantization;
+    }
+
+    AABB bounds;
+    glm::vec2 texCoordMin(vertices[0].TexCoords);
+    glm::vec2 texCoordMax(vertices[0].TexCoords);
+    for (uint32_t i = 0; i < vertexCount; i++) {
+        bounds.Expand(vertices[i].Position);
+        texCoordMin = glm::min(texCoordMin, vertices[i].TexCoords);
+        texCoordMax = glm::max(texCoordMax, vertices[i].TexCoords);
+    }
+    quantization.PositionOffset = glm::vec4(bounds.Min, 0.0f);
+    quantization.PositionScale = glm::vec4(bounds.Max - bounds.Min, 0.0f);
+    quantization.TexCoordTransform = glm::vec4(texCoordMin.x, texCoordMin.y, texCoordMax.x - texCoordMin.x, texCoordMax.y - texCoordMin.y);
+    return quantization;
+}
+
+glm::vec2 VertexQuantizer::EncodeOctahedral(const glm::vec3& normal) {
+    float sum = std::abs(normal.x) + std::abs(normal.y) + std::abs(normal.z);
+    if (sum <= 0.0f) {
+        return glm::vec2(0.0f); // Missing normal: decodes to +Z
+    }
+    // Project on the octahedron, then fold the lower half over the diagonals
+    glm::vec2 encoded(normal.x / sum, normal.y / sum);
+    if (normal.z < 0.0f) {
+        encoded = glm::vec2((1.0f - std::abs(encoded.y)) * (encoded.x >= 0.0f ? 1.0f : -1.0f),
+                            (1.0f - std::abs(encoded.x)) * (encoded.y >= 0.0f ? 1.0f : -1.0f));
+    }
+    return encoded;
+}
+
+glm::vec3 VertexQuantizer::DecodeOctahedral(const glm::vec2& encoded) {
+    glm::vec3 normal(encoded.x, encoded.y, 1.0f - std::abs(encoded.x) - std::abs(encoded.y));
+    float fold = std::max(-normal.z, 0.0f);
+    normal.x += normal.x >= 0.0f ? -fold : fold;
+    normal.y += normal.y >= 0.0f ? -fold : fold;
+    return glm::normalize(normal);
+}
+
+void VertexQuantizer::Pack(const Vertex* vertices, uint32_t vertexCount, const VertexQuantization& quantization, PackedVertex* outVertices) {
+    const glm::vec3 positionOffset(quantization.PositionOffset);
+    const glm::vec3 inversePositionScale(InverseOrZero(quantization.PositionScale.x),
+                                         InverseOrZero(quantization.PositionScale.y),
+                                         InverseOrZero(quantization.PositionScale.z));
+    const glm::vec2 texCoordOffset(quantization.TexCoordTransform.x, quantization.TexCoordTransform.y);
+    const glm::vec2 inverseTexCoordScale(InverseOrZero(quantization.TexCoordTransform.z),
+                                         InverseOrZero(quantization.TexCoordTransform.w));
+
+    for (uint32_t i = 0; i < vertexCount; i++) {
+        const Vertex& vertex = vertices[i];
+        PackedVertex& packed = outVertices[i];
+        for (int axis = 0; axis < 3; axis++) {
+            packed.Position[axis] = QuantizeUnorm16(vertex.Position[axis], positionOffset[axis], inversePositionScale[axis]);
+        }
+        packed.Position[3] = 0;
+
+        glm::vec2 normal = EncodeOctahedral(vertex.Normal);
+        packed.Normal[0] = QuantizeSnorm16(normal.x);
+        packed.Normal[1] = QuantizeSnorm16(normal.y);
+
+        packed.TexCoords[0] = QuantizeUnorm16(vertex.TexCoords.x, texCoordOffset.x, inverseTexCoordScale.x);
+        packed.TexCoords[1] = QuantizeUnorm16(vertex.TexCoords.y, texCoordOffset.y, inverseTexCoordScale.y);
+    }
+}
+
+Vertex VertexQuantizer::Unpack(const PackedVertex& packed, const VertexQuantization& quantization) {
+    Vertex vertex;
+    for (int axis = 0; axis < 3; axis++) {
+        vertex.Position[axis] = quantization.PositionOffset[axis] + quantization.PositionScale[axis] * (packed.Position[axis] / UNORM16_MAX);
+    }
+    vertex.Normal = DecodeOctahedral(glm::vec2(DequantizeSnorm16(packed.Normal[0]), DequantizeSnorm16(packed.Normal[1])));
+    vertex.TexCoords.x = quantization.TexCoordTransform.x + quantization.TexCoordTransform.z * (packed.TexCoords[0] / UNORM16_MAX);
+    vertex.TexCoords.y = quantization.TexCoordTransform.y + quantization.TexCoordTransform.w * (packed.TexCoords[1] / UNORM16_MAX);
+    return vertex;
+}
+
+QuantizationReport VertexQuantizer::Analyze(const Vertex* vertices, uint32_t vertexCount, uint32_t indexCount) {
+    QuantizationReport report;
+    const uint32_t indexSize = vertexCount <= 0x10000 ? sizeof(uint16_t) : sizeof(uint32_t);
+    report.BytesBefore = vertexCount * static_cast<uint32_t>(sizeof(Vertex)) + indexCount * static_cast<uint32_t>(sizeof(uint32_t));
+    report.BytesAfter = vertexCount * static_cast<uint32_t>(sizeof(PackedVertex)) + indexCount * indexSize;
+
+    const VertexQuantization quantization = ComputeQuantization(vertices, vertexCount);
+    float maxNormalCos = 1.0f;
+    for (uint32_t i = 0; i < vertexCount; i++) {
+        const Vertex& original = vertices[i];
+        PackedVertex packed;
+        Pack(&original, 1, quantization, &packed);
+        Vertex unpacked = Unpack(packed, quantization);
+
+        report.MaxPositionError = std::max(report.MaxPositionError, glm::length(unpacked.Position - original.Position));
+        report.MaxTexCoordError = std::max(report.MaxTexCoordError, glm::length(unpacked.TexCoords - original.TexCoords));
+        float length = glm::length(original.Normal);
+        if (length > 0.0f) {
+            maxNormalCos = std::min(maxNormalCos, glm::dot(unpacked.Normal, original.Normal / length));
+        }
+    }
+    report.MaxNormalErrorDegrees = glm::degrees(std::acos(std::min(std::max(maxNormalCos, -1.0f), 1.0f)));
+    return report;
+}
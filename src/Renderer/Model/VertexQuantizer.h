@@ -0,0 +1,43 @@
+// src/Renderer/Model/VertexQuantizer.h
+#pragma once
+
+#include "Mesh.h"
+#include <cstdint>
+
+// GPU vertex format: 16 bytes instead of the 32 of `Vertex`.
+//   Position  : 3 x unorm16 relative to the mesh box (+1 padding)
+//   Normal    : octahedral encoding, 2 x int16 (decoded as snorm in the shader)
+//   TexCoords : 2 x unorm16 relative to the mesh UV range
+struct PackedVertex {
+    uint16_t Position[4];
+    int16_t  Normal[2];
+    uint16_t TexCoords[2];
+};
+static_assert(sizeof(PackedVertex) == 16, "PackedVertex must stay tightly packed");
+
+// Accuracy and memory gain of packing one mesh
+struct QuantizationReport {
+    uint32_t BytesBefore = 0;
+    uint32_t BytesAfter = 0;
+    float MaxPositionError = 0.0f;   // Object-space units
+    float MaxNormalErrorDegrees = 0.0f;
+    float MaxTexCoordError = 0.0f;
+};
+
+// Converts `Vertex` arrays to PackedVertex at upload. The float vertices stay
+// the CPU and cache format; only the GPU copy is quantized.
+class VertexQuantizer {
+public:
+    // Ranges of the mesh, used both to pack and (in the shader) to unpack
+    static VertexQuantization ComputeQuantization(const Vertex* vertices, uint32_t vertexCount);
+
+    static void Pack(const Vertex* vertices, uint32_t vertexCount, const VertexQuantization& quantization, PackedVertex* outVertices);
+    static Vertex Unpack(const PackedVertex& vertex, const VertexQuantization& quantization);
+
+    // Packs and unpacks every vertex and measures the worst error. The byte
+    // counts include the index buffer (16-bit when vertexCount allows it).
+    static QuantizationReport Analyze(const Vertex* vertices, uint32_t vertexCount, uint32_t indexCount);
+
+    static glm::vec2 EncodeOctahedral(const glm::vec3& normal);
+    static glm::vec3 DecodeOctahedral(const glm::vec2& encoded);
+};
@@ -0,0 +1,298 @@
+// src/Renderer/OffsetAllocator.cpp
+#include "OffsetAllocator.h"
+#include <algorithm>
+#include <cassert>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+static constexpr uint32_t MANTISSA_VALUE = 1u << OffsetAllocator::MANTISSA_BITS;
+static constexpr uint32_t MANTISSA_MASK = MANTISSA_VALUE - 1;
+
+// Index of the highest set bit (value != 0)
+static uint32_t HighestBit(uint32_t value) {
+#if defined(_MSC_VER)
+    unsigned long index;
+    _BitScanReverse(&index, value);
+    return static_cast<uint32_t>(index);
+#else
+    return 31u - static_cast<uint32_t>(__builtin_clz(value));
+#endif
+}
+
+// Index of the lowest set bit (value != 0)
+static uint32_t LowestBit(uint32_t value) {
+#if defined(_MSC_VER)
+    unsigned long index;
+    _BitScanForward(&index, value);
+    return static_cast<uint32_t>(index);
+#else
+    return static_cast<uint32_t>(__builtin_ctz(value));
+#endif
+}
+
+// Sizes below MANTISSA_VALUE have a bin each; above, the bin is the exponent
+// (position of the top bit) followed by the MANTISSA_BITS bits under it
+uint32_t OffsetAllocator::SizeToBinRoundDown(uint32_t size) {
+    if (size < MANTISSA_VALUE) {
+        return size;
+    }
+    const uint32_t shift = HighestBit(size) - MANTISSA_BITS;
+    return ((shift + 1) << MANTISSA_BITS) | ((size >> shift) & MANTISSA_MASK);
+}
+
+uint32_t OffsetAllocator::SizeToBinRoundUp(uint32_t size) {
+    if (size < MANTISSA_VALUE) {
+        return size;
+    }
+    const uint32_t shift = HighestBit(size) - MANTISSA_BITS;
+    const uint32_t bin = ((shift + 1) << MANTISSA_BITS) | ((size >> shift) & MANTISSA_MASK);
+    // Bits dropped by the rounding: the bin's smallest block would be too short
+    return (size & ((1u << shift) - 1)) != 0 ? bin + 1 : bin;
+}
+
+OffsetAllocator::OffsetAllocator(uint32_t size) {
+    std::fill(std::begin(m_BinHeads), std::end(m_BinHeads), NONE);
+    Grow(size);
+}
+
+uint32_t OffsetAllocator::CreateNode(uint32_t offset, uint32_t size) {
+    uint32_t index;
+    if (!m_ReleasedNodes.empty()) {
+        index = m_ReleasedNodes.back();
+        m_ReleasedNodes.pop_back();
+        m_Nodes[index] = Node();
+    } else {
+        index = static_cast<uint32_t>(m_Nodes.size());
+        m_Nodes.emplace_back();
+    }
+    m_Nodes[index].Offset = offset;
+    m_Nodes[index].Size = size;
+    return index;
+}
+
+void OffsetAllocator::ReleaseNode(uint32_t node) {
+    m_Nodes[node].Size = 0;
+    m_ReleasedNodes.push_back(node);
+}
+
+void OffsetAllocator::InsertFreeNode(uint32_t node) {
+    const uint32_t bin = SizeToBinRoundDown(m_Nodes[node].Size);
+    const uint32_t head = m_BinHeads[bin];
+    m_Nodes[node].Used = false;
+    m_Nodes[node].BinPrevious = NONE;
+    m_Nodes[node].BinNext = head;
+    if (head != NONE) {
+        m_Nodes[head].BinPrevious = node;
+    }
+    m_BinHeads[bin] = node;
+    m_UsedBins[bin >> 5] |= 1u << (bin & 31);
+    m_UsedBinsTop |= 1u << (bin >> 5);
+    m_FreeRegions++;
+}
+
+void OffsetAllocator::RemoveFreeNode(uint32_t node) {
+    Node& removed = m_Nodes[node];
+    if (removed.BinPrevious != NONE) {
+        m_Nodes[removed.BinPrevious].BinNext = removed.BinNext;
+    } else {
+        const uint32_t bin = SizeToBinRoundDown(removed.Size);
+        m_BinHeads[bin] = removed.BinNext;
+        if (removed.BinNext == NONE) {
+            m_UsedBins[bin >> 5] &= ~(1u << (bin & 31));
+            if (m_UsedBins[bin >> 5] == 0) {
+                m_UsedBinsTop &= ~(1u << (bin >> 5));
+            }
+        }
+    }
+    if (removed.BinNext != NONE) {
+        m_Nodes[removed.BinNext].BinPrevious = removed.BinPrevious;
+    }
+    removed.BinPrevious = NONE;
+    removed.BinNext = NONE;
+    m_FreeRegions--;
+}
+
+uint32_t OffsetAllocator::FindFreeBin(uint32_t minimumBin) const {
+    if (minimumBin >= BIN_COUNT) {
+        return NONE;
+    }
+    // Same group of 32 bins first, then the first non-empty group above it
+    const uint32_t top = minimumBin >> 5;
+    const uint32_t leafMask = m_UsedBins[top] & (~0u << (minimumBin & 31));
+    if (leafMask != 0) {
+        return (top << 5) | LowestBit(leafMask);
+    }
+    const uint32_t topMask = top + 1 < BIN_COUNT / 32 ? m_UsedBinsTop & (~0u << (top + 1)) : 0;
+    if (topMask == 0) {
+        return NONE;
+    }
+    const uint32_t group = LowestBit(topMask);
+    return (group << 5) | LowestBit(m_UsedBins[group]);
+}
+
+OffsetAllocation OffsetAllocator::Allocate(uint32_t size) {
+    OffsetAllocation allocation;
+    if (size == 0) {
+        return allocation;
+    }
+    const uint32_t bin = FindFreeBin(SizeToBinRoundUp(size));
+    if (bin == NONE) {
+        return allocation;
+    }
+
+    const uint32_t node = m_BinHeads[bin];
+    RemoveFreeNode(node);
+    const uint32_t remainder = m_Nodes[node].Size - size;
+    m_Nodes[node].Size = size;
+    m_Nodes[node].Used = true;
+
+    // The tail goes back to the bins as a block of its own
+    if (remainder > 0) {
+        const uint32_t tail = CreateNode(m_Nodes[node].Offset + size, remainder);
+        const uint32_t next = m_Nodes[node].NeighborNext;
+        m_Nodes[tail].NeighborPrevious = node;
+        m_Nodes[tail].NeighborNext = next;
+        if (next != NONE) {
+            m_Nodes[next].NeighborPrevious = tail;
+        } else {
+            m_LastNode = tail;
+        }
+        m_Nodes[node].NeighborNext = tail;
+        InsertFreeNode(tail);
+    }
+
+    m_FreeSpace -= size;
+    m_Allocations++;
+    allocation.Offset = m_Nodes[node].Offset;
+    allocation.Node = node;
+    return allocation;
+}
+
+void OffsetAllocator::Free(const OffsetAllocation& allocation) {
+    if (!allocation.IsValid()) {
+        return;
+    }
+    const uint32_t node = allocation.Node;
+    assert(m_Nodes[node].Used && "OffsetAllocator: block freed twice");
+    m_FreeSpace += m_Nodes[node].Size;
+    m_Allocations--;
+
+    const uint32_t previous = m_Nodes[node].NeighborPrevious;
+    if (previous != NONE && !m_Nodes[previous].Used) {
+        RemoveFreeNode(previous);
+        m_Nodes[node].Offset = m_Nodes[previous].Offset;
+        m_Nodes[node].Size += m_Nodes[previous].Size;
+        m_Nodes[node].NeighborPrevious = m_Nodes[previous].NeighborPrevious;
+        if (m_Nodes[node].NeighborPrevious != NONE) {
+            m_Nodes[m_Nodes[node].NeighborPrevious].NeighborNext = node;
+        }
+        ReleaseNode(previous);
+    }
+
+    const uint32_t next = m_Nodes[node].NeighborNext;
+    if (next != NONE && !m_Nodes[next].Used) {
+        RemoveFreeNode(next);
+        m_Nodes[node].Size += m_Nodes[next].Size;
+        m_Nodes[node].NeighborNext = m_Nodes[next].NeighborNext;
+        if (m_Nodes[node].NeighborNext != NONE) {
+            m_Nodes[m_Nodes[node].NeighborNext].NeighborPrevious = node;
+        } else {
+            m_LastNode = node;
+        }
+        ReleaseNode(next);
+    }
+
+    InsertFreeNode(node);
+}
+
+void OffsetAllocator::Grow(uint32_t newSize) {
+    if (newSize <= m_Size) {
+        return;
+    }
+    const uint32_t extra = newSize - m_Size;
+    if (m_LastNode != NONE && !m_Nodes[m_LastNode].Used) {
+        RemoveFreeNode(m_LastNode);
+        m_Nodes[m_LastNode].Size += extra;
+        InsertFreeNode(m_LastNode);
+    } else {
+        const uint32_t node = CreateNode(m_Size, extra);
+        m_Nodes[node].NeighborPrevious = m_LastNode;
+        if (m_LastNode != NONE) {
+            m_Nodes[m_LastNode].NeighborNext = node;
+        }
+        m_LastNode = node;
+        InsertFreeNode(node);
+    }
+    m_FreeSpace += extra;
+    m_Size = newSize;
+}
+
+std::vector<OffsetRelocation> OffsetAllocator::Defragment() {
+    std::vector<OffsetRelocation> relocations;
+    std::vector<uint32_t> usedNodes;
+    usedNodes.reserve(m_Allocations);
+    for (uint32_t i = 0; i < m_Nodes.size(); i++) {
+        if (m_Nodes[i].Size > 0 && m_Nodes[i].Used) {
+            usedNodes.push_back(i);
+        } else if (m_Nodes[i].Size > 0) {
+            ReleaseNode(i);
+        }
+    }
+    std::sort(usedNodes.begin(), usedNodes.end(), [this](uint32_t a, uint32_t b) {
+        return m_Nodes[a].Offset < m_Nodes[b].Offset;
+    });
+
+    // Every free block is gone: rebuild the bins around a single one
+    std::fill(std::begin(m_BinHeads), std::end(m_BinHeads), NONE);
+    std::fill(std::begin(m_UsedBins), std::end(m_UsedBins), 0u);
+    m_UsedBinsTop = 0;
+    m_FreeRegions = 0;
+
+    uint32_t offset = 0;
+    uint32_t previous = NONE;
+    for (uint32_t node : usedNodes) {
+        Node& block = m_Nodes[node];
+        if (block.Offset != offset) {
+            relocations.push_back({ node, block.Offset, offset, block.Size });
+            block.Offset = offset;
+        }
+        block.NeighborPrevious = previous;
+        block.NeighborNext = NONE;
+        if (previous != NONE) {
+            m_Nodes[previous].NeighborNext = node;
+        }
+        previous = node;
+        offset += block.Size;
+    }
+    m_LastNode = previous;
+
+    if (offset < m_Size) {
+        const uint32_t tail = CreateNode(offset, m_Size - offset);
+        m_Nodes[tail].NeighborPrevious = previous;
+        if (previous != NONE) {
+            m_Nodes[previous].NeighborNext = tail;
+        }
+        m_LastNode = tail;
+        InsertFreeNode(tail);
+    }
+    return relocations;
+}
+
+OffsetAllocatorStats OffsetAllocator::GetStats() const {
+    OffsetAllocatorStats stats;
+    stats.Size = m_Size;
+    stats.FreeSpace = m_FreeSpace;
+    stats.FreeRegions = m_FreeRegions;
+    stats.Allocations = m_Allocations;
+    // The largest block is in the highest non-empty bin
+    if (m_UsedBinsTop != 0) {
+        const uint32_t group = HighestBit(m_UsedBinsTop);
+        const uint32_t bin = (group << 5) | HighestBit(m_UsedBins[group]);
+        for (uint32_t node = m_BinHeads[bin]; node != NONE; node = m_Nodes[node].BinNext) {
+            stats.LargestFreeRegion = std::max(stats.LargestFreeRegion, m_Nodes[node].Size);
+        }
+    }
+    return stats;
+}
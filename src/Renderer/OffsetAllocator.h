@@ -0,0 +1,110 @@
+// src/Renderer/OffsetAllocator.h
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+// A block handed out by OffsetAllocator. Offset and sizes are in the units
+// the owner chose (vertices, indices...); Node identifies the block.
+struct OffsetAllocation {
+    static constexpr uint32_t NO_SPACE = 0xFFFFFFFF;
+
+    uint32_t Offset = NO_SPACE;
+    uint32_t Node = NO_SPACE;
+
+    bool IsValid() const { return Offset != NO_SPACE; }
+};
+
+struct OffsetAllocatorStats {
+    uint32_t Size = 0;
+    uint32_t FreeSpace = 0;
+    uint32_t LargestFreeRegion = 0;
+    uint32_t FreeRegions = 0;
+    uint32_t Allocations = 0;
+
+    // 0 when the free space is a single block, close to 1 when it is scattered
+    // in pieces too small for a large request
+    float GetFragmentation() const {
+        return FreeSpace > 0 ? 1.0f - static_cast<float>(LargestFreeRegion) / static_cast<float>(FreeSpace) : 0.0f;
+    }
+};
+
+// One block moved by OffsetAllocator::Defragment
+struct OffsetRelocation {
+    uint32_t Node;
+    uint32_t OldOffset;
+    uint32_t NewOffset;
+    uint32_t Size;
+};
+
+// Two-level segregated fit (TLSF) allocator of offsets in [0, size). It manages
+// no memory itself: the owner applies the offsets to a GPU buffer.
+//
+// Free blocks are binned by size on a small float scale (3 mantissa bits: bins
+// are at most 12.5% apart) and two bitmasks tell which bins are non-empty, so
+// Allocate and Free are O(1). Allocate rounds the request up to the next bin,
+// so any block found there fits without walking the list. Freed blocks merge
+// with their free neighbours immediately.
+class OffsetAllocator {
+public:
+    static constexpr uint32_t MANTISSA_BITS = 3;
+    static constexpr uint32_t BIN_COUNT = 256;
+
+    explicit OffsetAllocator(uint32_t size);
+
+    // Returns an invalid allocation when no free block is large enough
+    OffsetAllocation Allocate(uint32_t size);
+    void Free(const OffsetAllocation& allocation);
+
+    // Current offset of a block, which Defragment may have moved
+    uint32_t GetOffset(const OffsetAllocation& allocation) const { return m_Nodes[allocation.Node].Offset; }
+    uint32_t GetAllocationSize(const OffsetAllocation& allocation) const { return m_Nodes[allocation.Node].Size; }
+
+    // Extends the range to [0, newSize). Allocations keep their offsets.
+    void Grow(uint32_t newSize);
+    // Packs every allocation at the start of the range, in address order, and
+    // leaves a single free block at the end. Node handles stay valid (use
+    // GetOffset to refresh). The moves come in ascending address order.
+    std::vector<OffsetRelocation> Defragment();
+
+    uint32_t GetSize() const { return m_Size; }
+    // Heap bytes of the node storage
+    uint64_t GetMetadataBytes() const { return m_Nodes.capacity() * sizeof(Node) + m_ReleasedNodes.capacity() * sizeof(uint32_t); }
+    OffsetAllocatorStats GetStats() const;
+
+    // Bin of a block of `size` units, and the smallest bin whose blocks all hold `size`
+    static uint32_t SizeToBinRoundDown(uint32_t size);
+    static uint32_t SizeToBinRoundUp(uint32_t size);
+
+private:
+    static constexpr uint32_t NONE = 0xFFFFFFFF;
+
+    // Released nodes (Size == 0) wait in m_ReleasedNodes for reuse
+    struct Node {
+        uint32_t Offset = 0;
+        uint32_t Size = 0;
+        uint32_t BinPrevious = NONE; // Free list of the bin (free blocks only)
+        uint32_t BinNext = NONE;
+        uint32_t NeighborPrevious = NONE; // Adjacent blocks, in address order
+        uint32_t NeighborNext = NONE;
+        bool Used = false;
+    };
+
+    uint32_t CreateNode(uint32_t offset, uint32_t size);
+    void ReleaseNode(uint32_t node);
+    void InsertFreeNode(uint32_t node);
+    void RemoveFreeNode(uint32_t node);
+    uint32_t FindFreeBin(uint32_t minimumBin) const;
+
+    uint32_t m_Size = 0;
+    uint32_t m_FreeSpace = 0;
+    uint32_t m_FreeRegions = 0;
+    uint32_t m_Allocations = 0;
+    uint32_t m_LastNode = NONE; // Block ending the range, extended by Grow
+
+    std::vector<Node> m_Nodes;
+    std::vector<uint32_t> m_ReleasedNodes;
+    uint32_t m_BinHeads[BIN_COUNT];
+    uint32_t m_UsedBinsTop = 0;  // Bit t: m_UsedBins[t] is non-zero
+    uint32_t m_UsedBins[BIN_COUNT / 32] = {};
+};
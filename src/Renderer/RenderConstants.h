@@ -0,0 +1,83 @@
+// src/Renderer/RenderConstants.h
+#pragma once
+
+#include <glm/glm.hpp>
+#include <cstdint>
+#include <string>
+
+// Engine-wide uniform buffer binding points. Shader::Reflect() binds every
+// block it finds by name, so shaders never hardcode these numbers.
+enum class UniformBlockBinding : uint32_t {
+    FrameConstants = 0,
+    ObjectConstants = 1
+};
+
+inline int GetUniformBlockBinding(const std::string& blockName) {
+    if (blockName == "FrameConstants")  return static_cast<int>(UniformBlockBinding::FrameConstants);
+    if (blockName == "ObjectConstants") return static_cast<int>(UniformBlockBinding::ObjectConstants);
+    return -1;
+}
+
+// Shader storage binding points of the indirect path. GLSL 4.30 declares
+// them in the layout of each block, so the shaders repeat these numbers.
+enum class StorageBlockBinding : uint32_t {
+    Instances = 0, // InstanceData of every instanced draw (the instance stream)
+    Draws = 1      // IndirectDrawData, one per indirect draw
+};
+
+// Texture units of the lit shaders. Samplers are set once per program.
+enum class TextureUnit : uint32_t {
+    Diffuse = 0,       // Mesh texture, bound per draw
+    Lights = 1,        // Buffer textures of the clustered lights, bound once per frame (see LightClusters)
+    ClusterRanges = 2,
+    LightIndices = 3
+};
+
+// std140 mirrors of the GLSL blocks. Only 16-byte vectors and mat4 members, so the C++
+// layout matches std140 without manual padding.
+
+// Updated once per frame
+struct FrameConstants {
+    glm::mat4 View;
+    glm::mat4 Projection;
+    glm::mat4 ViewProjection;
+    glm::vec4 ViewPosition;  // xyz
+    glm::vec4 AmbientColor;  // rgb
+    glm::vec4 ClusterScale;  // xy: clusters per pixel, z and w: slice scale and bias (see LightClusters)
+    glm::uvec4 ClusterCount; // xyz: cluster grid, w: lights
+};
+
+// One slot per drawn object in the ring buffer
+struct ObjectConstants {
+    glm::mat4 Model;
+    glm::mat4 NormalMatrix; // transpose(inverse(mat3(Model))), padded to a mat4 for std140
+};
+
+// Per-instance vertex attributes of the instanced path (divisor 1). The shader
+// reads them at the locations following the mesh's own vertex attributes.
+struct InstanceData {
+    glm::mat4 Model;
+    glm::mat3 NormalMatrix;
+};
+
+// Per-draw data of the indirect path, std430 (the uint is padded to 16 bytes)
+struct IndirectDrawData {
+    glm::vec4 Dequantize[3];    // See VertexQuantization
+    uint32_t FirstInstance;     // In the instance stream
+    uint32_t Padding[3];
+};
+
+// Layout read by glMultiDrawElementsIndirect
+struct DrawElementsIndirectCommand {
+    uint32_t Count;
+    uint32_t InstanceCount;
+    uint32_t FirstIndex;
+    int32_t BaseVertex;
+    uint32_t BaseInstance;
+};
+
+static_assert(sizeof(FrameConstants) == 3 * 64 + 4 * 16, "FrameConstants must match the std140 layout");
+static_assert(sizeof(ObjectConstants) == 2 * 64, "ObjectConstants must match the std140 layout");
+static_assert(sizeof(InstanceData) == 25 * sizeof(float), "The indirect shader reads InstanceData as 25 packed floats");
+static_assert(sizeof(IndirectDrawData) == 64, "IndirectDrawData must match the std430 layout");
+static_assert(sizeof(DrawElementsIndirectCommand) == 20, "DrawElementsIndirectCommand is read by the GPU");
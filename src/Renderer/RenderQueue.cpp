@@ -0,0 +1,321 @@
+// src/Renderer/RenderQueue.cpp
+#include "RenderQueue.h"
+#include "CommandList.h"
+#include "GLState.h"
+#include "Shader.h"
+#include "Texture.h"
+#include "UniformBuffer.h"
+#include "Model/Mesh.h"
+#include <glad/glad.h>
+#include <algorithm>
+#include <cstring>
+
+uint64_t RenderQueue::MakeSortKey(RenderPass pass, uint32_t program, uint32_t texture, uint32_t vertexArray, float depth) {
+    uint32_t depthBits = 0;
+    if (depth > 0.0f) {
+        std::memcpy(&depthBits, &depth, sizeof(depthBits));
+    }
+    return (static_cast<uint64_t>(pass) & 0x3) << 62
+         | (static_cast<uint64_t>(program) & 0x3F) << 56
+         | (static_cast<uint64_t>(texture) & 0xFFFF) << 40
+         | (static_cast<uint64_t>(vertexArray) & 0xFFFF) << 24
+         | static_cast<uint64_t>(depthBits >> 8);
+}
+
+void RenderQueue::Clear() {
+    m_Items.clear();
+    m_Keys.clear();
+}
+
+void RenderQueue::Submit(const CommandList& list) {
+    const uint32_t itemCount = list.GetItemCount();
+    for (uint32_t i = 0; i < itemCount; i++) {
+        m_Items.push_back({ &list, i });
+        m_Keys.push_back(list.GetItem(i).SortKey);
+    }
+}
+
+void RenderQueue::Sort() {
+    const size_t count = m_Keys.size();
+    m_Order.resize(count);
+    for (size_t i = 0; i < count; i++) {
+        m_Order[i] = static_cast<uint32_t>(i);
+    }
+    if (count < 2) {
+        return;
+    }
+
+    // All eight histograms in a single pass over the keys
+    uint32_t histograms[8][256];
+    std::memset(histograms, 0, sizeof(histograms));
+    for (uint64_t key : m_Keys) {
+        for (int digit = 0; digit < 8; digit++) {
+            histograms[digit][(key >> (digit * 8)) & 0xFF]++;
+        }
+    }
+
+    m_KeysTemp.resize(count);
+    m_OrderTemp.resize(count);
+    for (int digit = 0; digit < 8; digit++) {
+        uint32_t* histogram = histograms[digit];
+        // Every key has the same byte here: the pass would not move anything
+        if (histogram[(m_Keys[0] >> (digit * 8)) & 0xFF] == count) {
+            continue;
+        }
+        uint32_t offset = 0;
+        for (int bucket = 0; bucket < 256; bucket++) {
+            uint32_t bucketCount = histogram[bucket];
+            histogram[bucket] = offset;
+            offset += bucketCount;
+        }
+        for (size_t i = 0; i < count; i++) {
+            uint32_t bucket = static_cast<uint32_t>((m_Keys[i] >> (digit * 8)) & 0xFF);
+            uint32_t destination = histogram[bucket]++;
+            m_KeysTemp[destination] = m_Keys[i];
+            m_OrderTemp[destination] = m_Order[i];
+        }
+        m_Keys.swap(m_KeysTemp);
+        m_Order.swap(m_OrderTemp);
+    }
+}
+
+void RenderQueue::Execute(const UniformRingBuffer& objectConstants) {
+    m_Stats = RenderQueueStats();
+    m_Stats.Items = static_cast<uint32_t>(m_Items.size());
+
+    Shader* currentProgram = nullptr;
+    uint32_t currentTexture = 0;
+    GeometryArena* currentArena = nullptr;
+    uint32_t currentSlot = UINT32_MAX;
+    const VertexQuantization* currentDequantize = nullptr; // Ranges u_Dequantize holds
+    int dequantizeLocation = -1;
+
+    for (uint32_t index : m_Order) {
+        const ItemRef& ref = m_Items[index];
+        const CommandItem& item = ref.List->GetItem(ref.Item);
+        m_Stats.Commands += item.CommandCount;
+
+        for (uint32_t c = item.FirstCommand; c < item.FirstCommand + item.CommandCount; c++) {
+            const RenderCommand& command = ref.List->GetCommand(c);
+            switch (command.Type) {
+            case RenderCommandType::BindProgram: {
+                Shader* program = command.BindProgram.Program;
+                if (program != currentProgram) {
+                    program->Bind();
+                    currentProgram = program;
+                    dequantizeLocation = program->GetUniformLocation("u_Dequantize");
+                    currentDequantize = nullptr;
+                    m_Stats.ProgramBinds++;
+                } else {
+                    m_Stats.SkippedBinds++;
+                }
+                break;
+            }
+            case RenderCommandType::BindTexture: {
+                // Every diffuse texture goes to unit 0 today; the tracking assumes it
+                const Texture* texture = command.BindTexture.Image;
+                if (texture->GetRendererID() != currentTexture) {
+                    texture->Bind(command.BindTexture.Slot);
+                    currentTexture = texture->GetRendererID();
+                    m_Stats.TextureBinds++;
+                } else {
+                    m_Stats.SkippedBinds++;
+                }
+                break;
+            }
+            case RenderCommandType::BindGeometry:
+                if (command.BindGeometry.Arena != currentArena) {
+                    command.BindGeometry.Arena->Bind();
+                    currentArena = command.BindGeometry.Arena;
+                    m_Stats.VertexArrayBinds++;
+                } else {
+                    m_Stats.SkippedBinds++;
+                }
+                break;
+            case RenderCommandType::SetDequantize:
+                if (command.SetDequantize.Ranges != currentDequantize && currentProgram) {
+                    currentProgram->UploadUniformVec4Array(dequantizeLocation, &command.SetDequantize.Ranges->PositionOffset, 3);
+                    currentDequantize = command.SetDequantize.Ranges;
+                }
+                break;
+            case RenderCommandType::SetObjectConstants:
+                if (command.SetObjectConstants.Slot != currentSlot) {
+                    objectConstants.Bind(command.SetObjectConstants.Slot);
+                    currentSlot = command.SetObjectConstants.Slot;
+                    m_Stats.UniformBufferBinds++;
+                } else {
+                    m_Stats.SkippedBinds++;
+                }
+                break;
+            case RenderCommandType::DrawIndexed: {
+                if (!currentArena) {
+                    break;
+                }
+                const auto& draw = command.DrawIndexed;
+                const GLenum indexType = currentArena->GetIndexType();
+                const void* indexOffset = reinterpret_cast<const void*>(static_cast<uintptr_t>(draw.FirstIndex) * currentArena->GetIndexSize());
+                if (draw.InstanceCount > 0) {
+                    // No-op unless the previous instanced draw read another part of the buffer
+                    currentArena->SetFirstInstance(draw.FirstInstance);
+                    glDrawElementsInstancedBaseVertex(GL_TRIANGLES, static_cast<GLsizei>(draw.IndexCount), indexType, indexOffset,
+                                                      static_cast<GLsizei>(draw.InstanceCount), draw.BaseVertex);
+                } else {
+                    glDrawElementsBaseVertex(GL_TRIANGLES, static_cast<GLsizei>(draw.IndexCount), indexType, indexOffset, draw.BaseVertex);
+                }
+                m_Stats.DrawCalls++;
+                break;
+            }
+            }
+        }
+    }
+}
+
+bool RenderQueue::IsIndirectSupported() {
+    return GLAD_GL_VERSION_4_3 != 0;
+}
+
+bool RenderQueue::HasDrawIdBuiltin() {
+    GLint extensionCount = 0;
+    glGetIntegerv(GL_NUM_EXTENSIONS, &extensionCount);
+    for (GLint i = 0; i < extensionCount; i++) {
+        const char* extension = reinterpret_cast<const char*>(glGetStringi(GL_EXTENSIONS, static_cast<GLuint>(i)));
+        if (extension && std::strcmp(extension, "GL_ARB_shader_draw_parameters") == 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void RenderQueue::ExecuteIndirect(uint32_t instanceBuffer) {
+    m_Stats = RenderQueueStats();
+    m_Stats.Items = static_cast<uint32_t>(m_Items.size());
+    m_IndirectCommands.clear();
+    m_IndirectDrawData.clear();
+    m_IndirectGroups.clear();
+
+    // --- 1. Build the draws on the CPU ---
+    // Binds only start a new group when they change something
+    Shader* program = nullptr;
+    const Texture* texture = nullptr;
+    GeometryArena* arena = nullptr;
+    const VertexQuantization* dequantize = nullptr;
+    bool stateChanged = true;
+    for (uint32_t index : m_Order) {
+        const ItemRef& ref = m_Items[index];
+        const CommandItem& item = ref.List->GetItem(ref.Item);
+        m_Stats.Commands += item.CommandCount;
+
+        for (uint32_t c = item.FirstCommand; c < item.FirstCommand + item.CommandCount; c++) {
+            const RenderCommand& command = ref.List->GetCommand(c);
+            switch (command.Type) {
+            case RenderCommandType::BindProgram:
+                stateChanged |= command.BindProgram.Program != program;
+                program = command.BindProgram.Program;
+                break;
+            case RenderCommandType::BindTexture:
+                // Every diffuse texture goes to unit 0 today, as in Execute
+                if (!texture || command.BindTexture.Image->GetRendererID() != texture->GetRendererID()) {
+                    texture = command.BindTexture.Image;
+                    stateChanged = true;
+                }
+                break;
+            case RenderCommandType::BindGeometry:
+                stateChanged |= command.BindGeometry.Arena != arena;
+                arena = command.BindGeometry.Arena;
+                break;
+            case RenderCommandType::SetDequantize:
+                dequantize = command.SetDequantize.Ranges;
+                break;
+            case RenderCommandType::SetObjectConstants:
+                break;
+            case RenderCommandType::DrawIndexed: {
+                const auto& draw = command.DrawIndexed;
+                if (!program || !arena || !dequantize || draw.InstanceCount == 0) {
+                    break;
+                }
+                if (stateChanged) {
+                    m_IndirectGroups.push_back({ program, texture, arena, static_cast<uint32_t>(m_IndirectCommands.size()), 0 });
+                    stateChanged = false;
+                }
+                const uint32_t drawIndex = static_cast<uint32_t>(m_IndirectCommands.size());
+                // The base instance carries the draw index for a_DrawIndex;
+                // the instances themselves are fetched from FirstInstance
+                m_IndirectCommands.push_back({ draw.IndexCount, draw.InstanceCount, draw.FirstIndex, draw.BaseVertex, drawIndex });
+                IndirectDrawData drawData = {};
+                std::memcpy(drawData.Dequantize, &dequantize->PositionOffset, sizeof(drawData.Dequantize));
+                drawData.FirstInstance = draw.FirstInstance;
+                m_IndirectDrawData.push_back(drawData);
+                m_IndirectGroups.back().DrawCount++;
+                break;
+            }
+            }
+        }
+    }
+    const uint32_t drawCount = static_cast<uint32_t>(m_IndirectCommands.size());
+    m_Stats.IndirectDraws = drawCount;
+
+    // --- 2. Upload them ---
+    if (!m_CommandStream) {
+        GLint storageAlignment = 256;
+        glGetIntegerv(GL_SHADER_STORAGE_BUFFER_OFFSET_ALIGNMENT, &storageAlignment);
+        m_CommandStream = std::make_unique<DynamicBuffer>(1024 * static_cast<uint32_t>(sizeof(DrawElementsIndirectCommand)), static_cast<uint32_t>(sizeof(DrawElementsIndirectCommand)));
+        m_DrawDataStream = std::make_unique<DynamicBuffer>(1024 * static_cast<uint32_t>(sizeof(IndirectDrawData)), static_cast<uint32_t>(std::max(storageAlignment, 1)));
+        m_DrawIdBuiltin = HasDrawIdBuiltin();
+    }
+    const uint32_t commandBytes = drawCount * static_cast<uint32_t>(sizeof(DrawElementsIndirectCommand));
+    const uint32_t drawDataBytes = drawCount * static_cast<uint32_t>(sizeof(IndirectDrawData));
+    m_CommandStream->BeginFrame(commandBytes);
+    m_DrawDataStream->BeginFrame(drawDataBytes);
+    if (drawCount == 0) {
+        return;
+    }
+    const DynamicAllocation commands = m_CommandStream->Allocate(commandBytes);
+    const DynamicAllocation drawData = m_DrawDataStream->Allocate(drawDataBytes);
+    std::memcpy(commands.Data, m_IndirectCommands.data(), commandBytes);
+    std::memcpy(drawData.Data, m_IndirectDrawData.data(), drawDataBytes);
+    m_CommandStream->Flush();
+    m_DrawDataStream->Flush();
+
+    // --- 3. One call per group ---
+    GLState::BindBuffer(GL_DRAW_INDIRECT_BUFFER, m_CommandStream->GetRendererID());
+    GLState::BindBufferBase(GL_SHADER_STORAGE_BUFFER, static_cast<uint32_t>(StorageBlockBinding::Instances), instanceBuffer);
+    GLState::BindBufferRange(GL_SHADER_STORAGE_BUFFER, static_cast<uint32_t>(StorageBlockBinding::Draws), m_DrawDataStream->GetRendererID(), drawData.Offset, drawDataBytes);
+    const std::shared_ptr<VertexBuffer>& drawIndexBuffer = Mesh::GetDrawIndexBuffer(m_DrawIdBuiltin ? 0 : drawCount);
+
+    Shader* currentProgram = nullptr;
+    uint32_t currentTexture = 0;
+    GeometryArena* currentArena = nullptr;
+    int drawBaseLocation = -1;
+    for (const IndirectGroup& group : m_IndirectGroups) {
+        if (group.Program != currentProgram) {
+            group.Program->Bind();
+            currentProgram = group.Program;
+            drawBaseLocation = group.Program->GetUniformLocation("u_DrawBase");
+            m_Stats.ProgramBinds++;
+        }
+        if (group.Image && group.Image->GetRendererID() != currentTexture) {
+            group.Image->Bind(0);
+            currentTexture = group.Image->GetRendererID();
+            m_Stats.TextureBinds++;
+        }
+        if (group.Arena != currentArena) {
+            if (!m_DrawIdBuiltin) {
+                group.Arena->AttachDrawIndexBuffer(drawIndexBuffer);
+            }
+            group.Arena->Bind();
+            currentArena = group.Arena;
+            m_Stats.VertexArrayBinds++;
+        }
+        // gl_DrawIDARB restarts at 0 with every call
+        if (drawBaseLocation >= 0) {
+            currentProgram->SetInt(drawBaseLocation, static_cast<int>(group.FirstDraw));
+        }
+        const uintptr_t commandOffset = commands.Offset + static_cast<uintptr_t>(group.FirstDraw) * sizeof(DrawElementsIndirectCommand);
+        glMultiDrawElementsIndirect(GL_TRIANGLES, group.Arena->GetIndexType(), reinterpret_cast<const void*>(commandOffset),
+                                    static_cast<GLsizei>(group.DrawCount), 0);
+        m_Stats.DrawCalls++;
+    }
+
+    m_CommandStream->EndFrame();
+    m_DrawDataStream->EndFrame();
+}
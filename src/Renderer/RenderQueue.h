@@ -0,0 +1,104 @@
+// src/Renderer/RenderQueue.h
+#pragma once
+
+#include "DynamicBuffer.h"
+#include "RenderConstants.h"
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+class CommandList;
+class UniformRingBuffer;
+class Shader;
+class Texture;
+class GeometryArena;
+
+enum class RenderPass : uint8_t {
+    Opaque = 0,
+    Transparent = 1
+};
+
+struct RenderQueueStats {
+    uint32_t Items = 0;    // Command items replayed
+    uint32_t Commands = 0; // Commands read, before bind elision
+    uint32_t DrawCalls = 0;
+    uint32_t IndirectDraws = 0; // Draws packed into the multi-draw calls (ExecuteIndirect)
+    uint32_t ProgramBinds = 0;
+    uint32_t TextureBinds = 0;
+    uint32_t VertexArrayBinds = 0;
+    uint32_t UniformBufferBinds = 0;
+    uint32_t SkippedBinds = 0; // Binds avoided because the state was already current
+};
+
+// Merges the command lists recorded for a frame (one per thread, see
+// CommandList), sorts their items on a packed 64-bit key and replays them on
+// the GL thread, skipping every bind that would not change the GL state.
+// Submit and Sort never touch GL; only Execute does.
+//
+// Key layout, most significant first:
+//   [63..62] pass | [61..56] program | [55..40] texture | [39..24] VAO | [23..0] depth
+// Program/texture/VAO fields hold the low bits of the GL names: a collision
+// only makes the grouping less perfect, the bind tracking stays exact. Meshes
+// share the VAO of their GeometryArena, so that field only tells arenas apart.
+// Depth is the top of the float's bit pattern (positive floats sort like
+// integers), so opaque draws sharing the same state go front to back.
+class RenderQueue {
+public:
+    static uint64_t MakeSortKey(RenderPass pass, uint32_t program, uint32_t texture, uint32_t vertexArray, float depth);
+
+    void Clear();
+    // Adds every item of `list`, which must stay untouched until Execute
+    void Submit(const CommandList& list);
+    // Radix sort on the keys (stable, 8 bits per pass, constant passes skipped).
+    // Lists submitted in the same order give the same draw order.
+    void Sort();
+    // Replays the items in key order
+    void Execute(const UniformRingBuffer& objectConstants);
+    // Same, GPU-driven: the draws become DrawElementsIndirectCommands, and a
+    // run of draws sharing program, texture and arena is issued as one
+    // glMultiDrawElementsIndirect. Every draw must be instanced (object
+    // constants are ignored) and its program built for the indirect path:
+    // instances come from `instanceBuffer` and per-draw data (dequantization
+    // ranges, first instance) from a storage buffer, indexed by gl_DrawIDARB
+    // plus u_DrawBase, or by a_DrawIndex read at the base instance without
+    // ARB_shader_draw_parameters. Requires IsIndirectSupported().
+    void ExecuteIndirect(uint32_t instanceBuffer);
+
+    // GL 4.3: multi-draw indirect and shader storage buffers
+    static bool IsIndirectSupported();
+    // GL_ARB_shader_draw_parameters: the shaders may read gl_DrawIDARB
+    static bool HasDrawIdBuiltin();
+
+    uint32_t GetItemCount() const { return static_cast<uint32_t>(m_Items.size()); }
+    const RenderQueueStats& GetStats() const { return m_Stats; }
+
+private:
+    struct ItemRef {
+        const CommandList* List;
+        uint32_t Item;
+    };
+
+    std::vector<ItemRef> m_Items;
+    std::vector<uint64_t> m_Keys;
+    std::vector<uint32_t> m_Order;
+    // Radix sort scratch
+    std::vector<uint64_t> m_KeysTemp;
+    std::vector<uint32_t> m_OrderTemp;
+    RenderQueueStats m_Stats;
+
+    // Draws of one glMultiDrawElementsIndirect
+    struct IndirectGroup {
+        Shader* Program;
+        const Texture* Image; // Null: whatever unit 0 holds
+        GeometryArena* Arena;
+        uint32_t FirstDraw;
+        uint32_t DrawCount;
+    };
+    std::vector<DrawElementsIndirectCommand> m_IndirectCommands;
+    std::vector<IndirectDrawData> m_IndirectDrawData;
+    std::vector<IndirectGroup> m_IndirectGroups;
+    // Created on the first ExecuteIndirect
+    std::unique_ptr<DynamicBuffer> m_CommandStream;
+    std::unique_ptr<DynamicBuffer> m_DrawDataStream;
+    bool m_DrawIdBuiltin = false;
+};
@@ -0,0 +1,54 @@
+// src/Renderer/RenderSnapshot.h
+#pragma once
+
+#include "Bounds.h"
+#include <entt/entt.hpp>
+#include <glm/glm.hpp>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+class Model;
+
+struct RenderLight {
+    glm::vec3 Position;
+    glm::vec3 Color; // Already multiplied by the intensity
+    float Range;
+};
+
+// A ModelComponent entity whose bounds may be in view
+struct RenderObject {
+    const Model* SourceModel = nullptr;
+    uint32_t Lod = 0; // Picked at extraction (see LodComponent)
+    glm::mat4 World;
+};
+
+// Everything SceneRenderer needs to draw one frame, copied out of the Scene
+// by SceneRenderer::Extract. Rendering a snapshot never reads the registry,
+// so the simulation can go on with the next frame meanwhile (see RenderThread).
+// Objects point at their model without owning it: a model whose last
+// ModelComponent goes away is retired by the Scene, and only freed on the GL
+// thread once a later snapshot has been drawn (see RetiredModels).
+struct RenderSnapshot {
+    uint64_t FrameIndex = 0;
+    uint64_t ExtractTime = 0; // Profiler clock, when the extraction started
+
+    glm::mat4 View = glm::mat4(1.0f);
+    glm::mat4 Projection = glm::mat4(1.0f);
+    glm::vec3 CameraPosition = glm::vec3(0.0f);
+    std::vector<RenderLight> Lights;
+
+    // Candidates of the scene BVH for the camera frustum. The three arrays
+    // are parallel; bounds are apart for the SIMD culling.
+    std::vector<entt::entity> Entities;
+    std::vector<RenderObject> Objects;
+    std::vector<AABB> Bounds;
+    uint32_t ProxyCount = 0; // Entities in the scene BVH, for the culling stats
+
+    // Models whose ModelComponent was destroyed since the previous extraction
+    // (see Scene::TakeRetiredModels). Extract only appends, so the models of
+    // a snapshot that is dropped unread ride along with the next one; the GL
+    // thread clears the list after drawing the snapshot, which frees them
+    // there, after every earlier snapshot that could point at them.
+    std::vector<std::shared_ptr<Model>> RetiredModels;
+};
@@ -0,0 +1,91 @@
+// src/Renderer/RenderThread.cpp
+#include "RenderThread.h"
+#include "../Core/JobSystem.h"
+#include "../Core/Profiler.h"
+#include <chrono>
+
+// Polls spent yielding before the render thread starts sleeping between
+// polls, and the length of those sleeps
+static constexpr uint32_t SPIN_POLLS = 64;
+static constexpr auto IDLE_SLEEP = std::chrono::microseconds(100);
+
+RenderThread::~RenderThread() {
+    Stop();
+}
+
+void RenderThread::Start(ContextFunction attach, FrameFunction renderFrame, ContextFunction detach) {
+    if (m_Running.load()) {
+        return;
+    }
+    m_Attach = std::move(attach);
+    m_RenderFrame = std::move(renderFrame);
+    m_Detach = std::move(detach);
+    m_Published.store(0);
+    m_Rendered.store(0);
+    m_LastLatency.store(0);
+    m_TotalLatency.store(0);
+    m_Running.store(true);
+    m_Thread = std::thread(&RenderThread::Loop, this);
+}
+
+void RenderThread::Stop() {
+    if (!m_Running.exchange(false)) {
+        return;
+    }
+    m_Thread.join();
+}
+
+void RenderThread::Publish() {
+    m_Snapshots.Publish();
+    m_Published.fetch_add(1);
+}
+
+RenderThreadStats RenderThread::GetStats() const {
+    RenderThreadStats stats;
+    stats.FramesRendered = m_Rendered.load();
+    const uint64_t published = m_Published.load();
+    const uint64_t pending = IsSnapshotPending() ? 1 : 0;
+    stats.SnapshotsDropped = published > stats.FramesRendered + pending ? published - stats.FramesRendered - pending : 0;
+    stats.LastLatencyMs = m_LastLatency.load() / 1e6;
+    stats.AverageLatencyMs = stats.FramesRendered > 0 ? m_TotalLatency.load() / 1e6 / stats.FramesRendered : 0.0;
+    return stats;
+}
+
+void RenderThread::Loop() {
+    Profiler::SetThreadName("Render");
+    // Its own job system index: recording contexts are per thread, and the
+    // main thread keeps running jobs of its own
+    const bool attached = JobSystem::AttachThread();
+    if (m_Attach) {
+        m_Attach();
+    }
+
+    uint32_t idlePolls = 0;
+    while (m_Running.load()) {
+        if (!m_Snapshots.Acquire()) {
+            if (++idlePolls < SPIN_POLLS) {
+                std::this_thread::yield();
+            } else {
+                std::this_thread::sleep_for(IDLE_SLEEP);
+            }
+            continue;
+        }
+        idlePolls = 0;
+
+        RenderSnapshot& snapshot = m_Snapshots.GetReadBuffer();
+        m_RenderFrame(snapshot);
+        // On the GL thread, after the frame: see RenderSnapshot::RetiredModels
+        snapshot.RetiredModels.clear();
+        const uint64_t latency = Profiler::GetTime() - snapshot.ExtractTime;
+        m_LastLatency.store(latency);
+        m_TotalLatency.fetch_add(latency);
+        m_Rendered.fetch_add(1);
+    }
+
+    if (m_Detach) {
+        m_Detach();
+    }
+    if (attached) {
+        JobSystem::DetachThread();
+    }
+}
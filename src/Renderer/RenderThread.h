@@ -0,0 +1,67 @@
+// src/Renderer/RenderThread.h
+#pragma once
+
+#include "RenderSnapshot.h"
+#include "../Core/TripleBuffer.h"
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <thread>
+
+struct RenderThreadStats {
+    uint64_t FramesRendered = 0;
+    uint64_t SnapshotsDropped = 0; // Replaced by a newer one before being drawn
+    double LastLatencyMs = 0.0;    // From the extraction to the end of the frame callback
+    double AverageLatencyMs = 0.0;
+};
+
+// Render thread of the pipelined mode: while it draws the snapshot of frame
+// N, the simulation thread updates the scene and extracts frame N+1 (see
+// SceneRenderer::Extract). Snapshots go through a TripleBuffer, so neither
+// thread waits for the other: a GPU stall at swap no longer holds the
+// simulation back, and a snapshot published before the previous one was
+// drawn simply replaces it. The cost is up to one frame of added latency.
+//
+// The thread owns the GL context while it runs: `attach` makes the context
+// current on it, `detach` releases it before the thread ends. Every GL call
+// of a frame (texture uploads, GPU profiler, swap) belongs in `renderFrame`;
+// after it returns, the thread frees the snapshot's RetiredModels.
+class RenderThread {
+public:
+    using ContextFunction = std::function<void()>;
+    using FrameFunction = std::function<void(const RenderSnapshot& snapshot)>;
+
+    RenderThread() = default;
+    ~RenderThread();
+    RenderThread(const RenderThread&) = delete;
+    RenderThread& operator=(const RenderThread&) = delete;
+
+    void Start(ContextFunction attach, FrameFunction renderFrame, ContextFunction detach);
+    // Lets the frame in progress finish, then joins. A pending snapshot is dropped.
+    void Stop();
+    bool IsRunning() const { return m_Running.load(); }
+
+    // --- Simulation thread ---
+    // The snapshot to fill next, owned by the simulation until Publish
+    RenderSnapshot& GetWriteSnapshot() { return m_Snapshots.GetWriteBuffer(); }
+    void Publish();
+    // True until the render thread picks up the last published snapshot
+    bool IsSnapshotPending() const { return m_Snapshots.HasUnread(); }
+
+    RenderThreadStats GetStats() const;
+
+private:
+    void Loop();
+
+    TripleBuffer<RenderSnapshot> m_Snapshots;
+    std::thread m_Thread;
+    std::atomic<bool> m_Running{ false };
+    ContextFunction m_Attach;
+    ContextFunction m_Detach;
+    FrameFunction m_RenderFrame;
+
+    std::atomic<uint64_t> m_Published{ 0 };
+    std::atomic<uint64_t> m_Rendered{ 0 };
+    std::atomic<uint64_t> m_LastLatency{ 0 };  // Nanoseconds
+    std::atomic<uint64_t> m_TotalLatency{ 0 }; // Same
+};
@@ -0,0 +1,603 @@
+// src/Renderer/SceneRenderer.cpp
+#include "SceneRenderer.h"
+#include "Camera.h"
+#include "DynamicBuffer.h"
+#include "Frustum.h"
+#include "GpuProfiler.h"
+#include "TextureBuffer.h"
+#include "../Core/JobSystem.h"
+#include "../Core/Profiler.h"
+#include "../Scene/Scene.h"
+#include "../Scene/Components.h"
+#include <glad/glad.h>
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <vector>
+
+// --- SHADERS ---
+// Compiled as is, with INSTANCED defined, and with INDIRECT defined for the
+// multi-draw indirect path (GLSL 4.30, see WithDefine)
+const std::string litVertexShaderSource = R"(
+    // Quantized mesh attributes (see PackedVertex)
+    layout (location = 0) in vec3 a_Position;  // unorm16, relative to the mesh box
+    layout (location = 1) in vec2 a_Normal;    // octahedral, raw int16
+    layout (location = 2) in vec2 a_TexCoords; // unorm16, relative to the mesh UV range
+
+    // [0] position offset, [1] position scale, [2] UV offset (xy) and scale (zw)
+#ifndef INDIRECT
+    uniform vec4 u_Dequantize[3];
+#endif
+
+    layout (std140) uniform FrameConstants {
+        mat4 u_View;
+        mat4 u_Projection;
+        mat4 u_ViewProjection;
+        vec4 u_ViewPos;
+        vec4 u_AmbientColor;
+        vec4 u_ClusterScale;
+        uvec4 u_ClusterCount;
+    };
+
+#if defined(INDIRECT)
+    // Instances and per-draw data come from storage buffers, bound by
+    // RenderQueue::ExecuteIndirect (see StorageBlockBinding, IndirectDrawData)
+    struct DrawData {
+        vec4 Dequantize[3];
+        uint FirstInstance;
+    };
+    layout (std430, binding = 0) readonly buffer InstanceBlock {
+        float u_Instances[]; // InstanceData: 16 floats of model matrix, 9 of normal matrix
+    };
+    layout (std430, binding = 1) readonly buffer DrawBlock {
+        DrawData u_Draws[];
+    };
+#ifdef DRAW_ID_BUILTIN
+    uniform int u_DrawBase; // gl_DrawIDARB restarts at 0 with every call
+#else
+    // Same for every instance of a draw: read at its base instance, which
+    // holds the draw index, and never advanced (divisor 0xFFFFFFFF). After the
+    // mesh and instance attributes, see GeometryArena::AttachDrawIndexBuffer.
+    layout (location = 10) in float a_DrawIndex;
+#endif
+
+    vec4 InstanceVec4(int i) { return vec4(u_Instances[i], u_Instances[i + 1], u_Instances[i + 2], u_Instances[i + 3]); }
+    vec3 InstanceVec3(int i) { return vec3(u_Instances[i], u_Instances[i + 1], u_Instances[i + 2]); }
+#elif defined(INSTANCED)
+    // Per-instance attributes, right after the mesh attributes (see InstanceData)
+    layout (location = 3) in mat4 a_Model;
+    layout (location = 7) in mat3 a_NormalMatrix;
+#else
+    layout (std140) uniform ObjectConstants {
+        mat4 u_Model;
+        mat4 u_NormalMatrix;
+    };
+#endif
+
+    out vec2 v_TexCoords;
+    out vec3 v_Normal;
+    out vec3 v_FragPos;
+    out float v_ViewDepth; // Picks the cluster's depth slice
+
+    vec3 DecodeOctahedral(vec2 encoded) {
+        vec3 n = vec3(encoded, 1.0 - abs(encoded.x) - abs(encoded.y));
+        float fold = max(-n.z, 0.0);
+        n.x += n.x >= 0.0 ? -fold : fold;
+        n.y += n.y >= 0.0 ? -fold : fold;
+        return normalize(n);
+    }
+
+    void main() {
+#if defined(INDIRECT)
+#ifdef DRAW_ID_BUILTIN
+       DrawData draw = u_Draws[u_DrawBase + gl_DrawIDARB];
+#else
+       DrawData draw = u_Draws[int(a_DrawIndex)];
+#endif
+       int base = int(draw.FirstInstance + uint(gl_InstanceID)) * 25;
+       mat4 model = mat4(InstanceVec4(base), InstanceVec4(base + 4), InstanceVec4(base + 8), InstanceVec4(base + 12));
+       mat3 normalMatrix = mat3(InstanceVec3(base + 16), InstanceVec3(base + 19), InstanceVec3(base + 22));
+       vec4 dequantize[3] = draw.Dequantize;
+#elif defined(INSTANCED)
+       mat4 model = a_Model;
+       mat3 normalMatrix = a_NormalMatrix;
+       vec4 dequantize[3] = u_Dequantize;
+#else
+       mat4 model = u_Model;
+       mat3 normalMatrix = mat3(u_NormalMatrix);
+       vec4 dequantize[3] = u_Dequantize;
+#endif
+       vec3 position = dequantize[0].xyz + a_Position * dequantize[1].xyz;
+       vec3 normal = DecodeOctahedral(max(a_Normal / 32767.0, vec2(-1.0)));
+       vec4 worldPosition = model * vec4(position, 1.0);
+       gl_Position = u_ViewProjection * worldPosition;
+       v_TexCoords = dequantize[2].xy + a_TexCoords * dequantize[2].zw;
+       v_FragPos = worldPosition.xyz;
+       v_ViewDepth = -(u_View * worldPosition).z;
+       v_Normal = normalMatrix * normal;
+    }
+)";
+
+const std::string litFragmentShaderSource = R"(
+    in vec2 v_TexCoords;
+    in vec3 v_Normal;
+    in vec3 v_FragPos;
+    in float v_ViewDepth;
+
+    out vec4 FragColor;
+
+    layout (std140) uniform FrameConstants {
+        mat4 u_View;
+        mat4 u_Projection;
+        mat4 u_ViewProjection;
+        vec4 u_ViewPos;
+        vec4 u_AmbientColor;
+        vec4 u_ClusterScale;
+        uvec4 u_ClusterCount;
+    };
+
+    uniform sampler2D u_TextureDiffuse;
+
+    // Clustered lights (see LightClusters, TextureUnit)
+    uniform samplerBuffer u_Lights;         // Two texels per light: position and range, color
+    uniform usamplerBuffer u_ClusterRanges; // Per cluster: first entry of u_LightIndices, entry count
+    uniform usamplerBuffer u_LightIndices;
+
+    void main() {
+       ivec3 cluster = ivec3(ivec2(gl_FragCoord.xy * u_ClusterScale.xy), int(floor(log(v_ViewDepth) * u_ClusterScale.z + u_ClusterScale.w)));
+       cluster = clamp(cluster, ivec3(0), ivec3(u_ClusterCount.xyz) - 1);
+       uvec2 range = texelFetch(u_ClusterRanges, (cluster.z * int(u_ClusterCount.y) + cluster.y) * int(u_ClusterCount.x) + cluster.x).xy;
+
+       vec3 norm = normalize(v_Normal);
+       vec3 diffuse = vec3(0.0);
+       for (uint i = 0u; i < range.y; i++) {
+           int light = int(texelFetch(u_LightIndices, int(range.x + i)).r);
+           vec4 positionRange = texelFetch(u_Lights, light * 2);
+           vec3 toLight = positionRange.xyz - v_FragPos;
+           float distanceSq = dot(toLight, toLight);
+           // Smooth window reaching 0 at the range, where the light leaves the cluster lists
+           float falloff = clamp(1.0 - distanceSq / (positionRange.w * positionRange.w), 0.0, 1.0);
+           float diff = max(dot(norm, toLight * inversesqrt(max(distanceSq, 1e-8))), 0.0);
+           diffuse += diff * falloff * falloff * texelFetch(u_Lights, light * 2 + 1).rgb;
+       }
+
+       vec4 texColor = texture(u_TextureDiffuse, v_TexCoords);
+       vec3 result = (u_AmbientColor.rgb + diffuse) * texColor.rgb;
+       FragColor = vec4(result, 1.0);
+    }
+)";
+
+// Prepends the GLSL version (and whatever must precede the body, such as
+// #extension) and an optional define to a shader body
+static std::string WithDefine(const std::string& source, const char* define = nullptr, const std::string& version = "#version 330 core\n") {
+    std::string header = version;
+    if (define) {
+        header += std::string("#define ") + define + "\n";
+    }
+    return header + source;
+}
+
+// Boxes tested per culling job
+static constexpr uint32_t CULL_GRAIN = 4096;
+
+// Texture field of the sort key: the one RecordMeshDraw binds on unit 0
+static uint32_t GetTextureKey(const Mesh& mesh) {
+    return mesh.textures.empty() ? 0 : mesh.textures.back()->GetRendererID();
+}
+
+// VAO field of the sort key: the one of the mesh's arena
+static uint32_t GetVertexArrayKey(const Mesh& mesh) {
+    return mesh.Geometry->GetArena().GetVertexArray().GetRendererID();
+}
+
+// Candidates extracted per job, visible entities handled per instance job
+// and single entities recorded per job
+static constexpr uint32_t EXTRACT_GRAIN = 1024;
+static constexpr uint32_t INSTANCE_GRAIN = 1024;
+static constexpr uint32_t RECORD_GRAIN = 256;
+
+// Records one mesh draw as a self-contained item, every bind included: items
+// are reordered before the replay, which drops the binds that change nothing.
+// Returns the triangles drawn.
+static uint32_t RecordMeshDraw(CommandList& commands, Shader& program, const Mesh& mesh, uint32_t lodLevel, float depth,
+                               uint32_t objectSlot, uint32_t instanceCount, uint32_t firstInstance) {
+    GeometryArena& arena = mesh.Geometry->GetArena();
+    commands.BeginItem(RenderQueue::MakeSortKey(RenderPass::Opaque, program.GetRendererID(), GetTextureKey(mesh), GetVertexArrayKey(mesh), depth));
+    commands.BindProgram(&program);
+    // Every diffuse texture goes to unit 0, so only the last one is visible
+    if (!mesh.textures.empty()) {
+        commands.BindTexture(mesh.textures.back().get(), 0);
+    }
+    commands.BindGeometry(&arena);
+    commands.SetDequantize(&mesh.Quantization);
+    if (instanceCount == 0) {
+        commands.SetObjectConstants(objectSlot);
+    }
+    // LOD ranges are relative to the mesh's slice of the arena. Ranges only
+    // move when a mesh is uploaded, never while a frame is recorded.
+    const GeometryRange& range = mesh.Geometry->GetRange();
+    const MeshLod& lod = mesh.GetLod(lodLevel);
+    commands.DrawIndexed(lod.IndexCount, range.FirstIndex + lod.IndexOffset, static_cast<int32_t>(range.BaseVertex), instanceCount, firstInstance);
+    return lod.IndexCount / 3 * std::max(instanceCount, 1u);
+}
+
+// A Model shared by fewer entities than this is drawn without instancing
+static constexpr size_t MIN_INSTANCED_BATCH = 2;
+
+// LOD l+1 takes over once the projected size (bounding sphere diameter over
+// screen height) drops below LOD_SCREEN_SIZE / 2^l. A switch only happens
+// LOD_HYSTERESIS past the threshold, so an entity sitting on it does not pop.
+static constexpr float LOD_SCREEN_SIZE = 0.25f;
+static constexpr float LOD_HYSTERESIS = 0.15f;
+
+static uint32_t SelectLod(float screenSize, uint32_t currentLevel, uint32_t levelCount) {
+    auto threshold = [](uint32_t level) { return LOD_SCREEN_SIZE * std::ldexp(1.0f, -static_cast<int>(level)); };
+    uint32_t level = std::min(currentLevel, levelCount - 1);
+    while (level + 1 < levelCount && screenSize < threshold(level) * (1.0f - LOD_HYSTERESIS)) {
+        level++;
+    }
+    while (level > 0 && screenSize > threshold(level - 1) * (1.0f + LOD_HYSTERESIS)) {
+        level--;
+    }
+    return level;
+}
+
+// Share of the average light color lighting everything
+static constexpr float AMBIENT_STRENGTH = 0.1f;
+
+// Samplers never change: set them once instead of once per mesh
+static void SetSamplers(Shader& shader) {
+    shader.Bind();
+    shader.SetInt(shader.GetUniformLocation("u_TextureDiffuse"), static_cast<int>(TextureUnit::Diffuse));
+    shader.SetInt(shader.GetUniformLocation("u_Lights"), static_cast<int>(TextureUnit::Lights));
+    shader.SetInt(shader.GetUniformLocation("u_ClusterRanges"), static_cast<int>(TextureUnit::ClusterRanges));
+    shader.SetInt(shader.GetUniformLocation("u_LightIndices"), static_cast<int>(TextureUnit::LightIndices));
+}
+
+SceneRenderer::SceneRenderer() {
+    m_LitShader = std::make_unique<Shader>(WithDefine(litVertexShaderSource), WithDefine(litFragmentShaderSource));
+    m_InstancedShader = std::make_unique<Shader>(WithDefine(litVertexShaderSource, "INSTANCED"), WithDefine(litFragmentShaderSource));
+    m_FrameConstants = std::make_unique<UniformBuffer>(static_cast<uint32_t>(sizeof(FrameConstants)), static_cast<uint32_t>(UniformBlockBinding::FrameConstants));
+    m_ObjectConstants = std::make_unique<UniformRingBuffer>(static_cast<uint32_t>(sizeof(ObjectConstants)), 1024, static_cast<uint32_t>(UniformBlockBinding::ObjectConstants));
+    m_LightBuffer = std::make_unique<TextureBuffer>(GL_RGBA32F);
+    m_ClusterRangeBuffer = std::make_unique<TextureBuffer>(GL_RG32UI);
+    m_LightIndexBuffer = std::make_unique<TextureBuffer>(GL_R32UI);
+    SetSamplers(*m_LitShader);
+    SetSamplers(*m_InstancedShader);
+}
+
+SceneRenderer::~SceneRenderer() {
+}
+
+void SceneRenderer::SetIndirectDraws(bool enabled) {
+    if (enabled && !RenderQueue::IsIndirectSupported()) {
+        std::cerr << "SceneRenderer: multi-draw indirect needs OpenGL 4.3, keeping direct draws" << std::endl;
+        return;
+    }
+    if (enabled && !m_IndirectShader) {
+        std::string version = "#version 430 core\n";
+        if (RenderQueue::HasDrawIdBuiltin()) {
+            version += "#extension GL_ARB_shader_draw_parameters : require\n#define DRAW_ID_BUILTIN\n";
+        }
+        m_IndirectShader = std::make_unique<Shader>(WithDefine(litVertexShaderSource, "INDIRECT", version), WithDefine(litFragmentShaderSource, nullptr, version));
+        SetSamplers(*m_IndirectShader);
+    }
+    m_IndirectDraws = enabled;
+}
+
+void SceneRenderer::Extract(Scene& scene, const Camera& camera, RenderSnapshot& outSnapshot) {
+    PLUME_PROFILE_FUNCTION();
+    entt::registry& registry = scene.GetRegistry();
+    outSnapshot.ExtractTime = Profiler::GetTime();
+    outSnapshot.View = camera.GetViewMatrix();
+    outSnapshot.Projection = camera.GetProjectionMatrix();
+    outSnapshot.CameraPosition = camera.GetPosition();
+
+    outSnapshot.Lights.clear();
+    // World position: a light may hang under a moving parent
+    auto lightView = registry.view<WorldTransformComponent, LightComponent>();
+    for (auto entity : lightView) {
+        const auto& transform = lightView.get<WorldTransformComponent>(entity);
+        const auto& light = lightView.get<LightComponent>(entity);
+        outSnapshot.Lights.push_back({ glm::vec3(transform.World[3]), light.Color * light.Intensity, light.Range });
+    }
+
+    // The scene's BVH discards whole subtrees here; the renderer tests the
+    // candidates on their exact bounds
+    outSnapshot.Entities.clear();
+    scene.QueryFrustum(Frustum(outSnapshot.Projection * outSnapshot.View), outSnapshot.Entities);
+    outSnapshot.ProxyCount = scene.GetSpatialIndex().GetProxyCount();
+    scene.TakeRetiredModels(outSnapshot.RetiredModels);
+    const uint32_t candidateCount = static_cast<uint32_t>(outSnapshot.Entities.size());
+    outSnapshot.Objects.resize(candidateCount);
+    outSnapshot.Bounds.resize(candidateCount);
+
+    // Each candidate picks a LOD from its projected size. The view is created
+    // here: the jobs only read its pools (and write their own LodComponent).
+    auto drawView = registry.view<ModelComponent, LodComponent, WorldTransformComponent, BoundsComponent>();
+    const glm::vec3 cameraPosition = camera.GetPosition();
+    const float projectionScale = outSnapshot.Projection[1][1]; // 1 / tan(fov / 2)
+    JobSystem::ParallelFor(candidateCount, EXTRACT_GRAIN, [&](uint32_t begin, uint32_t end) {
+        for (uint32_t i = begin; i < end; i++) {
+            const entt::entity entity = outSnapshot.Entities[i];
+            const AABB& bounds = drawView.get<BoundsComponent>(entity).WorldBounds;
+            RenderObject& object = outSnapshot.Objects[i];
+            object.SourceModel = drawView.get<ModelComponent>(entity).model.get();
+            object.World = drawView.get<WorldTransformComponent>(entity).World;
+            outSnapshot.Bounds[i] = bounds;
+            if (!object.SourceModel) {
+                object.Lod = 0;
+                continue;
+            }
+
+            // Projected size of the world bounding sphere; inside it, full detail
+            const float radius = glm::length(bounds.GetExtents());
+            const float distance = glm::length(bounds.GetCenter() - cameraPosition);
+            const float screenSize = distance > radius ? radius * projectionScale / distance : FLT_MAX;
+            auto& lod = drawView.get<LodComponent>(entity);
+            lod.Level = SelectLod(screenSize, lod.Level, object.SourceModel->GetLodCount());
+            object.Lod = lod.Level;
+        }
+    });
+}
+
+void SceneRenderer::Render(Scene& scene, const Camera& camera) {
+    m_Snapshot.FrameIndex++;
+    Extract(scene, camera, m_Snapshot);
+    Render(m_Snapshot);
+    m_Snapshot.RetiredModels.clear();
+}
+
+void SceneRenderer::Render(const RenderSnapshot& snapshot) {
+    PLUME_PROFILE_FUNCTION();
+    m_Stats = SceneRendererStats();
+
+    // --- 1. Light clusters ---
+    // Every light goes to the clusters its sphere touches, on the job
+    // system; the fragment shader only loops over its cluster's list.
+    const uint32_t lightCount = static_cast<uint32_t>(snapshot.Lights.size());
+    m_LightClusters.SetProjection(snapshot.Projection);
+    m_LightClusters.Assign(snapshot.Lights.data(), lightCount, snapshot.View);
+    m_Stats.Lights = lightCount;
+    m_Stats.LightIndices = m_LightClusters.GetStats().LightIndices;
+
+    // --- 2. Per-frame constants ---
+    FrameConstants frame;
+    frame.View = snapshot.View;
+    frame.Projection = snapshot.Projection;
+    frame.ViewProjection = frame.Projection * frame.View;
+    frame.ViewPosition = glm::vec4(snapshot.CameraPosition, 1.0f);
+    glm::vec3 lightSum(0.0f);
+    m_LightData.resize(static_cast<size_t>(lightCount) * 2);
+    for (uint32_t i = 0; i < lightCount; i++) {
+        const RenderLight& light = snapshot.Lights[i];
+        m_LightData[i * 2] = glm::vec4(light.Position, light.Range);
+        m_LightData[i * 2 + 1] = glm::vec4(light.Color, 1.0f);
+        lightSum += light.Color;
+    }
+    frame.AmbientColor = glm::vec4(lightCount > 0 ? AMBIENT_STRENGTH * lightSum / static_cast<float>(lightCount) : glm::vec3(0.0f), 1.0f);
+    // The shader finds its tile from gl_FragCoord: the viewport is assumed to start at the origin
+    GLint viewport[4] = { 0, 0, 1, 1 };
+    glGetIntegerv(GL_VIEWPORT, viewport);
+    frame.ClusterScale = glm::vec4(static_cast<float>(LightClusters::GRID_X) / std::max(viewport[2], 1),
+                                   static_cast<float>(LightClusters::GRID_Y) / std::max(viewport[3], 1),
+                                   m_LightClusters.GetSliceScale(), m_LightClusters.GetSliceBias());
+    frame.ClusterCount = glm::uvec4(LightClusters::GRID_X, LightClusters::GRID_Y, LightClusters::GRID_Z, lightCount);
+    m_FrameConstants->SetData(&frame, sizeof(frame));
+
+    // --- 3. Frustum culling ---
+    // The candidates left by the scene's BVH are tested on their exact
+    // bounds, with SIMD, across the job system.
+    const Frustum frustum(frame.ViewProjection);
+    const uint32_t objectCount = static_cast<uint32_t>(snapshot.Objects.size());
+    {
+        PLUME_PROFILE_SCOPE("Culling");
+        m_Visibility.resize(objectCount);
+        JobSystem::ParallelFor(objectCount, CULL_GRAIN, [&](uint32_t begin, uint32_t end) {
+            frustum.Cull(snapshot.Bounds.data() + begin, end - begin, m_Visibility.data() + begin);
+        });
+    }
+
+    // One recording context per thread that can run a job
+    m_RecordContexts.resize(JobSystem::GetThreadCount());
+    for (RecordContext& context : m_RecordContexts) {
+        context.Commands.Reset();
+        context.VisibleObjects = 0;
+        context.ReducedObjects = 0;
+        context.Triangles = 0;
+    }
+
+    // --- 4. Instance data of the visible entities ---
+    // The normal matrix is built here instead of inverting the model matrix for every vertex.
+    const glm::vec3 cameraPosition = snapshot.CameraPosition;
+    m_ObjectInstances.resize(objectCount);
+    {
+        PLUME_PROFILE_SCOPE("Instances");
+        JobSystem::ParallelFor(objectCount, INSTANCE_GRAIN, [&](uint32_t begin, uint32_t end) {
+            RecordContext& context = m_RecordContexts[JobSystem::GetThreadIndex()];
+            for (uint32_t i = begin; i < end; i++) {
+                if (!m_Visibility[i]) {
+                    continue;
+                }
+                context.VisibleObjects++;
+                const RenderObject& object = snapshot.Objects[i];
+                if (!object.SourceModel) {
+                    continue;
+                }
+                if (object.Lod > 0) {
+                    context.ReducedObjects++;
+                }
+                InstanceData& instance = m_ObjectInstances[i];
+                instance.Model = object.World;
+                instance.NormalMatrix = glm::transpose(glm::inverse(glm::mat3(instance.Model)));
+            }
+        });
+    }
+    for (const RecordContext& context : m_RecordContexts) {
+        m_Stats.VisibleObjects += context.VisibleObjects;
+        m_Stats.ReducedObjects += context.ReducedObjects;
+    }
+    m_Stats.CulledObjects = snapshot.ProxyCount - m_Stats.VisibleObjects;
+
+    // --- 5. Group the visible entities by Model and LOD ---
+    const size_t minInstancedBatch = m_IndirectDraws ? 1 : MIN_INSTANCED_BATCH;
+    Shader& instancedShader = m_IndirectDraws ? *m_IndirectShader : *m_InstancedShader;
+    static_assert(alignof(Model) >= 4, "The batch key stores the LOD level in the low bits of the Model address");
+    m_BatchIndices.clear();
+    size_t batchCount = 0;
+    {
+        PLUME_PROFILE_SCOPE("Batching");
+        uintptr_t lastKey = 0;
+        size_t lastBatch = 0;
+        for (uint32_t i = 0; i < objectCount; i++) {
+            if (!m_Visibility[i]) {
+                continue;
+            }
+            const RenderObject& object = snapshot.Objects[i];
+            if (!object.SourceModel) {
+                continue;
+            }
+            // Neighbours in the BVH often share their model: skip the lookup then
+            const uintptr_t batchKey = reinterpret_cast<uintptr_t>(object.SourceModel) | object.Lod;
+            if (batchKey != lastKey) {
+                auto [it, inserted] = m_BatchIndices.try_emplace(batchKey, batchCount);
+                if (inserted) {
+                    if (batchCount == m_Batches.size()) {
+                        m_Batches.emplace_back();
+                    }
+                    m_Batches[batchCount].SourceModel = object.SourceModel;
+                    m_Batches[batchCount].Lod = object.Lod;
+                    m_Batches[batchCount].Objects.clear();
+                    batchCount++;
+                }
+                lastKey = batchKey;
+                lastBatch = it->second;
+            }
+            m_Batches[lastBatch].Objects.push_back(i);
+        }
+
+        // Shared models get a range of the instance buffer, single entities
+        // an ObjectConstants slot. Indirect draws only read instances.
+        m_SingleObjects.clear();
+        uint32_t instanceCount = 0;
+        for (size_t b = 0; b < batchCount; b++) {
+            ModelBatch& batch = m_Batches[b];
+            if (batch.Objects.size() >= minInstancedBatch) {
+                batch.FirstInstance = instanceCount;
+                instanceCount += static_cast<uint32_t>(batch.Objects.size());
+                m_Stats.InstancedBatches++;
+                m_Stats.Instances += static_cast<uint32_t>(batch.Objects.size());
+            } else {
+                for (uint32_t object : batch.Objects) {
+                    m_SingleObjects.push_back({ object, static_cast<uint32_t>(b) });
+                }
+            }
+        }
+    }
+
+    // The instances are written straight into this frame's region of the
+    // instance stream (GPU-visible memory when it is persistently mapped)
+    DynamicBuffer& instanceStream = Mesh::GetInstanceStream();
+    const uint32_t instanceBytes = m_Stats.Instances * static_cast<uint32_t>(sizeof(InstanceData));
+    instanceStream.BeginFrame(instanceBytes);
+    const DynamicAllocation instanceAllocation = instanceStream.Allocate(instanceBytes);
+    InstanceData* const instances = reinterpret_cast<InstanceData*>(instanceAllocation.Data);
+    const uint32_t streamFirstInstance = instanceAllocation.Offset / static_cast<uint32_t>(sizeof(InstanceData));
+
+    // --- 6. Record the draws ---
+    // Every mesh of a batch becomes one command item, recorded in the list of
+    // the thread that handles it. Instanced batches copy their instances to
+    // their range; single entities fill the ObjectConstants slots reserved
+    // for them.
+    m_ObjectConstants->Reset();
+    const uint32_t firstSlot = m_ObjectConstants->Reserve(static_cast<uint32_t>(m_SingleObjects.size()));
+    {
+        PLUME_PROFILE_SCOPE("Recording");
+        JobSystem::ParallelFor(static_cast<uint32_t>(batchCount), 1, [&](uint32_t begin, uint32_t end) {
+            RecordContext& context = m_RecordContexts[JobSystem::GetThreadIndex()];
+            for (uint32_t b = begin; b < end; b++) {
+                const ModelBatch& batch = m_Batches[b];
+                if (batch.Objects.size() < minInstancedBatch) {
+                    continue;
+                }
+                const uint32_t instanceCount = static_cast<uint32_t>(batch.Objects.size());
+                for (uint32_t n = 0; n < instanceCount; n++) {
+                    instances[batch.FirstInstance + n] = m_ObjectInstances[batch.Objects[n]];
+                }
+                for (const Mesh& mesh : batch.SourceModel->GetMeshes()) {
+                    if (mesh.Geometry) {
+                        context.Triangles += RecordMeshDraw(context.Commands, instancedShader, mesh, batch.Lod, 0.0f, 0, instanceCount, streamFirstInstance + batch.FirstInstance);
+                    }
+                }
+            }
+        });
+
+        JobSystem::ParallelFor(static_cast<uint32_t>(m_SingleObjects.size()), RECORD_GRAIN, [&](uint32_t begin, uint32_t end) {
+            RecordContext& context = m_RecordContexts[JobSystem::GetThreadIndex()];
+            for (uint32_t s = begin; s < end; s++) {
+                const SingleObject& single = m_SingleObjects[s];
+                const ModelBatch& batch = m_Batches[single.Batch];
+                const InstanceData& instance = m_ObjectInstances[single.Object];
+                ObjectConstants object;
+                object.Model = instance.Model;
+                object.NormalMatrix = glm::mat4(instance.NormalMatrix);
+                const uint32_t slot = firstSlot + s;
+                m_ObjectConstants->Write(slot, &object);
+
+                // Squared distance: same order as the distance, without the sqrt
+                const glm::vec3 offset = glm::vec3(instance.Model[3]) - cameraPosition;
+                const float depth = glm::dot(offset, offset);
+                for (const Mesh& mesh : batch.SourceModel->GetMeshes()) {
+                    if (mesh.Geometry) {
+                        context.Triangles += RecordMeshDraw(context.Commands, *m_LitShader, mesh, batch.Lod, depth, slot, 0, 0);
+                    }
+                }
+            }
+        });
+    }
+
+    // --- 7. Merge, sort and replay on this thread ---
+    {
+        PLUME_PROFILE_SCOPE("Merge");
+        m_RenderQueue.Clear();
+        for (const RecordContext& context : m_RecordContexts) {
+            m_RenderQueue.Submit(context.Commands);
+            m_Stats.Triangles += context.Triangles;
+            m_Stats.RecordedCommands += context.Commands.GetCommandCount();
+        }
+        m_RenderQueue.Sort();
+    }
+
+    PLUME_PROFILE_SCOPE("Submit");
+    PLUME_PROFILE_GPU_SCOPE("Scene pass");
+    m_ObjectConstants->Upload();
+    m_Stats.UploadedBytes = m_ObjectConstants->GetSlotCount() * m_ObjectConstants->GetStride();
+    // Nothing to copy when mapped, one orphaning upload otherwise
+    instanceStream.Flush();
+    m_Stats.UploadedBytes += instanceBytes;
+    m_Stats.FenceWaitNs = instanceStream.GetStats().LastFenceWaitNs;
+
+    const std::vector<glm::uvec2>& clusterRanges = m_LightClusters.GetClusterRanges();
+    const std::vector<uint32_t>& lightIndices = m_LightClusters.GetLightIndices();
+    const uint32_t lightBytes = static_cast<uint32_t>(m_LightData.size() * sizeof(glm::vec4));
+    const uint32_t rangeBytes = static_cast<uint32_t>(clusterRanges.size() * sizeof(glm::uvec2));
+    const uint32_t indexBytes = static_cast<uint32_t>(lightIndices.size() * sizeof(uint32_t));
+    m_LightBuffer->SetData(m_LightData.data(), lightBytes);
+    m_ClusterRangeBuffer->SetData(clusterRanges.data(), rangeBytes);
+    m_LightIndexBuffer->SetData(lightIndices.data(), indexBytes);
+    m_Stats.UploadedBytes += lightBytes + rangeBytes + indexBytes;
+    m_LightBuffer->Bind(static_cast<uint32_t>(TextureUnit::Lights));
+    m_ClusterRangeBuffer->Bind(static_cast<uint32_t>(TextureUnit::ClusterRanges));
+    m_LightIndexBuffer->Bind(static_cast<uint32_t>(TextureUnit::LightIndices));
+
+    glClearColor(0.1f, 0.1f, 0.1f, 1.0f);
+    glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+    if (m_IndirectDraws) {
+        m_RenderQueue.ExecuteIndirect(instanceStream.GetRendererID());
+    } else {
+        m_RenderQueue.Execute(*m_ObjectConstants);
+    }
+    m_Stats.DrawCalls = m_RenderQueue.GetStats().DrawCalls;
+    // The region is reused FRAMES_IN_FLIGHT frames later, once the GPU is past these draws
+    instanceStream.EndFrame();
+}
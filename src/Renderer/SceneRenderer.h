@@ -0,0 +1,129 @@
+// src/Renderer/SceneRenderer.h
+#pragma once
+
+#include "RenderConstants.h"
+#include "Shader.h"
+#include "UniformBuffer.h"
+#include "CommandList.h"
+#include "RenderQueue.h"
+#include "RenderSnapshot.h"
+#include "LightClusters.h"
+#include "Bounds.h"
+#include <entt/entt.hpp>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+class Scene;
+class Camera;
+class Model;
+class TextureBuffer;
+
+struct SceneRendererStats {
+    uint32_t DrawCalls = 0;      // glDrawElements* / glMultiDrawElementsIndirect calls issued last frame
+    uint32_t InstancedBatches = 0; // Models drawn through the instanced path
+    uint32_t Instances = 0;      // Entities drawn through the instanced path
+    uint32_t VisibleObjects = 0; // Entities that passed frustum culling
+    uint32_t CulledObjects = 0;  // Entities rejected by frustum culling
+    uint32_t Triangles = 0;      // Triangles submitted, after LOD selection
+    uint32_t ReducedObjects = 0; // Visible entities drawn below LOD 0
+    uint32_t UploadedBytes = 0;  // Object constants, instances and lights sent to the GPU
+    uint32_t RecordedCommands = 0; // Commands recorded by every thread, before bind elision
+    uint64_t FenceWaitNs = 0;    // CPU blocked until the GPU released the instance stream region
+    uint32_t Lights = 0;
+    uint32_t LightIndices = 0;   // Entries of the light cluster lists (see LightClusters)
+};
+
+// Draws the ModelComponent entities of a Scene with the lit shader.
+// Camera data goes through a per-frame uniform block. Point lights use
+// clustered forward shading: LightClusters sorts them into a grid over the
+// view frustum, and each fragment only shades the lights of its cluster,
+// read from buffer textures. Entities are
+// grouped by Model: a Model used by several entities is drawn with one
+// instanced call per mesh, a Model used once goes through the ring of
+// ObjectConstants slots. Meshes live in shared GeometryArenas, so draws
+// mostly differ by their base vertex and first index. Entities are first
+// frustum culled through the scene BVH, then on their exact BoundsComponent
+// (see Scene::OnUpdate). Each visible entity picks a LOD from its projected
+// size; batches are per Model and level.
+//
+// A frame is drawn from a RenderSnapshot: Extract copies what it needs out
+// of the Scene (it can run on the simulation thread), Render(snapshot) never
+// touches the registry. Culling, instance data and draw recording run on the
+// job system: each thread records its draws into its own CommandList. The
+// calling thread then merges the lists in a RenderQueue, sorted by state, and
+// replays them: it is the only one that talks to GL.
+class SceneRenderer {
+public:
+    SceneRenderer();
+    ~SceneRenderer();
+
+    // Lights, camera and the frustum candidates of the scene BVH with their
+    // world matrix, bounds and LOD, plus the models the scene retired. Runs
+    // on the thread that owns the scene (it updates the LodComponents);
+    // needs no GL.
+    static void Extract(Scene& scene, const Camera& camera, RenderSnapshot& outSnapshot);
+    // Extract and draw in one go, on the GL thread
+    void Render(Scene& scene, const Camera& camera);
+    // Draws a snapshot; reads nothing else from the scene. The caller clears
+    // its RetiredModels afterwards, on this same GL thread.
+    void Render(const RenderSnapshot& snapshot);
+
+    // GPU-driven submission: every entity goes through the instance stream
+    // and the queue issues one glMultiDrawElementsIndirect per program,
+    // texture and arena (see RenderQueue::ExecuteIndirect). Needs GL 4.3;
+    // stays off otherwise.
+    void SetIndirectDraws(bool enabled);
+    bool IsIndirectDrawing() const { return m_IndirectDraws; }
+
+    const SceneRendererStats& GetStats() const { return m_Stats; }
+    // Bind/draw counters of the last frame's queue submission
+    const RenderQueueStats& GetQueueStats() const { return m_RenderQueue.GetStats(); }
+
+private:
+    struct ModelBatch {
+        const Model* SourceModel = nullptr;
+        uint32_t Lod = 0;
+        uint32_t FirstInstance = 0;   // In the frame's instance allocation, for instanced batches
+        std::vector<uint32_t> Objects; // Indices in the snapshot
+    };
+
+    // An entity drawn on its own, with an ObjectConstants slot
+    struct SingleObject {
+        uint32_t Object; // Index in the snapshot
+        uint32_t Batch;
+    };
+
+    // Everything a job system thread writes while recording, padded so that
+    // two threads never share a cache line
+    struct alignas(64) RecordContext {
+        CommandList Commands;
+        uint32_t VisibleObjects = 0;
+        uint32_t ReducedObjects = 0;
+        uint32_t Triangles = 0;
+    };
+
+    std::unique_ptr<Shader> m_LitShader;
+    std::unique_ptr<Shader> m_InstancedShader;
+    std::unique_ptr<Shader> m_IndirectShader; // Built by SetIndirectDraws
+    bool m_IndirectDraws = false;
+    std::unique_ptr<UniformBuffer> m_FrameConstants;
+    std::unique_ptr<UniformRingBuffer> m_ObjectConstants;
+
+    LightClusters m_LightClusters;
+    std::vector<glm::vec4> m_LightData; // Two texels per light, kept for its capacity
+    std::unique_ptr<TextureBuffer> m_LightBuffer;
+    std::unique_ptr<TextureBuffer> m_ClusterRangeBuffer;
+    std::unique_ptr<TextureBuffer> m_LightIndexBuffer;
+
+    // Kept across frames to reuse their capacity
+    RenderSnapshot m_Snapshot; // Used by Render(scene, camera)
+    std::vector<uint8_t> m_Visibility;           // Per snapshot object
+    std::vector<InstanceData> m_ObjectInstances; // Same, filled for the visible ones
+    std::vector<ModelBatch> m_Batches;
+    std::vector<SingleObject> m_SingleObjects;
+    std::unordered_map<uintptr_t, size_t> m_BatchIndices; // Model address | LOD level -> batch
+    std::vector<RecordContext> m_RecordContexts; // One per job system thread
+    RenderQueue m_RenderQueue;
+    SceneRendererStats m_Stats;
+};
\ No newline at end of file
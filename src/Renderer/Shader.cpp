@@ -1,10 +1,24 @@
 // src/Renderer/Shader.cpp
 #include "Shader.h"
+#include "RenderConstants.h"
+#include "GLState.h"
 #include <iostream>
 #include <vector>
 #include <glad/glad.h>
 #include <glm/gtc/type_ptr.hpp>
 
+static void CheckShaderStatus(uint32_t shader, const char* stage) {
+    GLint success = GL_FALSE;
+    glGetShaderiv(shader, GL_COMPILE_STATUS, &success);
+    if (success == GL_FALSE) {
+        GLint length = 0;
+        glGetShaderiv(shader, GL_INFO_LOG_LENGTH, &length);
+        std::vector<char> log(length > 0 ? length : 1, '\0');
+        glGetShaderInfoLog(shader, static_cast<GLsizei>(log.size()), nullptr, log.data());
+        std::cerr << "Shader: " << stage << " compilation failed:\n" << log.data() << std::endl;
+    }
+}
+
 Shader::Shader(const std::string& vertexSrc, const std::string& fragmentSrc) {
     // ... (code de compilation des shaders)
     const char* vertexSource = vertexSrc.c_str();
@@ -12,32 +26,116 @@ Shader::Shader(const std::string& vertexSrc, const std::string& fragmentSrc) {
     unsigned int vertexShader = glCreateShader(GL_VERTEX_SHADER);
     glShaderSource(vertexShader, 1, &vertexSource, NULL);
     glCompileShader(vertexShader);
+    CheckShaderStatus(vertexShader, "vertex");
     unsigned int fragmentShader = glCreateShader(GL_FRAGMENT_SHADER);
     glShaderSource(fragmentShader, 1, &fragmentSource, NULL);
     glCompileShader(fragmentShader);
+    CheckShaderStatus(fragmentShader, "fragment");
     m_RendererID = glCreateProgram();
     glAttachShader(m_RendererID, vertexShader);
     glAttachShader(m_RendererID, fragmentShader);
     glLinkProgram(m_RendererID);
     glDeleteShader(vertexShader);
     glDeleteShader(fragmentShader);
+
+    GLint linked = GL_FALSE;
+    glGetProgramiv(m_RendererID, GL_LINK_STATUS, &linked);
+    if (linked == GL_FALSE) {
+        GLint length = 0;
+        glGetProgramiv(m_RendererID, GL_INFO_LOG_LENGTH, &length);
+        std::vector<char> log(length > 0 ? length : 1, '\0');
+        glGetProgramInfoLog(m_RendererID, static_cast<GLsizei>(log.size()), nullptr, log.data());
+        std::cerr << "Shader: link failed:\n" << log.data() << std::endl;
+        return;
+    }
+    Reflect();
 }
 
-Shader::~Shader() { glDeleteProgram(m_RendererID); }
-void Shader::Bind() const { glUseProgram(m_RendererID); }
-void Shader::Unbind() const { glUseProgram(0); }
+Shader::~Shader() { GLState::DeleteProgram(m_RendererID); }
+void Shader::Bind() const { GLState::UseProgram(m_RendererID); }
+void Shader::Unbind() const { GLState::UseProgram(0); }
+
+void Shader::Reflect() {
+    // --- Plain uniforms (block members are skipped, they live in buffers) ---
+    GLint uniformCount = 0, maxNameLength = 0;
+    glGetProgramiv(m_RendererID, GL_ACTIVE_UNIFORMS, &uniformCount);
+    glGetProgramiv(m_RendererID, GL_ACTIVE_UNIFORM_MAX_LENGTH, &maxNameLength);
+    std::vector<char> name(maxNameLength > 0 ? maxNameLength : 1);
+    for (GLint i = 0; i < uniformCount; i++) {
+        GLuint index = static_cast<GLuint>(i);
+        GLint blockIndex = -1;
+        glGetActiveUniformsiv(m_RendererID, 1, &index, GL_UNIFORM_BLOCK_INDEX, &blockIndex);
+        if (blockIndex != -1) {
+            continue;
+        }
+
+        GLsizei length = 0;
+        GLint size = 0;
+        GLenum type = 0;
+        glGetActiveUniform(m_RendererID, index, static_cast<GLsizei>(name.size()), &length, &size, &type, name.data());
+        std::string uniformName(name.data(), length);
+        // Arrays are reported as "u_Name[0]": register the bare name as well
+        size_t bracket = uniformName.find('[');
+        GLint location = glGetUniformLocation(m_RendererID, uniformName.c_str());
+        if (bracket != std::string::npos) {
+            m_UniformLocations[uniformName.substr(0, bracket)] = location;
+        }
+        m_UniformLocations[uniformName] = location;
+    }
+
+    // --- Uniform blocks: assign the engine-wide binding points ---
+    GLint blockCount = 0, maxBlockNameLength = 0;
+    glGetProgramiv(m_RendererID, GL_ACTIVE_UNIFORM_BLOCKS, &blockCount);
+    glGetProgramiv(m_RendererID, GL_ACTIVE_UNIFORM_BLOCK_MAX_NAME_LENGTH, &maxBlockNameLength);
+    std::vector<char> blockName(maxBlockNameLength > 0 ? maxBlockNameLength : 1);
+    for (GLint i = 0; i < blockCount; i++) {
+        GLsizei length = 0;
+        glGetActiveUniformBlockName(m_RendererID, static_cast<GLuint>(i), static_cast<GLsizei>(blockName.size()), &length, blockName.data());
+        std::string nameString(blockName.data(), length);
+
+        int binding = GetUniformBlockBinding(nameString);
+        if (binding < 0) {
+            std::cerr << "Shader: unknown uniform block '" << nameString << "'" << std::endl;
+            continue;
+        }
+        glUniformBlockBinding(m_RendererID, static_cast<GLuint>(i), static_cast<GLuint>(binding));
+        m_UniformBlocks[nameString] = static_cast<uint32_t>(binding);
+    }
+}
+
+int Shader::GetUniformLocation(const std::string& name) const {
+    auto it = m_UniformLocations.find(name);
+    return it != m_UniformLocations.end() ? it->second : -1;
+}
+
+bool Shader::HasUniformBlock(const std::string& name) const {
+    return m_UniformBlocks.find(name) != m_UniformBlocks.end();
+}
 
 void Shader::UploadUniformMat4(const std::string& name, const glm::mat4& matrix) {
-    GLint location = glGetUniformLocation(m_RendererID, name.c_str());
-    glUniformMatrix4fv(location, 1, GL_FALSE, glm::value_ptr(matrix));
+    UploadUniformMat4(GetUniformLocation(name), matrix);
 }
 
 void Shader::UploadUniformVec3(const std::string& name, const glm::vec3& vector) {
-    GLint location = glGetUniformLocation(m_RendererID, name.c_str());
-    glUniform3fv(location, 1, glm::value_ptr(vector));
+    UploadUniformVec3(GetUniformLocation(name), vector);
 }
 
 void Shader::SetInt(const std::string& name, int value) {
-    GLint location = glGetUniformLocation(m_RendererID, name.c_str());
+    SetInt(GetUniformLocation(name), value);
+}
+
+void Shader::UploadUniformMat4(int location, const glm::mat4& matrix) {
+    glUniformMatrix4fv(location, 1, GL_FALSE, glm::value_ptr(matrix));
+}
+
+void Shader::UploadUniformVec3(int location, const glm::vec3& vector) {
+    glUniform3fv(location, 1, glm::value_ptr(vector));
+}
+
+void Shader::UploadUniformVec4Array(int location, const glm::vec4* vectors, uint32_t count) {
+    glUniform4fv(location, static_cast<GLsizei>(count), glm::value_ptr(vectors[0]));
+}
+
+void Shader::SetInt(int location, int value) {
     glUniform1i(location, value);
-}
\ No newline at end of file
+}
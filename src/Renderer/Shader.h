@@ -1,7 +1,9 @@
 // src/Renderer/Shader.h
 #pragma once
 
+#include <cstdint>
 #include <string>
+#include <unordered_map>
 #include <glm/glm.hpp>
 
 class Shader {
@@ -11,11 +13,28 @@ public:
 
     void Bind() const;
     void Unbind() const;
-    
+
+    // Locations are reflected once at link time: these lookups never reach GL.
+    // Returns -1 for unknown (or optimized-out) uniforms.
+    int GetUniformLocation(const std::string& name) const;
+    bool HasUniformBlock(const std::string& name) const;
+
     void UploadUniformMat4(const std::string& name, const glm::mat4& matrix);
     void UploadUniformVec3(const std::string& name, const glm::vec3& vector);
     void SetInt(const std::string& name, int value);
 
+    // Hot-path variants taking a location resolved with GetUniformLocation()
+    void UploadUniformMat4(int location, const glm::mat4& matrix);
+    void UploadUniformVec3(int location, const glm::vec3& vector);
+    void UploadUniformVec4Array(int location, const glm::vec4* vectors, uint32_t count);
+    void SetInt(int location, int value);
+
+    uint32_t GetRendererID() const { return m_RendererID; }
+
 private:
+    void Reflect();
+
     uint32_t m_RendererID;
-};
\ No newline at end of file
+    std::unordered_map<std::string, int> m_UniformLocations;
+    std::unordered_map<std::string, uint32_t> m_UniformBlocks; // name -> binding point
+};
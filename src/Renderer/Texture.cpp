@@ -1,5 +1,6 @@
 // src/Renderer/Texture.cpp
 #include "Texture.h"
+#include "GLState.h"
 #include <glad/glad.h>
 #include <iostream>
 
@@ -7,9 +8,27 @@
 #define STB_IMAGE_IMPLEMENTATION
 #include <stb_image.h>
 
-Texture::Texture(const std::string& path)
+// 1x1 white texture bound in place of textures that are still streaming in
+static uint32_t GetPlaceholderTexture() {
+    static uint32_t placeholderID = 0;
+    if (placeholderID == 0) {
+        const unsigned char white[4] = { 255, 255, 255, 255 };
+        glGenTextures(1, &placeholderID);
+        GLState::BindTexture(0, GL_TEXTURE_2D, placeholderID);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+        glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, 1, 1, 0, GL_RGBA, GL_UNSIGNED_BYTE, white);
+    }
+    return placeholderID;
+}
+
+Texture::Texture(const std::string& path, TextureLoadMode mode)
     : m_RendererID(0), m_FilePath(path), m_Width(0), m_Height(0), m_BPP(0) {
 
+    if (mode == TextureLoadMode::Streamed) {
+        return; // TextureStreamer takes it from here
+    }
+
     // stb_image charge les images depuis le coin supérieur gauche, OpenGL les attend depuis le coin inférieur gauche.
     // On doit donc inverser l'image verticalement lors du chargement.
     stbi_set_flip_vertically_on_load(1);
@@ -18,7 +37,7 @@ Texture::Texture(const std::string& path)
 
     if (localBuffer) {
         glGenTextures(1, &m_RendererID);
-        glBindTexture(GL_TEXTURE_2D, m_RendererID);
+        GLState::BindTexture(0, GL_TEXTURE_2D, m_RendererID);
 
         // Définir les paramètres de la texture (filtrage et wrapping)
         glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
@@ -32,20 +51,26 @@ Texture::Texture(const std::string& path)
 
         // Libérer la mémoire de l'image une fois qu'elle est sur le GPU
         stbi_image_free(localBuffer);
+        m_Resident = true;
     } else {
         std::cerr << "Erreur: Impossible de charger la texture: " << path << std::endl;
     }
 }
 
 Texture::~Texture() {
-    glDeleteTextures(1, &m_RendererID);
+    if (m_RendererID != 0) {
+        GLState::DeleteTexture(m_RendererID);
+    }
 }
 
 void Texture::Bind(uint32_t slot) const {
-    glActiveTexture(GL_TEXTURE0 + slot);
-    glBindTexture(GL_TEXTURE_2D, m_RendererID);
+    GLState::BindTexture(slot, GL_TEXTURE_2D, m_Resident ? m_RendererID : GetPlaceholderTexture());
+}
+
+uint32_t Texture::GetRendererID() const {
+    return m_Resident ? m_RendererID : GetPlaceholderTexture();
 }
 
 void Texture::Unbind() const {
-    glBindTexture(GL_TEXTURE_2D, 0);
+    GLState::BindTexture(0, GL_TEXTURE_2D, 0);
 }
\ No newline at end of file
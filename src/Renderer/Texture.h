@@ -1,22 +1,46 @@
 // src/Renderer/Texture.h
 #pragma once
 
+#include "MemoryUsage.h"
 #include <string>
 #include <cstdint>
 
+enum class TextureLoadMode {
+    Synchronous, // Decode + upload in the constructor
+    Streamed     // Decoded on a worker, uploaded by TextureStreamer over several frames
+};
+
 class Texture {
 public:
-    Texture(const std::string& path);
+    Texture(const std::string& path, TextureLoadMode mode = TextureLoadMode::Synchronous);
     ~Texture();
 
+    // Binds a placeholder until the texture is resident
     void Bind(uint32_t slot = 0) const;
     void Unbind() const;
 
     int GetWidth() const { return m_Width; }
     int GetHeight() const { return m_Height; }
+    const std::string& GetPath() const { return m_FilePath; }
+
+    bool IsResident() const { return m_Resident; }
+    // GL name that Bind() currently binds (the placeholder until resident)
+    uint32_t GetRendererID() const;
+    // Estimated VRAM footprint (RGBA8 + full mip chain)
+    uint64_t GetSizeInBytes() const { return static_cast<uint64_t>(m_Width) * m_Height * 4 * 4 / 3; }
+    // GPU storage once resident. Pixels never stay on the CPU: decoded images
+    // waiting for their upload are counted by TextureStreamer (PendingUploadBytes).
+    MemoryUsage GetMemoryUsage() const {
+        MemoryUsage usage;
+        usage.GpuBytes = m_Resident ? GetSizeInBytes() : 0;
+        return usage;
+    }
 
 private:
+    friend class TextureStreamer;
+
     uint32_t m_RendererID;
     std::string m_FilePath;
     int m_Width, m_Height, m_BPP; // Bits Per Pixel
-};
\ No newline at end of file
+    bool m_Resident = false;
+};
@@ -0,0 +1,39 @@
+// src/Renderer/TextureBuffer.cpp
+#include "TextureBuffer.h"
+#include "GLState.h"
+#include <glad/glad.h>
+#include <algorithm>
+
+// Never zero-sized: a buffer texture needs some storage to point at
+static constexpr uint32_t MIN_CAPACITY = 256;
+
+TextureBuffer::TextureBuffer(uint32_t internalFormat) : m_Capacity(MIN_CAPACITY) {
+    glGenBuffers(1, &m_BufferID);
+    GLState::BindBuffer(GL_TEXTURE_BUFFER, m_BufferID);
+    glBufferData(GL_TEXTURE_BUFFER, m_Capacity, nullptr, GL_STREAM_DRAW);
+
+    // The texture follows the buffer object, whatever storage it gets later
+    glGenTextures(1, &m_TextureID);
+    GLState::BindTexture(0, GL_TEXTURE_BUFFER, m_TextureID);
+    glTexBuffer(GL_TEXTURE_BUFFER, internalFormat, m_BufferID);
+}
+
+TextureBuffer::~TextureBuffer() {
+    GLState::DeleteTexture(m_TextureID);
+    GLState::DeleteBuffer(m_BufferID);
+}
+
+void TextureBuffer::SetData(const void* data, uint32_t size) {
+    GLState::BindBuffer(GL_TEXTURE_BUFFER, m_BufferID);
+    if (size > m_Capacity) {
+        m_Capacity = std::max(size, m_Capacity * 2);
+    }
+    glBufferData(GL_TEXTURE_BUFFER, m_Capacity, nullptr, GL_STREAM_DRAW);
+    if (size > 0) {
+        glBufferSubData(GL_TEXTURE_BUFFER, 0, size, data);
+    }
+}
+
+void TextureBuffer::Bind(uint32_t slot) const {
+    GLState::BindTexture(slot, GL_TEXTURE_BUFFER, m_TextureID);
+}
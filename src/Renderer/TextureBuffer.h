@@ -0,0 +1,31 @@
+// src/Renderer/TextureBuffer.h
+#pragma once
+
+#include <cstdint>
+
+// Buffer texture (GL_TEXTURE_BUFFER): an array of texels sized by the data,
+// read in shaders with texelFetch on a samplerBuffer / usamplerBuffer. Core
+// since GL 3.1, so large per-frame arrays (the clustered lights) need no
+// storage buffer.
+class TextureBuffer {
+public:
+    // `internalFormat`: texel format of the data, e.g. GL_RGBA32F or GL_R32UI
+    explicit TextureBuffer(uint32_t internalFormat);
+    ~TextureBuffer();
+
+    TextureBuffer(const TextureBuffer&) = delete;
+    TextureBuffer& operator=(const TextureBuffer&) = delete;
+
+    // Replaces the whole content, orphaning the previous storage (grown
+    // geometrically when too small, as VertexBuffer::SetData)
+    void SetData(const void* data, uint32_t size);
+    void Bind(uint32_t slot) const;
+
+    uint32_t GetRendererID() const { return m_TextureID; }
+    uint32_t GetCapacity() const { return m_Capacity; }
+
+private:
+    uint32_t m_BufferID = 0;
+    uint32_t m_TextureID = 0;
+    uint32_t m_Capacity; // Bytes allocated on the GPU
+};
@@ -0,0 +1,163 @@
+// src/Renderer/TextureCache.cpp
+#include "TextureCache.h"
+#include "TextureStreamer.h"
+#include "../Core/Hash.h"
+#include <algorithm>
+#include <atomic>
+#include <filesystem>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace fs = std::filesystem;
+
+// What we last saw on disk for a canonical path: the content hash is only
+// recomputed when the file size or modification time changes.
+struct TexturePathEntry {
+    fs::file_time_type WriteTime;
+    uintmax_t Size = 0;
+    uint64_t ContentHash = 0;
+};
+
+// One shared texture, and the canonical paths that resolved to it (forgotten
+// with it)
+struct TextureEntry {
+    std::weak_ptr<Texture> Instance;
+    std::vector<std::string> Paths;
+};
+
+static std::mutex s_Mutex;
+static std::unordered_map<std::string, TexturePathEntry> s_Paths;
+static std::unordered_map<uint64_t, TextureEntry> s_Textures;
+
+static std::atomic<uint64_t> s_Hits{ 0 };
+static std::atomic<uint64_t> s_Misses{ 0 };
+static std::atomic<uint64_t> s_ResidentBytes{ 0 };
+static std::atomic<uint32_t> s_ResidentTextures{ 0 };
+
+static void AddResident(const Texture& texture) {
+    s_ResidentBytes.fetch_add(texture.GetSizeInBytes());
+    s_ResidentTextures.fetch_add(1);
+}
+
+// Runs where the last reference goes away (the GL thread, see
+// RenderSnapshot::RetiredModels). `Cached` is false for unreadable files,
+// which never got an entry.
+struct TextureDeleter {
+    uint64_t ContentHash = 0;
+    bool Cached = false;
+
+    void operator()(Texture* texture) const {
+        if (texture->IsResident()) {
+            s_ResidentBytes.fetch_sub(texture->GetSizeInBytes());
+            s_ResidentTextures.fetch_sub(1);
+        }
+        if (Cached) {
+            std::lock_guard<std::mutex> lock(s_Mutex);
+            auto it = s_Textures.find(ContentHash);
+            // A Load may have found the entry expired and refilled it already
+            if (it != s_Textures.end() && it->second.Instance.expired()) {
+                for (const std::string& path : it->second.Paths) {
+                    auto pathIt = s_Paths.find(path);
+                    if (pathIt != s_Paths.end() && pathIt->second.ContentHash == ContentHash) {
+                        s_Paths.erase(pathIt);
+                    }
+                }
+                s_Textures.erase(it);
+            }
+        }
+        delete texture;
+    }
+};
+
+static std::string CanonicalPath(const std::string& path) {
+    std::error_code error;
+    fs::path canonical = fs::weakly_canonical(fs::path(path), error);
+    return error ? path : canonical.generic_string();
+}
+
+static bool ResolveContentHash(const std::string& canonicalPath, uint64_t& outHash) {
+    std::error_code error;
+    uintmax_t size = fs::file_size(canonicalPath, error);
+    if (error) {
+        return false;
+    }
+    fs::file_time_type writeTime = fs::last_write_time(canonicalPath, error);
+    if (error) {
+        return false;
+    }
+
+    auto it = s_Paths.find(canonicalPath);
+    if (it != s_Paths.end() && it->second.Size == size && it->second.WriteTime == writeTime) {
+        outHash = it->second.ContentHash;
+        return true;
+    }
+
+    uint64_t hash = 0;
+    if (!HashFile(canonicalPath, hash)) {
+        return false;
+    }
+    s_Paths[canonicalPath] = { writeTime, size, hash };
+    outHash = hash;
+    return true;
+}
+
+static std::shared_ptr<Texture> CreateTexture(const std::string& path, TextureLoadMode mode, const TextureDeleter& deleter) {
+    if (mode == TextureLoadMode::Streamed && TextureStreamer::IsInitialized()) {
+        std::shared_ptr<Texture> texture(new Texture(path, TextureLoadMode::Streamed), deleter);
+        TextureStreamer::Request(texture);
+        return texture;
+    }
+    std::shared_ptr<Texture> texture(new Texture(path, TextureLoadMode::Synchronous), deleter);
+    if (texture->IsResident()) {
+        AddResident(*texture);
+    }
+    return texture;
+}
+
+std::shared_ptr<Texture> TextureCache::Load(const std::string& path, TextureLoadMode mode) {
+    std::lock_guard<std::mutex> lock(s_Mutex);
+
+    const std::string canonicalPath = CanonicalPath(path);
+    uint64_t contentHash = 0;
+    if (!ResolveContentHash(canonicalPath, contentHash)) {
+        // Unreadable file: let Texture report the error, nothing to share
+        s_Misses.fetch_add(1);
+        return CreateTexture(path, mode, TextureDeleter{ 0, false });
+    }
+
+    TextureEntry& entry = s_Textures[contentHash];
+    if (std::find(entry.Paths.begin(), entry.Paths.end(), canonicalPath) == entry.Paths.end()) {
+        entry.Paths.push_back(canonicalPath);
+    }
+    if (std::shared_ptr<Texture> texture = entry.Instance.lock()) {
+        s_Hits.fetch_add(1);
+        return texture;
+    }
+
+    // New, or released and its deleter not done yet: the entry is reused,
+    // the deleter leaves a live entry alone
+    s_Misses.fetch_add(1);
+    std::shared_ptr<Texture> texture = CreateTexture(path, mode, TextureDeleter{ contentHash, true });
+    entry.Instance = texture;
+    return texture;
+}
+
+TextureCacheStats TextureCache::GetStats() {
+    TextureCacheStats stats;
+    stats.Hits = s_Hits.load();
+    stats.Misses = s_Misses.load();
+    // Streamed textures only count once their upload has completed
+    stats.ResidentBytes = s_ResidentBytes.load();
+    stats.ResidentTextures = s_ResidentTextures.load();
+    return stats;
+}
+
+void TextureCache::ResetCounters() {
+    s_Hits.store(0);
+    s_Misses.store(0);
+}
+
+void TextureCache::OnTextureResident(const Texture& texture) {
+    AddResident(texture);
+}
@@ -0,0 +1,37 @@
+// src/Renderer/TextureCache.h
+#pragma once
+
+#include "Texture.h"
+#include <cstdint>
+#include <memory>
+#include <string>
+
+struct TextureCacheStats {
+    uint64_t Hits = 0;
+    uint64_t Misses = 0;
+    uint64_t ResidentBytes = 0;    // Estimated VRAM of the textures currently alive
+    uint32_t ResidentTextures = 0;
+};
+
+// Engine-wide texture cache shared by every Model.
+// Entries are keyed by the content hash of the image file (resolved through its
+// canonical path), so two paths to identical files share one GPU texture.
+// The cache only keeps weak references: a texture is released as soon as the
+// last mesh using it goes away. Its deleter then forgets the entry and the
+// paths that led to it, and updates the resident figures, so the cache never
+// outgrows the textures alive.
+class TextureCache {
+public:
+    // Returns the texture for `path`. The image is decoded and uploaded only
+    // when no live texture with the same content exists. Streamed requests fall
+    // back to a synchronous load while the TextureStreamer is not running.
+    static std::shared_ptr<Texture> Load(const std::string& path, TextureLoadMode mode = TextureLoadMode::Synchronous);
+
+    // Counters only: never touches the textures
+    static TextureCacheStats GetStats();
+    // Resets the hit/miss counters (resident figures are left untouched)
+    static void ResetCounters();
+
+    // A streamed texture finished its upload (TextureStreamer, GL thread)
+    static void OnTextureResident(const Texture& texture);
+};
@@ -0,0 +1,222 @@
+// src/Renderer/TextureStreamer.cpp
+#include "TextureStreamer.h"
+#include "TextureCache.h"
+#include "GLState.h"
+#include "GpuProfiler.h"
+#include "../Core/JobSystem.h"
+#include <glad/glad.h>
+#include <stb_image.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <deque>
+#include <iostream>
+#include <mutex>
+
+// A decoded image waiting to be copied to its texture
+struct DecodedImage {
+    std::weak_ptr<Texture> Target;
+    unsigned char* Pixels = nullptr; // RGBA8, rows already flipped for GL
+    int Width = 0;
+    int Height = 0;
+    int RowsUploaded = 0;
+};
+
+static constexpr int STREAMER_PBO_COUNT = 3;
+
+static bool s_Initialized = false;
+static uint64_t s_BytesPerFrame = 0;
+static double s_MaxMillisecondsPerFrame = 0.0;
+
+static std::mutex s_ReadyMutex;
+static std::deque<DecodedImage> s_Ready; // Filled by the workers, drained by Update()
+static std::atomic<uint32_t> s_PendingDecodes{ 0 };
+static JobCounter* s_DecodeCounter = nullptr;
+
+static uint32_t s_PixelBuffers[STREAMER_PBO_COUNT] = {};
+static uint32_t s_NextPixelBuffer = 0;
+
+static uint64_t s_UploadedBytesLastFrame = 0;
+static double s_UploadMsLastFrame = 0.0;
+static uint64_t s_TotalUploadedBytes = 0;
+
+void TextureStreamer::Init(uint64_t bytesPerFrame, double maxMillisecondsPerFrame) {
+    if (s_Initialized) {
+        return;
+    }
+    SetFrameBudget(bytesPerFrame, maxMillisecondsPerFrame);
+    glGenBuffers(STREAMER_PBO_COUNT, s_PixelBuffers);
+    s_DecodeCounter = new JobCounter();
+    s_Initialized = true;
+}
+
+void TextureStreamer::Shutdown() {
+    if (!s_Initialized) {
+        return;
+    }
+    JobSystem::Wait(*s_DecodeCounter);
+    delete s_DecodeCounter;
+    s_DecodeCounter = nullptr;
+
+    for (DecodedImage& image : s_Ready) {
+        stbi_image_free(image.Pixels);
+    }
+    s_Ready.clear();
+    for (uint32_t pixelBuffer : s_PixelBuffers) {
+        GLState::DeleteBuffer(pixelBuffer);
+    }
+    std::fill(std::begin(s_PixelBuffers), std::end(s_PixelBuffers), 0u);
+    s_Initialized = false;
+}
+
+bool TextureStreamer::IsInitialized() {
+    return s_Initialized;
+}
+
+void TextureStreamer::SetFrameBudget(uint64_t bytesPerFrame, double maxMillisecondsPerFrame) {
+    s_BytesPerFrame = std::max<uint64_t>(bytesPerFrame, 1);
+    s_MaxMillisecondsPerFrame = maxMillisecondsPerFrame;
+}
+
+void TextureStreamer::Request(const std::shared_ptr<Texture>& texture) {
+    std::weak_ptr<Texture> target = texture;
+    std::string path = texture->GetPath();
+
+    s_PendingDecodes.fetch_add(1);
+    JobSystem::Run([target, path]() {
+        // Flip per thread: the global stb flag belongs to the main thread
+        stbi_set_flip_vertically_on_load_thread(1);
+        DecodedImage image;
+        image.Target = target;
+        int channels = 0;
+        image.Pixels = stbi_load(path.c_str(), &image.Width, &image.Height, &channels, 4);
+        if (!image.Pixels) {
+            std::cerr << "Erreur: Impossible de charger la texture: " << path << std::endl;
+        } else {
+            std::lock_guard<std::mutex> lock(s_ReadyMutex);
+            s_Ready.push_back(image);
+        }
+        s_PendingDecodes.fetch_sub(1);
+    }, s_DecodeCounter);
+}
+
+void TextureStreamer::Update() {
+    PLUME_PROFILE_SCOPE("TextureStreamer::Update");
+    PLUME_PROFILE_GPU_SCOPE("Texture uploads");
+    using Clock = std::chrono::steady_clock;
+    const auto start = Clock::now();
+    auto elapsedMs = [&start]() { return std::chrono::duration<double, std::milli>(Clock::now() - start).count(); };
+
+    uint64_t uploadedBytes = 0;
+    while (uploadedBytes < s_BytesPerFrame) {
+        // The front image stays in the queue until its last row is uploaded
+        DecodedImage* image = nullptr;
+        {
+            std::lock_guard<std::mutex> lock(s_ReadyMutex);
+            if (s_Ready.empty()) {
+                break;
+            }
+            image = &s_Ready.front();
+        }
+
+        std::shared_ptr<Texture> texture = image->Target.lock();
+        if (texture) {
+            const uint64_t rowPitch = static_cast<uint64_t>(image->Width) * 4;
+            // Always make progress by at least one row, even with a tiny budget
+            uint64_t budgetRows = std::max<uint64_t>(1, (s_BytesPerFrame - uploadedBytes) / rowPitch);
+            int rows = static_cast<int>(std::min<uint64_t>(budgetRows, static_cast<uint64_t>(image->Height - image->RowsUploaded)));
+
+            if (image->RowsUploaded == 0) {
+                texture->m_Width = image->Width;
+                texture->m_Height = image->Height;
+                texture->m_BPP = 4;
+            }
+            UploadRows(*texture, image->Pixels, image->RowsUploaded, rows);
+            image->RowsUploaded += rows;
+            uploadedBytes += rowPitch * rows;
+
+            if (image->RowsUploaded < image->Height) {
+                if (elapsedMs() >= s_MaxMillisecondsPerFrame) {
+                    break; // Resume this image next frame
+                }
+                continue;
+            }
+            FinishUpload(*texture);
+        }
+
+        // Done (or the texture was released in the meantime)
+        stbi_image_free(image->Pixels);
+        {
+            std::lock_guard<std::mutex> lock(s_ReadyMutex);
+            s_Ready.pop_front();
+        }
+        if (elapsedMs() >= s_MaxMillisecondsPerFrame) {
+            break;
+        }
+    }
+
+    s_UploadedBytesLastFrame = uploadedBytes;
+    s_UploadMsLastFrame = elapsedMs();
+    s_TotalUploadedBytes += uploadedBytes;
+}
+
+void TextureStreamer::UploadRows(Texture& texture, const unsigned char* pixels, int firstRow, int rowCount) {
+    if (texture.m_RendererID == 0) {
+        glGenTextures(1, &texture.m_RendererID);
+        GLState::BindTexture(0, GL_TEXTURE_2D, texture.m_RendererID);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
+        // Storage only; the rows arrive through the pixel-unpack buffers below
+        glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, texture.m_Width, texture.m_Height, 0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+    } else {
+        GLState::BindTexture(0, GL_TEXTURE_2D, texture.m_RendererID);
+    }
+
+    const size_t rowPitch = static_cast<size_t>(texture.m_Width) * 4;
+    const size_t size = rowPitch * rowCount;
+
+    // Orphan the next PBO so the driver never has to wait for the previous copy
+    uint32_t pixelBuffer = s_PixelBuffers[s_NextPixelBuffer];
+    s_NextPixelBuffer = (s_NextPixelBuffer + 1) % STREAMER_PBO_COUNT;
+    GLState::BindBuffer(GL_PIXEL_UNPACK_BUFFER, pixelBuffer);
+    glBufferData(GL_PIXEL_UNPACK_BUFFER, static_cast<GLsizeiptr>(size), nullptr, GL_STREAM_DRAW);
+    void* destination = glMapBufferRange(GL_PIXEL_UNPACK_BUFFER, 0, static_cast<GLsizeiptr>(size), GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_BUFFER_BIT);
+    if (destination) {
+        std::memcpy(destination, pixels + rowPitch * firstRow, size);
+        glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER);
+        glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+        glTexSubImage2D(GL_TEXTURE_2D, 0, 0, firstRow, texture.m_Width, rowCount, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+    }
+    GLState::BindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+}
+
+void TextureStreamer::FinishUpload(Texture& texture) {
+    GLState::BindTexture(0, GL_TEXTURE_2D, texture.m_RendererID);
+    glGenerateMipmap(GL_TEXTURE_2D);
+    texture.m_Resident = true;
+    TextureCache::OnTextureResident(texture);
+}
+
+bool TextureStreamer::IsIdle() {
+    std::lock_guard<std::mutex> lock(s_ReadyMutex);
+    return s_PendingDecodes.load() == 0 && s_Ready.empty();
+}
+
+TextureStreamerStats TextureStreamer::GetStats() {
+    TextureStreamerStats stats;
+    stats.PendingDecodes = s_PendingDecodes.load();
+    {
+        std::lock_guard<std::mutex> lock(s_ReadyMutex);
+        stats.PendingUploads = static_cast<uint32_t>(s_Ready.size());
+        for (const DecodedImage& image : s_Ready) {
+            stats.PendingUploadBytes += static_cast<uint64_t>(image.Width) * image.Height * 4;
+        }
+    }
+    stats.UploadedBytesLastFrame = s_UploadedBytesLastFrame;
+    stats.UploadMsLastFrame = s_UploadMsLastFrame;
+    stats.TotalUploadedBytes = s_TotalUploadedBytes;
+    return stats;
+}
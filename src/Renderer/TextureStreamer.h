@@ -0,0 +1,44 @@
+// src/Renderer/TextureStreamer.h
+#pragma once
+
+#include "Texture.h"
+#include <cstdint>
+#include <memory>
+
+struct TextureStreamerStats {
+    uint32_t PendingDecodes = 0;       // Queued on the JobSystem or decoding
+    uint32_t PendingUploads = 0;       // Decoded, waiting for (or in the middle of) their upload
+    uint64_t PendingUploadBytes = 0;   // CPU memory held by those decoded images
+    uint64_t UploadedBytesLastFrame = 0;
+    double   UploadMsLastFrame = 0.0;
+    uint64_t TotalUploadedBytes = 0;
+};
+
+// Asynchronous texture pipeline.
+// Images are decoded on the JobSystem workers. Update() then copies them to the
+// GPU on the GL thread through pixel-unpack buffers, a band of rows at a time,
+// and stops once the per-frame byte or time budget is spent. Until its last row
+// is uploaded a texture binds a placeholder (see Texture::Bind).
+class TextureStreamer {
+public:
+    static void Init(uint64_t bytesPerFrame = 4 * 1024 * 1024, double maxMillisecondsPerFrame = 2.0);
+    // Waits for in-flight decodes and releases the GL objects (GL thread)
+    static void Shutdown();
+    static bool IsInitialized();
+
+    // Upload budget per Update() call. The time limit is the frame-hitch threshold.
+    static void SetFrameBudget(uint64_t bytesPerFrame, double maxMillisecondsPerFrame);
+
+    // Queues the decode of a texture created with TextureLoadMode::Streamed
+    static void Request(const std::shared_ptr<Texture>& texture);
+
+    // Uploads decoded images within the frame budget. Call once per frame on the GL thread.
+    static void Update();
+
+    static bool IsIdle();
+    static TextureStreamerStats GetStats();
+
+private:
+    static void UploadRows(Texture& texture, const unsigned char* pixels, int firstRow, int rowCount);
+    static void FinishUpload(Texture& texture);
+};
@@ -0,0 +1,85 @@
+// src/Renderer/UniformBuffer.cpp
+#include "UniformBuffer.h"
+#include "GLState.h"
+#include <glad/glad.h>
+#include <algorithm>
+#include <cstring>
+
+// --- UniformBuffer ---
+UniformBuffer::UniformBuffer(uint32_t size, uint32_t binding) : m_Size(size), m_Binding(binding) {
+    glGenBuffers(1, &m_RendererID);
+    GLState::BindBuffer(GL_UNIFORM_BUFFER, m_RendererID);
+    glBufferData(GL_UNIFORM_BUFFER, size, nullptr, GL_DYNAMIC_DRAW);
+    GLState::BindBufferBase(GL_UNIFORM_BUFFER, m_Binding, m_RendererID);
+}
+
+UniformBuffer::~UniformBuffer() {
+    GLState::DeleteBuffer(m_RendererID);
+}
+
+void UniformBuffer::SetData(const void* data, uint32_t size, uint32_t offset) {
+    GLState::BindBuffer(GL_UNIFORM_BUFFER, m_RendererID);
+    glBufferSubData(GL_UNIFORM_BUFFER, offset, size, data);
+}
+
+// --- UniformRingBuffer ---
+UniformRingBuffer::UniformRingBuffer(uint32_t slotSize, uint32_t initialSlotCount, uint32_t binding)
+    : m_SlotSize(slotSize), m_Binding(binding), m_Capacity(std::max(1u, initialSlotCount)) {
+    GLint alignment = 256;
+    glGetIntegerv(GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT, &alignment);
+    uint32_t align = static_cast<uint32_t>(std::max(alignment, 1));
+    m_Stride = (slotSize + align - 1) / align * align;
+
+    glGenBuffers(1, &m_RendererID);
+    GLState::BindBuffer(GL_UNIFORM_BUFFER, m_RendererID);
+    glBufferData(GL_UNIFORM_BUFFER, static_cast<GLsizeiptr>(m_Capacity) * m_Stride, nullptr, GL_STREAM_DRAW);
+    m_Staging.resize(static_cast<size_t>(m_Capacity) * m_Stride);
+}
+
+UniformRingBuffer::~UniformRingBuffer() {
+    GLState::DeleteBuffer(m_RendererID);
+}
+
+void UniformRingBuffer::Reset() {
+    m_SlotCount = 0;
+}
+
+uint32_t UniformRingBuffer::Push(const void* data) {
+    if (static_cast<size_t>(m_SlotCount + 1) * m_Stride > m_Staging.size()) {
+        m_Staging.resize(m_Staging.size() * 2);
+    }
+    std::memcpy(m_Staging.data() + static_cast<size_t>(m_SlotCount) * m_Stride, data, m_SlotSize);
+    return m_SlotCount++;
+}
+
+uint32_t UniformRingBuffer::Reserve(uint32_t count) {
+    const size_t required = static_cast<size_t>(m_SlotCount + count) * m_Stride;
+    if (required > m_Staging.size()) {
+        m_Staging.resize(std::max(required, m_Staging.size() * 2));
+    }
+    const uint32_t first = m_SlotCount;
+    m_SlotCount += count;
+    return first;
+}
+
+void UniformRingBuffer::Write(uint32_t slot, const void* data) {
+    std::memcpy(m_Staging.data() + static_cast<size_t>(slot) * m_Stride, data, m_SlotSize);
+}
+
+void UniformRingBuffer::Upload() {
+    if (m_SlotCount == 0) {
+        return;
+    }
+    GLState::BindBuffer(GL_UNIFORM_BUFFER, m_RendererID);
+    uint32_t requiredCapacity = static_cast<uint32_t>(m_Staging.size() / m_Stride);
+    if (requiredCapacity > m_Capacity) {
+        m_Capacity = requiredCapacity;
+    }
+    // Orphan the previous frame's storage so this upload never waits on the GPU
+    glBufferData(GL_UNIFORM_BUFFER, static_cast<GLsizeiptr>(m_Capacity) * m_Stride, nullptr, GL_STREAM_DRAW);
+    glBufferSubData(GL_UNIFORM_BUFFER, 0, static_cast<GLsizeiptr>(m_SlotCount) * m_Stride, m_Staging.data());
+}
+
+void UniformRingBuffer::Bind(uint32_t slot) const {
+    GLState::BindBufferRange(GL_UNIFORM_BUFFER, m_Binding, m_RendererID, static_cast<intptr_t>(slot) * m_Stride, m_SlotSize);
+}
@@ -0,0 +1,62 @@
+// src/Renderer/UniformBuffer.h
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+class UniformBuffer {
+public:
+    UniformBuffer(uint32_t size, uint32_t binding);
+    ~UniformBuffer();
+
+    UniformBuffer(const UniformBuffer&) = delete;
+    UniformBuffer& operator=(const UniformBuffer&) = delete;
+
+    void SetData(const void* data, uint32_t size, uint32_t offset = 0);
+
+    uint32_t GetRendererID() const { return m_RendererID; }
+    uint32_t GetBinding() const { return m_Binding; }
+
+private:
+    uint32_t m_RendererID;
+    uint32_t m_Size;
+    uint32_t m_Binding;
+};
+
+// Per-frame ring of uniform blocks (e.g. one ObjectConstants per draw).
+// Slots are written on the CPU with Push(), uploaded in one call with Upload(),
+// then selected per draw with Bind(): no uniform call happens between draws.
+class UniformRingBuffer {
+public:
+    UniformRingBuffer(uint32_t slotSize, uint32_t initialSlotCount, uint32_t binding);
+    ~UniformRingBuffer();
+
+    UniformRingBuffer(const UniformRingBuffer&) = delete;
+    UniformRingBuffer& operator=(const UniformRingBuffer&) = delete;
+
+    // Starts a new frame: previous slots are discarded
+    void Reset();
+    // Copies one block and returns its slot index
+    uint32_t Push(const void* data);
+    // Appends `count` slots and returns the first one. Reserved slots are
+    // then filled with Write, which several threads may call at once as long
+    // as they write different slots (nothing else may run meanwhile).
+    uint32_t Reserve(uint32_t count);
+    void Write(uint32_t slot, const void* data);
+    // Sends every pushed slot to the GPU (orphaning the previous storage)
+    void Upload();
+    // Binds a slot to the ring's binding point
+    void Bind(uint32_t slot) const;
+
+    uint32_t GetSlotCount() const { return m_SlotCount; }
+    uint32_t GetStride() const { return m_Stride; }
+
+private:
+    uint32_t m_RendererID = 0;
+    uint32_t m_SlotSize;
+    uint32_t m_Stride;   // Slot size rounded up to GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT
+    uint32_t m_Binding;
+    uint32_t m_Capacity; // Slots allocated on the GPU
+    uint32_t m_SlotCount = 0;
+    std::vector<uint8_t> m_Staging;
+};
@@ -1,5 +1,6 @@
 // src/Renderer/VertexArray.cpp
 #include "VertexArray.h"
+#include "GLState.h"
 #include <glad/glad.h>
 
 static GLenum ShaderDataTypeToOpenGLBaseType(ShaderDataType type) {
@@ -15,6 +16,14 @@ static GLenum ShaderDataTypeToOpenGLBaseType(ShaderDataType type) {
         case ShaderDataType::Int3:     return GL_INT;
         case ShaderDataType::Int4:     return GL_INT;
         case ShaderDataType::Bool:     return GL_BOOL;
+        case ShaderDataType::Half2:    return GL_HALF_FLOAT;
+        case ShaderDataType::Half4:    return GL_HALF_FLOAT;
+        case ShaderDataType::Short2:   return GL_SHORT;
+        case ShaderDataType::Short4:   return GL_SHORT;
+        case ShaderDataType::UShort2:  return GL_UNSIGNED_SHORT;
+        case ShaderDataType::UShort4:  return GL_UNSIGNED_SHORT;
+        case ShaderDataType::Int1010102: return GL_INT_2_10_10_10_REV;
+        case ShaderDataType::None:     return 0;
     }
     return 0;
 }
@@ -24,41 +33,77 @@ VertexArray::VertexArray() {
 }
 
 VertexArray::~VertexArray() {
-    glDeleteVertexArrays(1, &m_RendererID);
+    GLState::DeleteVertexArray(m_RendererID);
 }
 
 void VertexArray::Bind() const {
-    glBindVertexArray(m_RendererID);
+    GLState::BindVertexArray(m_RendererID);
 }
 
 void VertexArray::Unbind() const {
-    glBindVertexArray(0);
+    GLState::BindVertexArray(0);
 }
 
 void VertexArray::AddVertexBuffer(const std::shared_ptr<VertexBuffer>& vertexBuffer) {
-    glBindVertexArray(m_RendererID);
+    GLState::BindVertexArray(m_RendererID);
     vertexBuffer->Bind();
 
-    const auto& layout = vertexBuffer->GetLayout();
-    uint32_t index = 0;
+    m_FirstAttributes.push_back(m_VertexBufferIndex);
+    m_VertexBufferIndex = SetAttributePointers(vertexBuffer->GetLayout(), m_VertexBufferIndex, 0);
+    m_VertexBuffers.push_back(vertexBuffer);
+}
+
+void VertexArray::SetVertexBufferOffset(size_t bufferIndex, uint32_t byteOffset) {
+    GLState::BindVertexArray(m_RendererID);
+    m_VertexBuffers[bufferIndex]->Bind();
+    SetAttributePointers(m_VertexBuffers[bufferIndex]->GetLayout(), m_FirstAttributes[bufferIndex], byteOffset);
+}
+
+uint32_t VertexArray::SetAttributePointers(const BufferLayout& layout, uint32_t firstAttribute, uint32_t byteOffset) {
+    const uint32_t divisor = layout.GetInstanceDivisor();
+    uint32_t attribute = firstAttribute;
     for (const auto& element : layout.GetElements()) {
-        glEnableVertexAttribArray(index);
-        glVertexAttribPointer(
-            index,
-            element.GetComponentCount(),
-            ShaderDataTypeToOpenGLBaseType(element.Type),
-            element.Normalized ? GL_TRUE : GL_FALSE,
-            layout.GetStride(),
-            (const void*)(intptr_t)element.Offset
-        );
-        index++;
+        switch (element.Type) {
+            case ShaderDataType::Mat3:
+            case ShaderDataType::Mat4: {
+                // A matrix takes one attribute location per column
+                uint32_t count = element.GetComponentCount();
+                for (uint32_t column = 0; column < count; column++) {
+                    glEnableVertexAttribArray(attribute);
+                    glVertexAttribPointer(
+                        attribute,
+                        count,
+                        ShaderDataTypeToOpenGLBaseType(element.Type),
+                        element.Normalized ? GL_TRUE : GL_FALSE,
+                        layout.GetStride(),
+                        (const void*)(intptr_t)(byteOffset + element.Offset + sizeof(float) * count * column)
+                    );
+                    glVertexAttribDivisor(attribute, divisor);
+                    attribute++;
+                }
+                break;
+            }
+            default: {
+                glEnableVertexAttribArray(attribute);
+                glVertexAttribPointer(
+                    attribute,
+                    element.GetComponentCount(),
+                    ShaderDataTypeToOpenGLBaseType(element.Type),
+                    element.Normalized ? GL_TRUE : GL_FALSE,
+                    layout.GetStride(),
+                    (const void*)(intptr_t)(byteOffset + element.Offset)
+                );
+                glVertexAttribDivisor(attribute, divisor);
+                attribute++;
+                break;
+            }
+        }
     }
-
-    m_VertexBuffers.push_back(vertexBuffer);
+    return attribute;
 }
 
 void VertexArray::SetIndexBuffer(const std::shared_ptr<IndexBuffer>& indexBuffer) {
-    glBindVertexArray(m_RendererID);
+    GLState::BindVertexArray(m_RendererID);
     indexBuffer->Bind();
     m_IndexBuffer = indexBuffer;
 }
\ No newline at end of file
@@ -14,13 +14,23 @@ public:
     void Unbind() const;
 
     void AddVertexBuffer(const std::shared_ptr<VertexBuffer>& vertexBuffer);
+    // Re-points the attributes of buffer `bufferIndex` (in AddVertexBuffer order)
+    // `byteOffset` bytes further, e.g. to start an instanced draw at a given
+    // instance without glDrawElementsInstancedBaseInstance (GL 4.2)
+    void SetVertexBufferOffset(size_t bufferIndex, uint32_t byteOffset);
     void SetIndexBuffer(const std::shared_ptr<IndexBuffer>& indexBuffer);
 
     const std::vector<std::shared_ptr<VertexBuffer>>& GetVertexBuffers() const { return m_VertexBuffers; }
     const std::shared_ptr<IndexBuffer>& GetIndexBuffer() const { return m_IndexBuffer; }
+    uint32_t GetRendererID() const { return m_RendererID; }
 
 private:
+    // Sets the attribute pointers of `layout` from location `firstAttribute`; returns the next free location
+    static uint32_t SetAttributePointers(const BufferLayout& layout, uint32_t firstAttribute, uint32_t byteOffset);
+
     uint32_t m_RendererID;
+    uint32_t m_VertexBufferIndex = 0; // Next free attribute location, shared by all buffers
     std::vector<std::shared_ptr<VertexBuffer>> m_VertexBuffers;
+    std::vector<uint32_t> m_FirstAttributes; // First attribute location of each buffer
     std::shared_ptr<IndexBuffer> m_IndexBuffer;
 };
\ No newline at end of file
@@ -3,9 +3,12 @@
 
 #include <glm/glm.hpp>
 #include <glm/gtc/matrix_transform.hpp>
+#include <entt/entt.hpp>
 #include <string>
 #include <memory>
+#include <vector>
 #include "../Renderer/Model/Model.h"
+#include "../Renderer/Bounds.h"
 
 struct TagComponent {
     std::string Tag;
@@ -14,6 +17,10 @@ struct TagComponent {
     TagComponent(const std::string& tag) : Tag(tag) {}
 };
 
+// Local transform, relative to the parent (see RelationshipComponent). The
+// TransformSystem only recomputes entities whose transform was emplaced or
+// patched: change it with Entity::PatchComponent (or registry.patch), never
+// through a plain reference, or the world matrix keeps its old value.
 struct TransformComponent {
     glm::vec3 Translation = { 0.0f, 0.0f, 0.0f };
     glm::vec3 Rotation = { 0.0f, 0.0f, 0.0f };
@@ -31,6 +38,29 @@ struct TransformComponent {
     }
 };
 
+// Parent/children links, maintained by Scene::SetParent
+struct RelationshipComponent {
+    entt::entity Parent = entt::null;
+    std::vector<entt::entity> Children;
+    RelationshipComponent() = default;
+    RelationshipComponent(const RelationshipComponent&) = default;
+};
+
+// Matrices cached by the TransformSystem. Read-only for everything else:
+// modify the TransformComponent through Entity::PatchComponent instead.
+struct WorldTransformComponent {
+    glm::mat4 Local = glm::mat4(1.0f);
+    glm::mat4 World = glm::mat4(1.0f);
+    WorldTransformComponent() = default;
+    WorldTransformComponent(const WorldTransformComponent&) = default;
+};
+
+// Tag: the transform (or its parent link) changed since the last update
+struct TransformDirtyComponent {};
+
+// To change the model of an entity, remove the component and add a new one:
+// the Scene retires the old model on destruction (see Scene::TakeRetiredModels),
+// an assignment would free it on the simulation thread.
 struct ModelComponent {
     std::shared_ptr<Model> model;
     ModelComponent() = default;
@@ -38,10 +68,27 @@ struct ModelComponent {
     ModelComponent(std::shared_ptr<Model> model) : model(model) {}
 };
 
+// World-space bounds of a ModelComponent entity, refreshed by Scene::OnUpdate
+struct BoundsComponent {
+    AABB WorldBounds;
+    int32_t Proxy = -1; // Leaf in the scene's DynamicAABBTree
+    BoundsComponent() = default;
+    BoundsComponent(const BoundsComponent&) = default;
+};
+
+// Level of detail currently drawn for a ModelComponent entity. Kept across
+// frames so the selection can apply hysteresis (see SceneRenderer::Extract).
+struct LodComponent {
+    uint32_t Level = 0;
+    LodComponent() = default;
+    LodComponent(const LodComponent&) = default;
+};
+
 // NOUVEAU : Composant pour une source de lumière
 struct LightComponent {
     glm::vec3 Color = { 1.0f, 1.0f, 1.0f };
     float Intensity = 1.0f;
+    float Range = 10.0f; // Point light: no contribution past this distance
 
     LightComponent() = default;
     LightComponent(const LightComponent&) = default;
@@ -0,0 +1,295 @@
+// src/Scene/DynamicAABBTree.cpp
+#include "DynamicAABBTree.h"
+#include <algorithm>
+
+// Leaves are stored enlarged by this margin (world units)
+static constexpr float FAT_AABB_MARGIN = 0.1f;
+
+DynamicAABBTree::DynamicAABBTree() {
+}
+
+// --- Node pool ---
+
+int32_t DynamicAABBTree::AllocateNode() {
+    if (m_FreeList == NullNode) {
+        m_Nodes.emplace_back();
+        return static_cast<int32_t>(m_Nodes.size() - 1);
+    }
+    int32_t nodeId = m_FreeList;
+    m_FreeList = m_Nodes[nodeId].Parent;
+    m_Nodes[nodeId] = Node();
+    return nodeId;
+}
+
+void DynamicAABBTree::FreeNode(int32_t nodeId) {
+    m_Nodes[nodeId].Parent = m_FreeList;
+    m_Nodes[nodeId].Height = -1;
+    m_FreeList = nodeId;
+}
+
+void DynamicAABBTree::Clear() {
+    m_Nodes.clear();
+    m_Root = NullNode;
+    m_FreeList = NullNode;
+    m_ProxyCount = 0;
+}
+
+// --- Proxies ---
+
+int32_t DynamicAABBTree::CreateProxy(const AABB& box, uint32_t userData) {
+    int32_t proxyId = AllocateNode();
+    Node& node = m_Nodes[proxyId];
+    glm::vec3 margin(FAT_AABB_MARGIN);
+    node.Box = AABB(box.Min - margin, box.Max + margin);
+    node.UserData = userData;
+    node.Height = 0;
+    InsertLeaf(proxyId);
+    m_ProxyCount++;
+    return proxyId;
+}
+
+void DynamicAABBTree::DestroyProxy(int32_t proxyId) {
+    RemoveLeaf(proxyId);
+    FreeNode(proxyId);
+    m_ProxyCount--;
+}
+
+bool DynamicAABBTree::MoveProxy(int32_t proxyId, const AABB& box) {
+    if (Contains(m_Nodes[proxyId].Box, box)) {
+        return false;
+    }
+    RemoveLeaf(proxyId);
+    glm::vec3 margin(FAT_AABB_MARGIN);
+    m_Nodes[proxyId].Box = AABB(box.Min - margin, box.Max + margin);
+    InsertLeaf(proxyId);
+    return true;
+}
+
+// --- Insertion / removal ---
+
+void DynamicAABBTree::InsertLeaf(int32_t leaf) {
+    if (m_Root == NullNode) {
+        m_Root = leaf;
+        m_Nodes[leaf].Parent = NullNode;
+        return;
+    }
+
+    // Find the best sibling, descending with the surface area heuristic
+    const AABB leafBox = m_Nodes[leaf].Box;
+    int32_t index = m_Root;
+    while (!m_Nodes[index].IsLeaf()) {
+        const Node& node = m_Nodes[index];
+        float area = SurfaceArea(node.Box);
+        float combinedArea = SurfaceArea(Union(node.Box, leafBox));
+
+        // Cost of creating a new parent for this node and the leaf
+        float cost = 2.0f * combinedArea;
+        // Minimum cost of pushing the leaf further down the tree
+        float inheritanceCost = 2.0f * (combinedArea - area);
+
+        auto childCost = [&](int32_t child) {
+            const Node& childNode = m_Nodes[child];
+            float newArea = SurfaceArea(Union(leafBox, childNode.Box));
+            if (childNode.IsLeaf()) {
+                return newArea + inheritanceCost;
+            }
+            return (newArea - SurfaceArea(childNode.Box)) + inheritanceCost;
+        };
+        float cost1 = childCost(node.Child1);
+        float cost2 = childCost(node.Child2);
+
+        if (cost < cost1 && cost < cost2) {
+            break;
+        }
+        index = cost1 < cost2 ? node.Child1 : node.Child2;
+    }
+    int32_t sibling = index;
+
+    // Create a new parent for the sibling and the leaf
+    int32_t oldParent = m_Nodes[sibling].Parent;
+    int32_t newParent = AllocateNode();
+    m_Nodes[newParent].Parent = oldParent;
+    m_Nodes[newParent].Box = Union(leafBox, m_Nodes[sibling].Box);
+    m_Nodes[newParent].Height = m_Nodes[sibling].Height + 1;
+    m_Nodes[newParent].Child1 = sibling;
+    m_Nodes[newParent].Child2 = leaf;
+    m_Nodes[sibling].Parent = newParent;
+    m_Nodes[leaf].Parent = newParent;
+
+    if (oldParent != NullNode) {
+        if (m_Nodes[oldParent].Child1 == sibling) {
+            m_Nodes[oldParent].Child1 = newParent;
+        } else {
+            m_Nodes[oldParent].Child2 = newParent;
+        }
+    } else {
+        m_Root = newParent;
+    }
+
+    // Walk back up, rebalancing and refitting the ancestors
+    index = m_Nodes[leaf].Parent;
+    while (index != NullNode) {
+        index = Balance(index);
+        Node& node = m_Nodes[index];
+        node.Height = 1 + std::max(m_Nodes[node.Child1].Height, m_Nodes[node.Child2].Height);
+        node.Box = Union(m_Nodes[node.Child1].Box, m_Nodes[node.Child2].Box);
+        index = node.Parent;
+    }
+}
+
+void DynamicAABBTree::RemoveLeaf(int32_t leaf) {
+    if (leaf == m_Root) {
+        m_Root = NullNode;
+        return;
+    }
+
+    int32_t parent = m_Nodes[leaf].Parent;
+    int32_t grandParent = m_Nodes[parent].Parent;
+    int32_t sibling = m_Nodes[parent].Child1 == leaf ? m_Nodes[parent].Child2 : m_Nodes[parent].Child1;
+
+    if (grandParent == NullNode) {
+        m_Root = sibling;
+        m_Nodes[sibling].Parent = NullNode;
+        FreeNode(parent);
+        return;
+    }
+
+    // Replace the parent by the sibling, then refit the ancestors
+    if (m_Nodes[grandParent].Child1 == parent) {
+        m_Nodes[grandParent].Child1 = sibling;
+    } else {
+        m_Nodes[grandParent].Child2 = sibling;
+    }
+    m_Nodes[sibling].Parent = grandParent;
+    FreeNode(parent);
+
+    int32_t index = grandParent;
+    while (index != NullNode) {
+        index = Balance(index);
+        Node& node = m_Nodes[index];
+        node.Box = Union(m_Nodes[node.Child1].Box, m_Nodes[node.Child2].Box);
+        node.Height = 1 + std::max(m_Nodes[node.Child1].Height, m_Nodes[node.Child2].Height);
+        index = node.Parent;
+    }
+}
+
+// --- Rotations ---
+
+// Performs a left or right rotation if node A is imbalanced.
+// Returns the new root of the subtree.
+int32_t DynamicAABBTree::Balance(int32_t iA) {
+    Node* A = &m_Nodes[iA];
+    if (A->IsLeaf() || A->Height < 2) {
+        return iA;
+    }
+
+    int32_t iB = A->Child1;
+    int32_t iC = A->Child2;
+    Node* B = &m_Nodes[iB];
+    Node* C = &m_Nodes[iC];
+    int32_t balance = C->Height - B->Height;
+
+    // Rotate C up
+    if (balance > 1) {
+        int32_t iF = C->Child1;
+        int32_t iG = C->Child2;
+        Node* F = &m_Nodes[iF];
+        Node* G = &m_Nodes[iG];
+
+        C->Child1 = iA;
+        C->Parent = A->Parent;
+        A->Parent = iC;
+        if (C->Parent != NullNode) {
+            if (m_Nodes[C->Parent].Child1 == iA) {
+                m_Nodes[C->Parent].Child1 = iC;
+            } else {
+                m_Nodes[C->Parent].Child2 = iC;
+            }
+        } else {
+            m_Root = iC;
+        }
+
+        if (F->Height > G->Height) {
+            C->Child2 = iF;
+            A->Child2 = iG;
+            G->Parent = iA;
+            A->Box = Union(B->Box, G->Box);
+            C->Box = Union(A->Box, F->Box);
+            A->Height = 1 + std::max(B->Height, G->Height);
+            C->Height = 1 + std::max(A->Height, F->Height);
+        } else {
+            C->Child2 = iG;
+            A->Child2 = iF;
+            F->Parent = iA;
+            A->Box = Union(B->Box, F->Box);
+            C->Box = Union(A->Box, G->Box);
+            A->Height = 1 + std::max(B->Height, F->Height);
+            C->Height = 1 + std::max(A->Height, G->Height);
+        }
+        return iC;
+    }
+
+    // Rotate B up
+    if (balance < -1) {
+        int32_t iD = B->Child1;
+        int32_t iE = B->Child2;
+        Node* D = &m_Nodes[iD];
+        Node* E = &m_Nodes[iE];
+
+        B->Child1 = iA;
+        B->Parent = A->Parent;
+        A->Parent = iB;
+        if (B->Parent != NullNode) {
+            if (m_Nodes[B->Parent].Child1 == iA) {
+                m_Nodes[B->Parent].Child1 = iB;
+            } else {
+                m_Nodes[B->Parent].Child2 = iB;
+            }
+        } else {
+            m_Root = iB;
+        }
+
+        if (D->Height > E->Height) {
+            B->Child2 = iD;
+            A->Child1 = iE;
+            E->Parent = iA;
+            A->Box = Union(C->Box, E->Box);
+            B->Box = Union(A->Box, D->Box);
+            A->Height = 1 + std::max(C->Height, E->Height);
+            B->Height = 1 + std::max(A->Height, D->Height);
+        } else {
+            B->Child2 = iE;
+            A->Child1 = iD;
+            D->Parent = iA;
+            A->Box = Union(C->Box, D->Box);
+            B->Box = Union(A->Box, E->Box);
+            A->Height = 1 + std::max(C->Height, D->Height);
+            B->Height = 1 + std::max(A->Height, E->Height);
+        }
+        return iB;
+    }
+
+    return iA;
+}
+
+// --- Box helpers ---
+
+bool DynamicAABBTree::Contains(const AABB& outer, const AABB& inner) {
+    return outer.Min.x <= inner.Min.x && outer.Min.y <= inner.Min.y && outer.Min.z <= inner.Min.z
+        && inner.Max.x <= outer.Max.x && inner.Max.y <= outer.Max.y && inner.Max.z <= outer.Max.z;
+}
+
+bool DynamicAABBTree::Overlaps(const AABB& a, const AABB& b) {
+    return a.Min.x <= b.Max.x && b.Min.x <= a.Max.x
+        && a.Min.y <= b.Max.y && b.Min.y <= a.Max.y
+        && a.Min.z <= b.Max.z && b.Min.z <= a.Max.z;
+}
+
+float DynamicAABBTree::SurfaceArea(const AABB& box) {
+    glm::vec3 size = box.Max - box.Min;
+    return 2.0f * (size.x * size.y + size.y * size.z + size.z * size.x);
+}
+
+AABB DynamicAABBTree::Union(const AABB& a, const AABB& b) {
+    return AABB(glm::min(a.Min, b.Min), glm::max(a.Max, b.Max));
+}
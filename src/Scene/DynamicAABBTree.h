@@ -0,0 +1,187 @@
+// src/Scene/DynamicAABBTree.h
+#pragma once
+
+#include "../Renderer/Bounds.h"
+#include "../Renderer/Frustum.h"
+#include <cstdint>
+#include <vector>
+
+// Incrementally maintained bounding volume hierarchy (same design as Box2D's
+// b2DynamicTree). Leaves store a "fat" box, enlarged by a margin, so small
+// movements do not touch the tree at all; a leaf that leaves its fat box is
+// removed and reinserted (O(log n)), and every insertion/removal rebalances
+// the path to the root with rotations.
+class DynamicAABBTree {
+public:
+    static constexpr int32_t NullNode = -1;
+
+    DynamicAABBTree();
+
+    // Returns the proxy id, stable until DestroyProxy
+    int32_t CreateProxy(const AABB& box, uint32_t userData);
+    void DestroyProxy(int32_t proxyId);
+    // Returns true if the leaf had to be reinserted
+    bool MoveProxy(int32_t proxyId, const AABB& box);
+    void Clear();
+
+    uint32_t GetUserData(int32_t proxyId) const { return m_Nodes[proxyId].UserData; }
+    const AABB& GetFatAABB(int32_t proxyId) const { return m_Nodes[proxyId].Box; }
+    uint32_t GetProxyCount() const { return m_ProxyCount; }
+    int32_t GetHeight() const { return m_Root == NullNode ? 0 : m_Nodes[m_Root].Height; }
+
+    // callback(proxyId) for every leaf whose fat box overlaps `box`.
+    // Returning false from the callback stops the query.
+    template<typename Callback>
+    void Query(const AABB& box, Callback&& callback) const;
+
+    // callback(proxyId) for every leaf whose fat box intersects the frustum.
+    // Subtrees fully inside the frustum are reported without further plane tests.
+    template<typename Callback>
+    void QueryFrustum(const Frustum& frustum, Callback&& callback) const;
+
+    // Ray from `origin` along `direction` (not necessarily normalized), up to
+    // `maxDistance` in units of `direction`. callback(proxyId, maxDistance)
+    // returns the new max distance: the hit distance to clip the ray, the
+    // current value to ignore the proxy, or 0 to stop.
+    template<typename Callback>
+    void RayCast(const glm::vec3& origin, const glm::vec3& direction, float maxDistance, Callback&& callback) const;
+
+private:
+    struct Node {
+        AABB Box;
+        uint32_t UserData = 0;
+        int32_t Parent = NullNode; // Next free node when the node is in the free list
+        int32_t Child1 = NullNode;
+        int32_t Child2 = NullNode;
+        int32_t Height = -1;       // 0 for leaves, -1 for free nodes
+
+        bool IsLeaf() const { return Child1 == NullNode; }
+    };
+
+    int32_t AllocateNode();
+    void FreeNode(int32_t nodeId);
+    void InsertLeaf(int32_t leaf);
+    void RemoveLeaf(int32_t leaf);
+    int32_t Balance(int32_t nodeId);
+
+    static bool Contains(const AABB& outer, const AABB& inner);
+    static bool Overlaps(const AABB& a, const AABB& b);
+    static float SurfaceArea(const AABB& box);
+    static AABB Union(const AABB& a, const AABB& b);
+
+    std::vector<Node> m_Nodes;
+    int32_t m_Root = NullNode;
+    int32_t m_FreeList = NullNode;
+    uint32_t m_ProxyCount = 0;
+    // Stack reused by the queries, kept per tree to avoid allocating per call
+    mutable std::vector<int32_t> m_Stack;
+};
+
+// --- Template queries ---
+
+template<typename Callback>
+void DynamicAABBTree::Query(const AABB& box, Callback&& callback) const {
+    if (m_Root == NullNode) {
+        return;
+    }
+    m_Stack.clear();
+    m_Stack.push_back(m_Root);
+    while (!m_Stack.empty()) {
+        int32_t nodeId = m_Stack.back();
+        m_Stack.pop_back();
+        const Node& node = m_Nodes[nodeId];
+        if (!Overlaps(node.Box, box)) {
+            continue;
+        }
+        if (node.IsLeaf()) {
+            if (!callback(nodeId)) {
+                return;
+            }
+        } else {
+            m_Stack.push_back(node.Child1);
+            m_Stack.push_back(node.Child2);
+        }
+    }
+}
+
+template<typename Callback>
+void DynamicAABBTree::QueryFrustum(const Frustum& frustum, Callback&& callback) const {
+    if (m_Root == NullNode) {
+        return;
+    }
+    // Each stack entry carries a "fully inside" flag in its sign bit: ~nodeId
+    m_Stack.clear();
+    m_Stack.push_back(m_Root);
+    while (!m_Stack.empty()) {
+        int32_t entry = m_Stack.back();
+        m_Stack.pop_back();
+        bool inside = entry < 0;
+        int32_t nodeId = inside ? ~entry : entry;
+        const Node& node = m_Nodes[nodeId];
+
+        if (!inside) {
+            glm::vec3 center = node.Box.GetCenter();
+            glm::vec3 extents = node.Box.GetExtents();
+            bool outside = false;
+            inside = true;
+            for (int i = 0; i < 6; i++) {
+                const glm::vec4& plane = frustum.GetPlane(i);
+                float distance = glm::dot(glm::vec3(plane), center) + plane.w;
+                float radius = glm::dot(glm::abs(glm::vec3(plane)), extents);
+                if (distance + radius < 0.0f) {
+                    outside = true;
+                    break;
+                }
+                if (distance - radius < 0.0f) {
+                    inside = false;
+                }
+            }
+            if (outside) {
+                continue;
+            }
+        }
+
+        if (node.IsLeaf()) {
+            callback(nodeId);
+        } else {
+            m_Stack.push_back(inside ? ~node.Child1 : node.Child1);
+            m_Stack.push_back(inside ? ~node.Child2 : node.Child2);
+        }
+    }
+}
+
+template<typename Callback>
+void DynamicAABBTree::RayCast(const glm::vec3& origin, const glm::vec3& direction, float maxDistance, Callback&& callback) const {
+    if (m_Root == NullNode) {
+        return;
+    }
+    const glm::vec3 inverseDirection(1.0f / direction.x, 1.0f / direction.y, 1.0f / direction.z);
+    m_Stack.clear();
+    m_Stack.push_back(m_Root);
+    while (!m_Stack.empty()) {
+        int32_t nodeId = m_Stack.back();
+        m_Stack.pop_back();
+        const Node& node = m_Nodes[nodeId];
+
+        // Slab test against the node box
+        glm::vec3 t1 = (node.Box.Min - origin) * inverseDirection;
+        glm::vec3 t2 = (node.Box.Max - origin) * inverseDirection;
+        glm::vec3 tMin = glm::min(t1, t2);
+        glm::vec3 tMax = glm::max(t1, t2);
+        float enter = glm::max(glm::max(tMin.x, tMin.y), glm::max(tMin.z, 0.0f));
+        float exit = glm::min(glm::min(tMax.x, tMax.y), glm::min(tMax.z, maxDistance));
+        if (enter > exit) {
+            continue;
+        }
+
+        if (node.IsLeaf()) {
+            maxDistance = callback(nodeId, maxDistance);
+            if (maxDistance <= 0.0f) {
+                return;
+            }
+        } else {
+            m_Stack.push_back(node.Child1);
+            m_Stack.push_back(node.Child2);
+        }
+    }
+}
@@ -4,6 +4,9 @@
 #include "Scene.h"
 #include <entt/entt.hpp>
 #include <cassert> // Pour les assertions
+#include <type_traits>
+
+struct TransformComponent;
 
 class Entity {
 public:
@@ -17,17 +20,33 @@ public:
         return m_Scene->m_Registry.emplace<T>(m_EntityHandle, std::forward<Args>(args)...);
     }
 
+    // A TransformComponent comes back const: a write through a plain
+    // reference would never reach the TransformSystem. Use PatchComponent.
     template<typename T>
-    T& GetComponent() {
+    std::conditional_t<std::is_same_v<T, TransformComponent>, const T&, T&> GetComponent() {
         assert(HasComponent<T>() && "L'entité n'a pas ce composant !");
         return m_Scene->m_Registry.get<T>(m_EntityHandle);
     }
 
+    // Modifies a component in place and notifies the scene (on_update
+    // signal), e.g. so a changed TransformComponent gets recomputed
+    template<typename T, typename... Func>
+    T& PatchComponent(Func&&... func) {
+        assert(HasComponent<T>() && "L'entité n'a pas ce composant !");
+        return m_Scene->m_Registry.patch<T>(m_EntityHandle, std::forward<Func>(func)...);
+    }
+
     template<typename T>
     bool HasComponent() {
         return m_Scene->m_Registry.all_of<T>(m_EntityHandle);
     }
 
+    void SetParent(Entity parent) {
+        m_Scene->SetParent(m_EntityHandle, parent.m_EntityHandle);
+    }
+
+    entt::entity GetHandle() const { return m_EntityHandle; }
+
     // On rendra l'opérateur booléen pour vérifier si l'entité est valide
     operator bool() const { return m_EntityHandle != entt::null; }
 
@@ -2,8 +2,18 @@
 #include "Scene.h"
 #include "Entity.h"
 #include "Components.h"
+#include "../Core/Profiler.h"
+#include <algorithm>
+#include <iostream>
 
 Scene::Scene() {
+    m_Registry.on_construct<TransformComponent>().connect<&Scene::OnTransformChanged>(*this);
+    m_Registry.on_update<TransformComponent>().connect<&Scene::OnTransformChanged>(*this);
+    // A new model needs its bounds computed, which happens for changed transforms
+    m_Registry.on_construct<ModelComponent>().connect<&Scene::OnTransformChanged>(*this);
+    m_Registry.on_update<ModelComponent>().connect<&Scene::OnTransformChanged>(*this);
+    m_Registry.on_destroy<BoundsComponent>().connect<&Scene::OnBoundsDestroyed>(*this);
+    m_Registry.on_destroy<ModelComponent>().connect<&Scene::OnModelDestroyed>(*this);
 }
 
 Scene::~Scene() {
@@ -17,6 +27,152 @@ Entity Scene::CreateEntity(const std::string& name) {
     return entity;
 }
 
+void Scene::OnUpdate(float deltaTime) {
+    PLUME_PROFILE_FUNCTION();
+    m_ChangedTransforms.clear();
+    m_TransformSystem.Update(m_Registry, m_ChangedTransforms);
+    UpdateBounds();
+}
+
+void Scene::SetParent(entt::entity child, entt::entity parent) {
+    if (child == parent) {
+        return;
+    }
+    for (entt::entity ancestor = parent; ancestor != entt::null;) {
+        if (ancestor == child) {
+            std::cerr << "Scene: SetParent would create a cycle, ignored" << std::endl;
+            return;
+        }
+        const auto* relationship = m_Registry.try_get<RelationshipComponent>(ancestor);
+        ancestor = relationship ? relationship->Parent : entt::null;
+    }
+
+    entt::entity oldParent = m_Registry.get_or_emplace<RelationshipComponent>(child).Parent;
+    if (oldParent == parent) {
+        return;
+    }
+    if (oldParent != entt::null && m_Registry.valid(oldParent)) {
+        auto& siblings = m_Registry.get<RelationshipComponent>(oldParent).Children;
+        siblings.erase(std::remove(siblings.begin(), siblings.end(), child), siblings.end());
+    }
+    if (parent != entt::null) {
+        // May grow the pool: the child's component is fetched again below
+        m_Registry.get_or_emplace<RelationshipComponent>(parent).Children.push_back(child);
+    }
+    m_Registry.get<RelationshipComponent>(child).Parent = parent;
+    MarkTransformDirty(child);
+}
+
+void Scene::MarkTransformDirty(entt::entity entity) {
+    if (!m_Registry.all_of<TransformDirtyComponent>(entity)) {
+        m_Registry.emplace<TransformDirtyComponent>(entity);
+    }
+}
+
+void Scene::OnTransformChanged(entt::registry& registry, entt::entity entity) {
+    MarkTransformDirty(entity);
+}
+
+void Scene::UpdateBounds() {
+    // Only entities whose world matrix was just rewritten can have new bounds
+    for (auto entity : m_ChangedTransforms) {
+        auto* modelComp = m_Registry.try_get<ModelComponent>(entity);
+        if (!modelComp) {
+            continue;
+        }
+        auto& bounds = m_Registry.get_or_emplace<BoundsComponent>(entity);
+        AABB worldBounds;
+        if (modelComp->model) {
+            const auto& worldTransform = m_Registry.get<WorldTransformComponent>(entity);
+            worldBounds = modelComp->model->GetBounds().Transform(worldTransform.World);
+        }
+
+        // The tree is only touched when the bounds actually changed, and even
+        // then only when they leave the leaf's fat box
+        if (bounds.Proxy == DynamicAABBTree::NullNode) {
+            bounds.WorldBounds = worldBounds;
+            bounds.Proxy = m_SpatialIndex.CreateProxy(worldBounds, entt::to_integral(entity));
+            m_Registry.get_or_emplace<LodComponent>(entity);
+        } else if (worldBounds.Min != bounds.WorldBounds.Min || worldBounds.Max != bounds.WorldBounds.Max) {
+            bounds.WorldBounds = worldBounds;
+            m_SpatialIndex.MoveProxy(bounds.Proxy, worldBounds);
+        }
+    }
+}
+
+void Scene::OnBoundsDestroyed(entt::registry& registry, entt::entity entity) {
+    auto& bounds = registry.get<BoundsComponent>(entity);
+    if (bounds.Proxy != DynamicAABBTree::NullNode) {
+        m_SpatialIndex.DestroyProxy(bounds.Proxy);
+        bounds.Proxy = DynamicAABBTree::NullNode;
+    }
+}
+
+void Scene::OnModelDestroyed(entt::registry& registry, entt::entity entity) {
+    if (const std::shared_ptr<Model>& model = registry.get<ModelComponent>(entity).model) {
+        m_RetiredModels.push_back(model);
+    }
+    registry.remove<BoundsComponent>(entity);
+    registry.remove<LodComponent>(entity);
+}
+
+void Scene::TakeRetiredModels(std::vector<std::shared_ptr<Model>>& outModels) {
+    if (outModels.empty()) {
+        outModels.swap(m_RetiredModels);
+        return;
+    }
+    outModels.insert(outModels.end(), m_RetiredModels.begin(), m_RetiredModels.end());
+    m_RetiredModels.clear();
+}
+
+void Scene::QueryFrustum(const Frustum& frustum, std::vector<entt::entity>& outEntities) const {
+    m_SpatialIndex.QueryFrustum(frustum, [&](int32_t proxyId) {
+        outEntities.push_back(static_cast<entt::entity>(m_SpatialIndex.GetUserData(proxyId)));
+    });
+}
+
+void Scene::QueryOverlap(const AABB& box, std::vector<entt::entity>& outEntities) const {
+    m_SpatialIndex.Query(box, [&](int32_t proxyId) {
+        // Leaves store fat boxes: confirm against the exact bounds
+        entt::entity entity = static_cast<entt::entity>(m_SpatialIndex.GetUserData(proxyId));
+        const AABB& bounds = m_Registry.get<BoundsComponent>(entity).WorldBounds;
+        if (bounds.Min.x <= box.Max.x && box.Min.x <= bounds.Max.x
+            && bounds.Min.y <= box.Max.y && box.Min.y <= bounds.Max.y
+            && bounds.Min.z <= box.Max.z && box.Min.z <= bounds.Max.z) {
+            outEntities.push_back(entity);
+        }
+        return true;
+    });
+}
+
+entt::entity Scene::RayCast(const glm::vec3& origin, const glm::vec3& direction, float maxDistance, float* outDistance) {
+    entt::entity closest = entt::null;
+    float closestDistance = maxDistance;
+    const glm::vec3 inverseDirection(1.0f / direction.x, 1.0f / direction.y, 1.0f / direction.z);
+    m_SpatialIndex.RayCast(origin, direction, maxDistance, [&](int32_t proxyId, float currentMax) {
+        // Leaves store fat boxes: intersect the exact bounds
+        entt::entity entity = static_cast<entt::entity>(m_SpatialIndex.GetUserData(proxyId));
+        const AABB& bounds = m_Registry.get<BoundsComponent>(entity).WorldBounds;
+        glm::vec3 t1 = (bounds.Min - origin) * inverseDirection;
+        glm::vec3 t2 = (bounds.Max - origin) * inverseDirection;
+        glm::vec3 tMin = glm::min(t1, t2);
+        glm::vec3 tMax = glm::max(t1, t2);
+        float enter = glm::max(glm::max(tMin.x, tMin.y), glm::max(tMin.z, 0.0f));
+        float exit = glm::min(glm::min(tMax.x, tMax.y), tMax.z);
+        if (enter > exit || enter >= currentMax) {
+            return currentMax;
+        }
+        closest = entity;
+        closestDistance = enter;
+        return enter;
+    });
+
+    if (outDistance && closest != entt::null) {
+        *outDistance = closestDistance;
+    }
+    return closest;
+}
+
 // L'implémentation de Entity(handle, scene) doit être ici
 // car Scene.h est maintenant complètement défini.
 Entity::Entity(entt::entity handle, Scene* scene)
@@ -2,8 +2,13 @@
 #pragma once
 
 #include <entt/entt.hpp>
+#include "DynamicAABBTree.h"
+#include "TransformSystem.h"
+#include <memory>
+#include <vector>
 
 class Entity; // Déclaration anticipée
+class Model;
 
 class Scene {
 public:
@@ -12,10 +17,45 @@ public:
 
     Entity CreateEntity(const std::string& name = std::string());
 
+    // Runs the scene systems (transforms, world bounds) once per frame, before rendering
+    void OnUpdate(float deltaTime);
+
+    // Attaches `child` under `parent` (entt::null detaches it). Refuses cycles.
+    void SetParent(entt::entity child, entt::entity parent);
+    // Flags the transform for the next update; done automatically when a
+    // TransformComponent is emplaced or patched
+    void MarkTransformDirty(entt::entity entity);
+
     // Exposer le registre pour que les systèmes (comme le rendu) puissent l'utiliser
     entt::registry& GetRegistry() { return m_Registry; }
 
+    // --- Spatial queries (world bounds as of the last OnUpdate) ---
+    // Entities whose bounds may intersect the frustum (conservative: fat boxes)
+    void QueryFrustum(const Frustum& frustum, std::vector<entt::entity>& outEntities) const;
+    // Entities whose bounds overlap `box`
+    void QueryOverlap(const AABB& box, std::vector<entt::entity>& outEntities) const;
+    // Closest entity whose bounds are hit by the ray, or entt::null
+    entt::entity RayCast(const glm::vec3& origin, const glm::vec3& direction, float maxDistance = FLT_MAX, float* outDistance = nullptr);
+
+    const DynamicAABBTree& GetSpatialIndex() const { return m_SpatialIndex; }
+
+    // Models of the ModelComponents destroyed since the last call, appended to
+    // `outModels`. The component may have held the last reference: freeing a
+    // model deletes GL objects and arena ranges, which only the GL thread may
+    // do, so the renderer releases them there (see RenderSnapshot::RetiredModels).
+    void TakeRetiredModels(std::vector<std::shared_ptr<Model>>& outModels);
+
 private:
+    void UpdateBounds();
+    void OnTransformChanged(entt::registry& registry, entt::entity entity);
+    void OnBoundsDestroyed(entt::registry& registry, entt::entity entity);
+    void OnModelDestroyed(entt::registry& registry, entt::entity entity);
+
+    // Declared before the registry so it outlives the components referencing it
+    DynamicAABBTree m_SpatialIndex;
+    TransformSystem m_TransformSystem;
+    std::vector<entt::entity> m_ChangedTransforms;
+    std::vector<std::shared_ptr<Model>> m_RetiredModels;
     entt::registry m_Registry;
 
     friend class Entity;
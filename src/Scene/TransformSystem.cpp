@@ -0,0 +1,192 @@
+// src/Scene/TransformSystem.cpp
+#include "TransformSystem.h"
+#include "Components.h"
+#include "../Core/JobSystem.h"
+#include <glm/gtc/type_ptr.hpp>
+#include <cmath>
+
+#if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+    #include <xmmintrin.h>
+    #define PLUME_TRANSFORM_SSE 1
+#endif
+
+// Slots per job for the local and world passes
+static constexpr uint32_t TRANSFORM_GRAIN = 1024;
+
+// out = a * b (column-major), one SSE register per column
+static void MultiplyMatrices(const glm::mat4& a, const glm::mat4& b, glm::mat4& out) {
+#if defined(PLUME_TRANSFORM_SSE)
+    const float* pa = glm::value_ptr(a);
+    const float* pb = glm::value_ptr(b);
+    float* po = glm::value_ptr(out);
+    __m128 a0 = _mm_loadu_ps(pa), a1 = _mm_loadu_ps(pa + 4), a2 = _mm_loadu_ps(pa + 8), a3 = _mm_loadu_ps(pa + 12);
+    for (int column = 0; column < 4; column++) {
+        const float* bc = pb + column * 4;
+        __m128 result = _mm_add_ps(
+            _mm_add_ps(_mm_mul_ps(a0, _mm_set1_ps(bc[0])), _mm_mul_ps(a1, _mm_set1_ps(bc[1]))),
+            _mm_add_ps(_mm_mul_ps(a2, _mm_set1_ps(bc[2])), _mm_mul_ps(a3, _mm_set1_ps(bc[3]))));
+        _mm_storeu_ps(po + column * 4, result);
+    }
+#else
+    out = a * b;
+#endif
+}
+
+void TransformSystem::Update(entt::registry& registry, std::vector<entt::entity>& outChanged) {
+    Gather(registry);
+    const uint32_t count = static_cast<uint32_t>(m_Entities.size());
+    if (count == 0) {
+        return;
+    }
+
+    m_Locals.resize(count);
+    m_Worlds.resize(count);
+    JobSystem::ParallelFor(count, TRANSFORM_GRAIN, [this](uint32_t begin, uint32_t end) {
+        ComputeLocalMatrices(begin, end);
+    });
+    // A level only reads the world matrices of the previous one
+    for (size_t level = 0; level + 1 < m_LevelOffsets.size(); level++) {
+        uint32_t levelBegin = m_LevelOffsets[level];
+        uint32_t levelCount = m_LevelOffsets[level + 1] - levelBegin;
+        JobSystem::ParallelFor(levelCount, TRANSFORM_GRAIN, [this, levelBegin](uint32_t begin, uint32_t end) {
+            ComputeWorldMatrices(levelBegin + begin, levelBegin + end);
+        });
+    }
+
+    // Scatter back (sequential: emplacing components is not thread-safe)
+    outChanged.reserve(outChanged.size() + count);
+    for (uint32_t i = 0; i < count; i++) {
+        auto& worldTransform = registry.get_or_emplace<WorldTransformComponent>(m_Entities[i]);
+        worldTransform.Local = m_Locals[i];
+        worldTransform.World = m_Worlds[i];
+        outChanged.push_back(m_Entities[i]);
+    }
+    registry.clear<TransformDirtyComponent>();
+}
+
+void TransformSystem::Gather(entt::registry& registry) {
+    m_Entities.clear();
+    m_ParentSlots.clear();
+    m_ExternalParents.clear();
+    m_LevelOffsets.clear();
+
+    auto parentOf = [&registry](entt::entity entity) -> entt::entity {
+        const auto* relationship = registry.try_get<RelationshipComponent>(entity);
+        if (!relationship || relationship->Parent == entt::null || !registry.valid(relationship->Parent)) {
+            return entt::null;
+        }
+        return relationship->Parent;
+    };
+
+    // 1. Roots of the dirty subtrees: dirty entities without a dirty ancestor
+    auto dirtyView = registry.view<TransformDirtyComponent>();
+    for (auto entity : dirtyView) {
+        if (!registry.all_of<TransformComponent>(entity)) {
+            continue;
+        }
+        bool coveredByAncestor = false;
+        for (entt::entity ancestor = parentOf(entity); ancestor != entt::null; ancestor = parentOf(ancestor)) {
+            if (registry.all_of<TransformDirtyComponent>(ancestor)) {
+                coveredByAncestor = true;
+                break;
+            }
+        }
+        if (coveredByAncestor) {
+            continue;
+        }
+
+        int32_t parentSlot = -1;
+        entt::entity parent = parentOf(entity);
+        if (parent != entt::null) {
+            const auto* parentWorld = registry.try_get<WorldTransformComponent>(parent);
+            if (parentWorld) {
+                parentSlot = -2 - static_cast<int32_t>(m_ExternalParents.size());
+                m_ExternalParents.push_back(parentWorld->World);
+            }
+        }
+        m_Entities.push_back(entity);
+        m_ParentSlots.push_back(parentSlot);
+    }
+
+    // 2. Descendants, breadth-first: one level at a time
+    uint32_t levelBegin = 0;
+    uint32_t levelEnd = static_cast<uint32_t>(m_Entities.size());
+    m_LevelOffsets.push_back(0);
+    while (levelBegin < levelEnd) {
+        for (uint32_t slot = levelBegin; slot < levelEnd; slot++) {
+            const auto* relationship = registry.try_get<RelationshipComponent>(m_Entities[slot]);
+            if (!relationship) {
+                continue;
+            }
+            for (entt::entity child : relationship->Children) {
+                if (registry.valid(child) && registry.all_of<TransformComponent>(child)) {
+                    m_Entities.push_back(child);
+                    m_ParentSlots.push_back(static_cast<int32_t>(slot));
+                }
+            }
+        }
+        m_LevelOffsets.push_back(levelEnd);
+        levelBegin = levelEnd;
+        levelEnd = static_cast<uint32_t>(m_Entities.size());
+    }
+
+    // 3. SoA copy of the transforms
+    const size_t count = m_Entities.size();
+    for (auto* array : { &m_TranslationX, &m_TranslationY, &m_TranslationZ, &m_RotationX, &m_RotationY, &m_RotationZ, &m_ScaleX, &m_ScaleY, &m_ScaleZ }) {
+        array->resize(count);
+    }
+    for (size_t i = 0; i < count; i++) {
+        const auto& transform = registry.get<TransformComponent>(m_Entities[i]);
+        m_TranslationX[i] = transform.Translation.x;
+        m_TranslationY[i] = transform.Translation.y;
+        m_TranslationZ[i] = transform.Translation.z;
+        m_RotationX[i] = transform.Rotation.x;
+        m_RotationY[i] = transform.Rotation.y;
+        m_RotationZ[i] = transform.Rotation.z;
+        m_ScaleX[i] = transform.Scale.x;
+        m_ScaleY[i] = transform.Scale.y;
+        m_ScaleZ[i] = transform.Scale.z;
+    }
+}
+
+void TransformSystem::ComputeLocalMatrices(uint32_t begin, uint32_t end) {
+    // Same result as TransformComponent::GetTransform(), T * Rx * Ry * Rz * S,
+    // written out in closed form from the SoA arrays
+    for (uint32_t i = begin; i < end; i++) {
+        float cx = std::cos(m_RotationX[i]), sx = std::sin(m_RotationX[i]);
+        float cy = std::cos(m_RotationY[i]), sy = std::sin(m_RotationY[i]);
+        float cz = std::cos(m_RotationZ[i]), sz = std::sin(m_RotationZ[i]);
+        float scaleX = m_ScaleX[i], scaleY = m_ScaleY[i], scaleZ = m_ScaleZ[i];
+
+        float* m = glm::value_ptr(m_Locals[i]);
+        m[0]  = (cy * cz) * scaleX;
+        m[1]  = (sx * sy * cz + cx * sz) * scaleX;
+        m[2]  = (-cx * sy * cz + sx * sz) * scaleX;
+        m[3]  = 0.0f;
+        m[4]  = (-cy * sz) * scaleY;
+        m[5]  = (-sx * sy * sz + cx * cz) * scaleY;
+        m[6]  = (cx * sy * sz + sx * cz) * scaleY;
+        m[7]  = 0.0f;
+        m[8]  = sy * scaleZ;
+        m[9]  = (-sx * cy) * scaleZ;
+        m[10] = (cx * cy) * scaleZ;
+        m[11] = 0.0f;
+        m[12] = m_TranslationX[i];
+        m[13] = m_TranslationY[i];
+        m[14] = m_TranslationZ[i];
+        m[15] = 1.0f;
+    }
+}
+
+void TransformSystem::ComputeWorldMatrices(uint32_t begin, uint32_t end) {
+    for (uint32_t i = begin; i < end; i++) {
+        int32_t parentSlot = m_ParentSlots[i];
+        if (parentSlot == -1) {
+            m_Worlds[i] = m_Locals[i];
+        } else if (parentSlot >= 0) {
+            MultiplyMatrices(m_Worlds[parentSlot], m_Locals[i], m_Worlds[i]);
+        } else {
+            MultiplyMatrices(m_ExternalParents[-parentSlot - 2], m_Locals[i], m_Worlds[i]);
+        }
+    }
+}
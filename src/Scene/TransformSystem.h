@@ -0,0 +1,41 @@
+// src/Scene/TransformSystem.h
+#pragma once
+
+#include <entt/entt.hpp>
+#include <glm/glm.hpp>
+#include <cstdint>
+#include <vector>
+
+// Keeps the WorldTransformComponent of every entity up to date.
+// Only dirty entities (TransformComponent emplaced or patched, entity
+// reparented) and their descendants are recomputed. The work set is gathered
+// breadth-first, so each hierarchy level only depends on the previous one:
+// local matrices are built from SoA arrays in one pass, then world matrices
+// level by level, both split across the JobSystem.
+class TransformSystem {
+public:
+    // Recomputes the dirty subtrees and clears the dirty tags. `outChanged`
+    // receives every entity whose world matrix was rewritten.
+    void Update(entt::registry& registry, std::vector<entt::entity>& outChanged);
+
+private:
+    void Gather(entt::registry& registry);
+    void ComputeLocalMatrices(uint32_t begin, uint32_t end);
+    void ComputeWorldMatrices(uint32_t begin, uint32_t end);
+
+    // Work set, one slot per entity to update, parents before children
+    std::vector<entt::entity> m_Entities;
+    // Parent of each slot: >= 0 slot index, -1 no parent,
+    // <= -2 clean parent whose world matrix is m_ExternalParents[-slot - 2]
+    std::vector<int32_t> m_ParentSlots;
+    std::vector<glm::mat4> m_ExternalParents;
+    std::vector<uint32_t> m_LevelOffsets; // Slot range of each hierarchy level
+
+    // SoA copy of the TransformComponents being updated
+    std::vector<float> m_TranslationX, m_TranslationY, m_TranslationZ;
+    std::vector<float> m_RotationX, m_RotationY, m_RotationZ;
+    std::vector<float> m_ScaleX, m_ScaleY, m_ScaleZ;
+
+    std::vector<glm::mat4> m_Locals;
+    std::vector<glm::mat4> m_Worlds;
+};
@@ -4,9 +4,13 @@
 int main(int argc, char* argv[]) {
     // Simple CLI parsing for splash control
     bool noSplash = false;
+    bool pipelined = false;
+    bool indirectDraws = false;
     for (int i = 1; i < argc; ++i) {
         std::string a(argv[i]);
         if (a == "--no-splash" || a == "-n") { noSplash = true; }
+        if (a == "--pipelined" || a == "-p") { pipelined = true; }
+        if (a == "--indirect" || a == "-i") { indirectDraws = true; }
     }
 
     if (!noSplash) {
@@ -14,7 +18,7 @@ int main(int argc, char* argv[]) {
         SplashScreen::ShowFromConfig();
     }
 
-    PlumeApplication app;
+    PlumeApplication app(pipelined, indirectDraws);
     app.Run();
     return 0;
 }
\ No newline at end of file
@@ -0,0 +1,100 @@
+// tests/MeshOptimizerTests.cpp
+// MeshOptimizer::Optimize on unwelded meshes, as ModelImporter hands them over
+#include "TestMeshes.h"
+#include "Renderer/Model/MeshOptimizer.h"
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <array>
+
+struct OptimizerBounds {
+    float MaxAcmr;
+    float MaxAtvr;
+    float MaxOverfetch;
+};
+
+// Same mesh, triangles in a fixed pseudo-random order: what an exporter that
+// does not care about vertex caches emits
+static TestMesh Scramble(const TestMesh& mesh) {
+    TestMesh scrambled = mesh;
+    uint32_t state = 12345;
+    for (size_t triangle = scrambled.Indices.size() / 3; triangle > 1; triangle--) {
+        state = state * 1664525u + 1013904223u;
+        const size_t other = (state >> 8) % triangle;
+        std::swap_ranges(&scrambled.Indices[(triangle - 1) * 3], &scrambled.Indices[triangle * 3], &scrambled.Indices[other * 3]);
+    }
+    return scrambled;
+}
+
+// Optimizes the unwelded copy of `mesh` and checks it against the bounds and
+// against `mesh` itself, welded. ATVR is only comparable between meshes with
+// the same vertex count, so the welded input is the "before" here; the
+// report's own "before" is the unwelded list (ACMR 3).
+//
+// `mesh` is scrambled first: generated in row order, a grid already fetches
+// its vertices linearly, which the cache order trades away.
+static void CheckOptimize(const TestMesh& orderedMesh, uint32_t referencedVertexCount, const OptimizerBounds& bounds) {
+    const TestMesh mesh = Scramble(orderedMesh);
+    const uint32_t vertexSize = static_cast<uint32_t>(sizeof(Vertex));
+    const uint32_t weldedCount = static_cast<uint32_t>(mesh.Vertices.size());
+    const VertexCacheStats cacheBefore = MeshOptimizer::AnalyzeVertexCache(mesh.Indices.data(), mesh.Indices.size(), weldedCount);
+    const VertexFetchStats fetchBefore = MeshOptimizer::AnalyzeVertexFetch(mesh.Indices.data(), mesh.Indices.size(), weldedCount, vertexSize);
+
+    TestMesh corners = Unweld(mesh);
+    const MeshOptimizationReport report = MeshOptimizer::Optimize(corners.Vertices, corners.Indices);
+    EXPECT_EQ(report.VerticesBefore, mesh.Indices.size());
+    EXPECT_EQ(report.VerticesAfter, referencedVertexCount);
+    ASSERT_EQ(corners.Vertices.size(), referencedVertexCount);
+    ASSERT_EQ(corners.Indices.size(), mesh.Indices.size());
+    EXPECT_FLOAT_EQ(report.CacheBefore.ACMR, 3.0f);
+    EXPECT_LT(report.CacheAfter.ACMR, report.CacheBefore.ACMR);
+    EXPECT_LT(report.FetchAfter.BytesFetched, report.FetchBefore.BytesFetched);
+
+    EXPECT_LE(report.CacheAfter.ACMR, cacheBefore.ACMR);
+    EXPECT_LE(report.CacheAfter.ATVR, cacheBefore.ATVR);
+    EXPECT_LE(report.FetchAfter.BytesFetched, fetchBefore.BytesFetched);
+
+    EXPECT_LE(report.CacheAfter.ACMR, bounds.MaxAcmr);
+    EXPECT_LE(report.CacheAfter.ATVR, bounds.MaxAtvr);
+    EXPECT_LE(report.FetchAfter.Overfetch, bounds.MaxOverfetch);
+}
+
+// Corner positions of each triangle, rotated to start at the smallest one so
+// the winding is kept, in sorted order
+static std::vector<std::array<float, 9>> SortedTriangles(const std::vector<Vertex>& vertices, const std::vector<uint32_t>& indices) {
+    std::vector<std::array<float, 9>> triangles;
+    for (size_t i = 0; i < indices.size(); i += 3) {
+        std::array<std::array<float, 3>, 3> corners;
+        for (uint32_t corner = 0; corner < 3; corner++) {
+            const glm::vec3& position = vertices[indices[i + corner]].Position;
+            corners[corner] = { position.x, position.y, position.z };
+        }
+        const size_t first = std::min_element(corners.begin(), corners.end()) - corners.begin();
+        std::array<float, 9> triangle;
+        for (uint32_t corner = 0; corner < 3; corner++) {
+            std::copy(corners[(first + corner) % 3].begin(), corners[(first + corner) % 3].end(), triangle.begin() + corner * 3);
+        }
+        triangles.push_back(triangle);
+    }
+    std::sort(triangles.begin(), triangles.end());
+    return triangles;
+}
+
+TEST(MeshOptimizer, GridReachesCacheAndFetchBounds) {
+    // 64 x 64 quads. Reordered, a 16-entry FIFO gets within reach of the 0.5
+    // ideal of a regular grid.
+    CheckOptimize(MakeGrid(2 * 64 * 64), 65 * 65, { 0.75f, 1.45f, 1.7f });
+}
+
+TEST(MeshOptimizer, SphereReachesCacheAndFetchBounds) {
+    // 32 rings x 64 segments. The first vertex of each pole ring is unused
+    // and dropped.
+    CheckOptimize(MakeSphere(32, 64), 33 * 65 - 2, { 0.8f, 1.45f, 1.7f });
+}
+
+TEST(MeshOptimizer, KeepsEveryTriangle) {
+    for (const TestMesh& mesh : { MakeGrid(2 * 16 * 16), MakeSphere(8, 16) }) {
+        TestMesh corners = Unweld(mesh);
+        MeshOptimizer::Optimize(corners.Vertices, corners.Indices);
+        EXPECT_TRUE(SortedTriangles(mesh.Vertices, mesh.Indices) == SortedTriangles(corners.Vertices, corners.Indices));
+    }
+}
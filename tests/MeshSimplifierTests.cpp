@@ -0,0 +1,134 @@
+// tests/MeshSimplifierTests.cpp
+// LOD chains built at import: triangle budget and error of every level
+#include "TestMeshes.h"
+#include "Renderer/Model/MeshSimplifier.h"
+#include <gtest/gtest.h>
+
+// Relative float slack on the measured distances
+static constexpr float DISTANCE_EPSILON = 1e-5f;
+
+// Closest point of triangle abc to p (Ericson, Real-Time Collision Detection 5.1.5)
+static glm::vec3 ClosestPointOnTriangle(const glm::vec3& p, const glm::vec3& a, const glm::vec3& b, const glm::vec3& c) {
+    const glm::vec3 ab = b - a;
+    const glm::vec3 ac = c - a;
+    const glm::vec3 ap = p - a;
+    const float d1 = glm::dot(ab, ap);
+    const float d2 = glm::dot(ac, ap);
+    if (d1 <= 0.0f && d2 <= 0.0f) {
+        return a;
+    }
+    const glm::vec3 bp = p - b;
+    const float d3 = glm::dot(ab, bp);
+    const float d4 = glm::dot(ac, bp);
+    if (d3 >= 0.0f && d4 <= d3) {
+        return b;
+    }
+    const float vc = d1 * d4 - d3 * d2;
+    if (vc <= 0.0f && d1 >= 0.0f && d3 <= 0.0f) {
+        return a + ab * (d1 / (d1 - d3));
+    }
+    const glm::vec3 cp = p - c;
+    const float d5 = glm::dot(ab, cp);
+    const float d6 = glm::dot(ac, cp);
+    if (d6 >= 0.0f && d5 <= d6) {
+        return c;
+    }
+    const float vb = d5 * d2 - d1 * d6;
+    if (vb <= 0.0f && d2 >= 0.0f && d6 <= 0.0f) {
+        return a + ac * (d2 / (d2 - d6));
+    }
+    const float va = d3 * d6 - d5 * d4;
+    if (va <= 0.0f && (d4 - d3) >= 0.0f && (d5 - d6) >= 0.0f) {
+        return b + (c - b) * ((d4 - d3) / ((d4 - d3) + (d5 - d6)));
+    }
+    const float denominator = 1.0f / (va + vb + vc);
+    return a + ab * (vb * denominator) + ac * (vc * denominator);
+}
+
+// Brute-force one-sided Hausdorff distance: how far the vertices of level 0
+// are from the surface of `lod`
+static float MeasureDeviation(const MeshData& data, const MeshLod& lod) {
+    const MeshLod& base = data.Lods[0];
+    std::vector<bool> referenced(data.Vertices.size(), false);
+    for (uint32_t i = 0; i < base.IndexCount; i++) {
+        referenced[data.Indices[base.IndexOffset + i]] = true;
+    }
+
+    float deviation = 0.0f;
+    for (size_t v = 0; v < data.Vertices.size(); v++) {
+        if (!referenced[v]) {
+            continue;
+        }
+        const glm::vec3& p = data.Vertices[v].Position;
+        float closest = std::numeric_limits<float>::max();
+        for (uint32_t i = 0; i < lod.IndexCount && closest > 0.0f; i += 3) {
+            const uint32_t* triangle = &data.Indices[lod.IndexOffset + i];
+            const glm::vec3 q = ClosestPointOnTriangle(p, data.Vertices[triangle[0]].Position, data.Vertices[triangle[1]].Position, data.Vertices[triangle[2]].Position);
+            closest = std::min(closest, glm::dot(p - q, p - q));
+        }
+        deviation = std::max(deviation, closest);
+    }
+    return std::sqrt(deviation);
+}
+
+// Checks every level against the previous one: at most LOD_MIN_REDUCTION of
+// its triangles (or the chain would have stopped), at least the
+// LOD_REDUCTION target less one collapse, and no further from level 0 than
+// its recorded error
+static void CheckLods(const MeshData& data, uint32_t minLevels) {
+    ASSERT_GE(data.Lods.size(), minLevels);
+    ASSERT_LE(data.Lods.size(), ModelImporter::LOD_LEVEL_COUNT);
+    EXPECT_EQ(data.Lods[0].IndexOffset, 0u);
+    EXPECT_EQ(data.Lods[0].Error, 0.0f);
+
+    AABB bounds;
+    for (const Vertex& vertex : data.Vertices) {
+        bounds.Expand(vertex.Position);
+    }
+    const glm::vec3 extents = bounds.Max - bounds.Min;
+    const float extent = std::max(std::max(extents.x, extents.y), extents.z);
+
+    for (size_t level = 1; level < data.Lods.size(); level++) {
+        const MeshLod& previous = data.Lods[level - 1];
+        const MeshLod& lod = data.Lods[level];
+        const uint32_t previousTriangles = previous.IndexCount / 3;
+        const uint32_t triangles = lod.IndexCount / 3;
+        const uint32_t target = static_cast<uint32_t>(previousTriangles * ModelImporter::LOD_REDUCTION);
+        SCOPED_TRACE("level " + std::to_string(level));
+
+        EXPECT_EQ(lod.IndexOffset, previous.IndexOffset + previous.IndexCount);
+        EXPECT_EQ(lod.IndexCount % 3, 0u);
+        EXPECT_LE(triangles, previousTriangles * ModelImporter::LOD_MIN_REDUCTION);
+        EXPECT_GE(triangles + 2, target);
+        // The recorded error bounds the real one, and is not pessimistic either
+        const float deviation = MeasureDeviation(data, lod);
+        EXPECT_LE(deviation, lod.Error + DISTANCE_EPSILON * extent);
+        EXPECT_NEAR(deviation, lod.Error, DISTANCE_EPSILON * extent);
+    }
+}
+
+TEST(MeshSimplifier, GridLodChain) {
+    // 32 x 32 quads of a wavy grid, open border included
+    CheckLods(Import(MakeGrid(2 * 32 * 32)), ModelImporter::LOD_LEVEL_COUNT);
+}
+
+TEST(MeshSimplifier, SphereLodChain) {
+    CheckLods(Import(MakeSphere(24, 48)), ModelImporter::LOD_LEVEL_COUNT);
+}
+
+TEST(MeshSimplifier, FlatGridCollapsesToTheTarget) {
+    // A plane loses nothing: the first level reaches its target with zero
+    // error, and keeps the four corners of the open border
+    TestMesh grid = MakeGrid(2 * 16 * 16);
+    for (Vertex& vertex : grid.Vertices) {
+        vertex.Position.y = 0.0f;
+        vertex.Normal = glm::vec3(0.0f, 1.0f, 0.0f);
+    }
+    const uint32_t target = static_cast<uint32_t>(grid.Indices.size() / 2) / 3 * 3;
+    float error = -1.0f;
+    const std::vector<uint32_t> simplified = MeshSimplifier::Simplify(grid.Vertices.data(), static_cast<uint32_t>(grid.Vertices.size()),
+                                                                      grid.Indices.data(), grid.Indices.size(), target, 0.01f, &error);
+    EXPECT_LE(simplified.size(), target);
+    EXPECT_GE(simplified.size() + 6, target);
+    EXPECT_NEAR(error, 0.0f, 1e-4f);
+}
@@ -0,0 +1,212 @@
+// tests/OffsetAllocatorTests.cpp
+// OffsetAllocator (TLSF) bookkeeping: merges, bin rounding, Grow and Defragment
+#include "Renderer/OffsetAllocator.h"
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <vector>
+
+// Sizes used below sit on bin boundaries (powers of two), so a free block of
+// exactly that size is found by Allocate
+static constexpr uint32_t BLOCK = 64;
+
+static void ExpectSingleFreeBlock(const OffsetAllocator& allocator, uint32_t freeSpace) {
+    const OffsetAllocatorStats stats = allocator.GetStats();
+    EXPECT_EQ(stats.FreeRegions, 1u);
+    EXPECT_EQ(stats.FreeSpace, freeSpace);
+    EXPECT_EQ(stats.LargestFreeRegion, freeSpace);
+    EXPECT_FLOAT_EQ(stats.GetFragmentation(), 0.0f);
+}
+
+TEST(OffsetAllocator, FreeMergesBothNeighbours) {
+    OffsetAllocator allocator(8 * BLOCK);
+    std::vector<OffsetAllocation> blocks;
+    for (uint32_t i = 0; i < 4; i++) {
+        blocks.push_back(allocator.Allocate(BLOCK));
+        ASSERT_TRUE(blocks.back().IsValid());
+        EXPECT_EQ(blocks.back().Offset, i * BLOCK);
+    }
+
+    // Two holes around block 1, plus the tail after block 3
+    allocator.Free(blocks[0]);
+    allocator.Free(blocks[2]);
+    EXPECT_EQ(allocator.GetStats().FreeRegions, 3u);
+
+    // Block 1 joins both holes into one
+    allocator.Free(blocks[1]);
+    OffsetAllocatorStats stats = allocator.GetStats();
+    EXPECT_EQ(stats.FreeRegions, 2u);
+    EXPECT_EQ(stats.LargestFreeRegion, 4 * BLOCK);
+    EXPECT_EQ(stats.Allocations, 1u);
+
+    allocator.Free(blocks[3]);
+    ExpectSingleFreeBlock(allocator, 8 * BLOCK);
+    EXPECT_EQ(allocator.GetStats().Allocations, 0u);
+    const OffsetAllocation whole = allocator.Allocate(8 * BLOCK);
+    ASSERT_TRUE(whole.IsValid());
+    EXPECT_EQ(whole.Offset, 0u);
+}
+
+TEST(OffsetAllocator, RoundedUpBinAlwaysFits) {
+    // Every block of the bin Allocate searches holds the request: the largest
+    // size one below it lands in a lower bin. And the rounding costs at most a bin.
+    std::vector<uint32_t> sizes;
+    for (uint32_t size = 1; size <= 1u << 16; size++) {
+        sizes.push_back(size);
+    }
+    for (uint32_t bit = 17; bit < 32; bit++) {
+        for (uint32_t delta : { 1u, 0u }) {
+            sizes.push_back((1u << bit) - delta);
+            sizes.push_back((1u << bit) + 1 + delta);
+        }
+        sizes.push_back((1u << bit) + (1u << (bit - 2)) + 12345);
+    }
+    sizes.push_back(0xFFFFFFFFu);
+    for (uint32_t size : sizes) {
+        const uint32_t bin = OffsetAllocator::SizeToBinRoundUp(size);
+        ASSERT_LT(bin, OffsetAllocator::BIN_COUNT) << size;
+        ASSERT_LT(OffsetAllocator::SizeToBinRoundDown(size - 1), bin) << size;
+        ASSERT_GE(bin, OffsetAllocator::SizeToBinRoundDown(size)) << size;
+        ASSERT_LE(bin, OffsetAllocator::SizeToBinRoundDown(size) + 1) << size;
+    }
+}
+
+TEST(OffsetAllocator, AllocationsNeverOverlap) {
+    // Random allocations and frees: the blocks handed out stay disjoint and
+    // the counters match them
+    OffsetAllocator allocator(4096);
+    std::vector<OffsetAllocation> blocks;
+    uint32_t state = 12345;
+    for (uint32_t step = 0; step < 2000; step++) {
+        state = state * 1664525u + 1013904223u;
+        if (!blocks.empty() && (state >> 16) % 3 == 0) {
+            const size_t victim = (state >> 8) % blocks.size();
+            allocator.Free(blocks[victim]);
+            blocks[victim] = blocks.back();
+            blocks.pop_back();
+            continue;
+        }
+        const OffsetAllocation block = allocator.Allocate(1 + (state >> 20) % 100);
+        if (block.IsValid()) {
+            blocks.push_back(block);
+        }
+    }
+
+    std::vector<uint8_t> owner(allocator.GetSize(), 0);
+    uint32_t usedSpace = 0;
+    for (const OffsetAllocation& block : blocks) {
+        const uint32_t offset = allocator.GetOffset(block);
+        const uint32_t size = allocator.GetAllocationSize(block);
+        ASSERT_LE(offset + size, allocator.GetSize());
+        for (uint32_t i = offset; i < offset + size; i++) {
+            ASSERT_EQ(owner[i], 0) << "unit " << i << " handed out twice";
+            owner[i] = 1;
+        }
+        usedSpace += size;
+    }
+    const OffsetAllocatorStats stats = allocator.GetStats();
+    EXPECT_EQ(stats.Allocations, blocks.size());
+    EXPECT_EQ(stats.FreeSpace, allocator.GetSize() - usedSpace);
+}
+
+TEST(OffsetAllocator, GrowExtendsFreeTail) {
+    OffsetAllocator allocator(4 * BLOCK);
+    const OffsetAllocation first = allocator.Allocate(2 * BLOCK);
+    allocator.Grow(8 * BLOCK);
+    EXPECT_EQ(allocator.GetSize(), 8 * BLOCK);
+    EXPECT_EQ(allocator.GetOffset(first), 0u);
+    ExpectSingleFreeBlock(allocator, 6 * BLOCK);
+
+    // The old tail and the new range are one block
+    const OffsetAllocation second = allocator.Allocate(4 * BLOCK);
+    ASSERT_TRUE(second.IsValid());
+    EXPECT_EQ(second.Offset, 2 * BLOCK);
+}
+
+TEST(OffsetAllocator, GrowAfterUsedTail) {
+    OffsetAllocator allocator(BLOCK);
+    const OffsetAllocation first = allocator.Allocate(BLOCK);
+    ASSERT_TRUE(first.IsValid());
+    EXPECT_EQ(allocator.GetStats().FreeRegions, 0u);
+    EXPECT_FALSE(allocator.Allocate(1).IsValid());
+
+    allocator.Grow(2 * BLOCK);
+    ExpectSingleFreeBlock(allocator, BLOCK);
+    const OffsetAllocation second = allocator.Allocate(BLOCK);
+    ASSERT_TRUE(second.IsValid());
+    EXPECT_EQ(second.Offset, BLOCK);
+
+    // The new block is linked after the old tail: freeing both merges them
+    allocator.Free(first);
+    allocator.Free(second);
+    ExpectSingleFreeBlock(allocator, 2 * BLOCK);
+}
+
+TEST(OffsetAllocator, DefragmentPacksInAddressOrder) {
+    OffsetAllocator allocator(16 * BLOCK);
+    std::vector<OffsetAllocation> blocks;
+    for (uint32_t i = 0; i < 8; i++) {
+        blocks.push_back(allocator.Allocate((i % 2 + 1) * BLOCK));
+        ASSERT_TRUE(blocks.back().IsValid());
+    }
+    const std::vector<uint32_t> freed = { 1, 4, 5 };
+    for (uint32_t i : freed) {
+        allocator.Free(blocks[i]);
+    }
+    const OffsetAllocatorStats before = allocator.GetStats();
+    EXPECT_GT(before.GetFragmentation(), 0.0f);
+
+    const std::vector<OffsetRelocation> relocations = allocator.Defragment();
+
+    // Only block 0 stays: the others pack behind it in their old order
+    uint32_t expectedOffset = 0;
+    size_t relocation = 0;
+    for (uint32_t i = 0; i < blocks.size(); i++) {
+        if (std::find(freed.begin(), freed.end(), i) != freed.end()) {
+            continue;
+        }
+        const uint32_t size = (i % 2 + 1) * BLOCK;
+        EXPECT_EQ(allocator.GetOffset(blocks[i]), expectedOffset) << "block " << i;
+        EXPECT_EQ(allocator.GetAllocationSize(blocks[i]), size);
+        if (blocks[i].Offset != expectedOffset) {
+            ASSERT_LT(relocation, relocations.size());
+            const OffsetRelocation& move = relocations[relocation++];
+            EXPECT_EQ(move.Node, blocks[i].Node);
+            EXPECT_EQ(move.OldOffset, blocks[i].Offset);
+            EXPECT_EQ(move.NewOffset, expectedOffset);
+            EXPECT_EQ(move.Size, size);
+        }
+        expectedOffset += size;
+    }
+    EXPECT_EQ(relocation, relocations.size());
+    for (size_t i = 1; i < relocations.size(); i++) {
+        EXPECT_LT(relocations[i - 1].OldOffset, relocations[i].OldOffset);
+    }
+
+    ExpectSingleFreeBlock(allocator, before.FreeSpace);
+    EXPECT_EQ(allocator.GetStats().Allocations, before.Allocations);
+
+    // Moved handles still free correctly: the last one merges into the tail
+    allocator.Free(blocks[7]);
+    ExpectSingleFreeBlock(allocator, before.FreeSpace + 2 * BLOCK);
+}
+
+TEST(OffsetAllocator, FragmentationOfScatteredHoles) {
+    OffsetAllocator allocator(16 * BLOCK);
+    EXPECT_FLOAT_EQ(allocator.GetStats().GetFragmentation(), 0.0f);
+
+    std::vector<OffsetAllocation> blocks;
+    for (uint32_t i = 0; i < 16; i++) {
+        blocks.push_back(allocator.Allocate(BLOCK));
+    }
+    // Full: no free space, nothing to fragment
+    EXPECT_FLOAT_EQ(allocator.GetStats().GetFragmentation(), 0.0f);
+
+    for (uint32_t i = 0; i < 16; i += 2) {
+        allocator.Free(blocks[i]);
+    }
+    const OffsetAllocatorStats stats = allocator.GetStats();
+    EXPECT_EQ(stats.FreeRegions, 8u);
+    EXPECT_EQ(stats.FreeSpace, 8 * BLOCK);
+    EXPECT_EQ(stats.LargestFreeRegion, BLOCK);
+    EXPECT_FLOAT_EQ(stats.GetFragmentation(), 1.0f - 1.0f / 8.0f);
+}
@@ -0,0 +1,122 @@
+// tests/TestMeshes.h
+// Synthetic meshes shared by the import tests and PlumeMicroBench
+#pragma once
+
+#include "Renderer/Model/Mesh.h"
+#include "Renderer/Model/ModelImporter.h"
+#include <assimp/scene.h>
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+struct TestMesh {
+    std::vector<Vertex> Vertices;
+    std::vector<uint32_t> Indices;
+};
+
+// Wavy open grid, 10 x 10 units, of about `triangleCount` triangles. Welded:
+// one vertex per grid point.
+inline TestMesh MakeGrid(uint32_t triangleCount) {
+    const uint32_t side = std::max(1u, static_cast<uint32_t>(std::sqrt(triangleCount / 2.0)));
+    TestMesh grid;
+    grid.Vertices.reserve((side + 1) * (side + 1));
+    for (uint32_t y = 0; y <= side; y++) {
+        for (uint32_t x = 0; x <= side; x++) {
+            const float u = static_cast<float>(x) / side;
+            const float v = static_cast<float>(y) / side;
+            Vertex vertex;
+            vertex.Position = glm::vec3(u * 10.0f, std::sin(u * 12.0f) * std::cos(v * 9.0f) * 0.3f, v * 10.0f);
+            vertex.Normal = glm::normalize(glm::vec3(-std::cos(u * 12.0f) * 0.3f, 1.0f, std::sin(v * 9.0f) * 0.2f));
+            vertex.TexCoords = glm::vec2(u, v);
+            grid.Vertices.push_back(vertex);
+        }
+    }
+    grid.Indices.reserve(side * side * 6);
+    for (uint32_t y = 0; y < side; y++) {
+        for (uint32_t x = 0; x < side; x++) {
+            const uint32_t a = y * (side + 1) + x;
+            const uint32_t b = a + side + 1;
+            grid.Indices.insert(grid.Indices.end(), { a, b, a + 1, a + 1, b, b + 1 });
+        }
+    }
+    return grid;
+}
+
+// Closed UV sphere of radius 2 centered on (1, -3, 5). The seam column is
+// duplicated (same position, different UV), like an exported model.
+inline TestMesh MakeSphere(uint32_t rings, uint32_t segments) {
+    const float pi = 3.14159265358979f;
+    TestMesh sphere;
+    for (uint32_t ring = 0; ring <= rings; ring++) {
+        const float theta = pi * ring / rings;
+        for (uint32_t segment = 0; segment <= segments; segment++) {
+            const float phi = 2.0f * pi * segment / segments;
+            const glm::vec3 normal(std::sin(theta) * std::cos(phi), std::cos(theta), std::sin(theta) * std::sin(phi));
+            Vertex vertex;
+            vertex.Position = glm::vec3(1.0f, -3.0f, 5.0f) + normal * 2.0f;
+            vertex.Normal = normal;
+            vertex.TexCoords = glm::vec2(static_cast<float>(segment) / segments, static_cast<float>(ring) / rings);
+            sphere.Vertices.push_back(vertex);
+        }
+    }
+    for (uint32_t ring = 0; ring < rings; ring++) {
+        for (uint32_t segment = 0; segment < segments; segment++) {
+            const uint32_t a = ring * (segments + 1) + segment;
+            const uint32_t b = a + segments + 1;
+            if (ring != 0) {
+                sphere.Indices.insert(sphere.Indices.end(), { a, a + 1, b });
+            }
+            if (ring != rings - 1) {
+                sphere.Indices.insert(sphere.Indices.end(), { a + 1, b + 1, b });
+            }
+        }
+    }
+    return sphere;
+}
+
+// What Assimp hands over after aiProcess_Triangulate: one vertex per face corner
+inline TestMesh Unweld(const TestMesh& mesh) {
+    TestMesh corners;
+    corners.Vertices.reserve(mesh.Indices.size());
+    corners.Indices.reserve(mesh.Indices.size());
+    for (uint32_t index : mesh.Indices) {
+        corners.Indices.push_back(static_cast<uint32_t>(corners.Vertices.size()));
+        corners.Vertices.push_back(mesh.Vertices[index]);
+    }
+    return corners;
+}
+
+// aiMesh owning its arrays (freed by the aiMesh destructor)
+inline std::unique_ptr<aiMesh> MakeAssimpMesh(const TestMesh& corners) {
+    auto mesh = std::make_unique<aiMesh>();
+    const uint32_t vertexCount = static_cast<uint32_t>(corners.Vertices.size());
+    mesh->mNumVertices = vertexCount;
+    mesh->mVertices = new aiVector3D[vertexCount];
+    mesh->mNormals = new aiVector3D[vertexCount];
+    mesh->mTextureCoords[0] = new aiVector3D[vertexCount];
+    for (uint32_t i = 0; i < vertexCount; i++) {
+        const Vertex& vertex = corners.Vertices[i];
+        mesh->mVertices[i] = aiVector3D(vertex.Position.x, vertex.Position.y, vertex.Position.z);
+        mesh->mNormals[i] = aiVector3D(vertex.Normal.x, vertex.Normal.y, vertex.Normal.z);
+        mesh->mTextureCoords[0][i] = aiVector3D(vertex.TexCoords.x, vertex.TexCoords.y, 0.0f);
+    }
+    const uint32_t faceCount = static_cast<uint32_t>(corners.Indices.size() / 3);
+    mesh->mNumFaces = faceCount;
+    mesh->mFaces = new aiFace[faceCount];
+    for (uint32_t i = 0; i < faceCount; i++) {
+        mesh->mFaces[i].mNumIndices = 3;
+        mesh->mFaces[i].mIndices = new unsigned int[3]{ corners.Indices[i * 3], corners.Indices[i * 3 + 1], corners.Indices[i * 3 + 2] };
+    }
+    return mesh;
+}
+
+// `mesh` through the whole import conversion, as a model file would go
+inline MeshData Import(const TestMesh& mesh) {
+    std::unique_ptr<aiMesh> assimpMesh = MakeAssimpMesh(Unweld(mesh));
+    aiScene scene; // No material: the texture lookup is skipped
+    MeshData data;
+    ModelImporter::ConvertMesh(assimpMesh.get(), &scene, data);
+    return data;
+}
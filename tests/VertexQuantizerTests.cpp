@@ -0,0 +1,64 @@
+// tests/VertexQuantizerTests.cpp
+// Quantization report of imported meshes, and the packed vertices themselves
+#include "TestMeshes.h"
+#include "Renderer/Model/VertexQuantizer.h"
+#include <gtest/gtest.h>
+
+// Octahedral normals on 2 x snorm16 are off by a few thousandths of a degree;
+// the report measures them with a float acos, which cannot resolve much
+// under 0.03 degrees
+static constexpr float MAX_NORMAL_ERROR_DEGREES = 0.05f;
+
+// Relative float slack on top of half a step, for the unpacking arithmetic
+static constexpr float POSITION_EPSILON = 1e-6f;
+
+static void CheckQuantization(const MeshData& data) {
+    const uint32_t vertexCount = static_cast<uint32_t>(data.Vertices.size());
+    const QuantizationReport& report = data.Quantization;
+    ASSERT_GT(vertexCount, 0u);
+
+    // 16 bytes per vertex; the rest is the index buffer
+    const uint32_t indexSize = vertexCount <= 0x10000 ? sizeof(uint16_t) : sizeof(uint32_t);
+    const uint32_t indexBytes = static_cast<uint32_t>(data.Indices.size()) * indexSize;
+    EXPECT_EQ(report.BytesAfter - indexBytes, vertexCount * 16u);
+    EXPECT_EQ(report.BytesBefore - data.Indices.size() * sizeof(uint32_t), vertexCount * sizeof(Vertex));
+
+    // A unorm16 step is 1/65535 of the mesh box on each axis; rounding is at
+    // most half of it per axis
+    const VertexQuantization quantization = VertexQuantizer::ComputeQuantization(data.Vertices.data(), vertexCount);
+    const glm::vec3 halfStep = glm::vec3(quantization.PositionScale) / 65535.0f * 0.5f;
+    const float slack = POSITION_EPSILON * glm::length(glm::abs(glm::vec3(quantization.PositionOffset)) + glm::vec3(quantization.PositionScale));
+    EXPECT_LE(report.MaxPositionError, glm::length(halfStep) + slack);
+    EXPECT_LE(report.MaxNormalErrorDegrees, MAX_NORMAL_ERROR_DEGREES);
+
+    for (uint32_t i = 0; i < vertexCount; i++) {
+        PackedVertex packed;
+        VertexQuantizer::Pack(&data.Vertices[i], 1, quantization, &packed);
+        const Vertex unpacked = VertexQuantizer::Unpack(packed, quantization);
+        for (int axis = 0; axis < 3; axis++) {
+            ASSERT_LE(std::abs(unpacked.Position[axis] - data.Vertices[i].Position[axis]), halfStep[axis] + slack)
+                << "vertex " << i << ", axis " << axis;
+        }
+    }
+}
+
+TEST(VertexQuantizer, ImportedGridStaysWithinHalfAStep) {
+    CheckQuantization(Import(MakeGrid(2 * 64 * 64)));
+}
+
+TEST(VertexQuantizer, ImportedSphereStaysWithinHalfAStep) {
+    CheckQuantization(Import(MakeSphere(32, 64)));
+}
+
+TEST(VertexQuantizer, OctahedralRoundTrip) {
+    // Axes, the folded lower half and the octahedron edges
+    const glm::vec3 normals[] = {
+        { 1, 0, 0 }, { -1, 0, 0 }, { 0, 1, 0 }, { 0, -1, 0 }, { 0, 0, 1 }, { 0, 0, -1 },
+        { 1, 1, 1 }, { -1, 1, -1 }, { 1, -1, -1 }, { -1, -1, -1 }, { 0.3f, -0.2f, -0.9f }, { 1, 1, 0 },
+    };
+    for (const glm::vec3& normal : normals) {
+        const glm::vec3 expected = glm::normalize(normal);
+        const glm::vec3 decoded = VertexQuantizer::DecodeOctahedral(VertexQuantizer::EncodeOctahedral(expected));
+        EXPECT_NEAR(glm::dot(decoded, expected), 1.0f, 1e-6f);
+    }
+}